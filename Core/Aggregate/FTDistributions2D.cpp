@@ -139,8 +139,8 @@ double FTDistribution2DCone::evaluate(double qx, double qy) const
     double scaled_q = std::sqrt(sumsq(qx, qy));
     if (scaled_q < std::numeric_limits<double>::epsilon())
         return 1.0 - 3.0 * scaled_q * scaled_q / 40.0;
-    auto integrator = make_integrator_real(this, &FTDistribution2DCone::coneIntegrand2);
-    double integral = integrator->integrate(0.0, scaled_q);
+    double integral = integrate_real(
+        [this](double value) { return coneIntegrand2(value); }, 0.0, scaled_q);
     return 6.0 * (MathFunctions::Bessel_J1c(scaled_q) - integral / scaled_q / scaled_q / scaled_q);
 }
 
@@ -18,23 +18,30 @@
 #include "ILayerRTCoefficients.h"
 #include "SimulationElement.h"
 #include "WavevectorInfo.h"
+#include <limits>
 
-FormFactorCoherentPart::FormFactorCoherentPart(IFormFactor* p_ff) : mP_ff(p_ff) {}
+namespace
+{
+const size_t no_amplitude_index = std::numeric_limits<size_t>::max();
+}
 
-FormFactorCoherentPart::FormFactorCoherentPart(const FormFactorCoherentPart& other)
-    : mP_ff(other.mP_ff->clone()), mp_fresnel_map(other.mp_fresnel_map),
-      m_layer_index(other.m_layer_index)
+FormFactorCoherentPart::FormFactorCoherentPart(IFormFactor* p_ff)
+    : mP_ff(p_ff), mp_fresnel_map(nullptr), m_layer_index(0),
+      m_amplitude_index(no_amplitude_index)
 {
 }
 
-FormFactorCoherentPart& FormFactorCoherentPart::operator=(const FormFactorCoherentPart& other)
+FormFactorCoherentPart::FormFactorCoherentPart(std::shared_ptr<const IFormFactor> P_ff)
+    : mP_ff(std::move(P_ff)), mp_fresnel_map(nullptr), m_layer_index(0),
+      m_amplitude_index(no_amplitude_index)
 {
-    mP_ff.reset(other.mP_ff->clone());
-    mp_fresnel_map = other.mp_fresnel_map;
-    m_layer_index = other.m_layer_index;
-    return *this;
 }
 
+FormFactorCoherentPart::FormFactorCoherentPart(const FormFactorCoherentPart& other) = default;
+
+FormFactorCoherentPart&
+FormFactorCoherentPart::operator=(const FormFactorCoherentPart& other) = default;
+
 FormFactorCoherentPart& FormFactorCoherentPart::operator=(FormFactorCoherentPart&&) = default;
 
 FormFactorCoherentPart::FormFactorCoherentPart(FormFactorCoherentPart&&) = default;
@@ -43,13 +50,20 @@ FormFactorCoherentPart::~FormFactorCoherentPart() = default;
 
 complex_t FormFactorCoherentPart::evaluate(const SimulationElement& sim_element) const
 {
-    WavevectorInfo wavevectors(sim_element.getKi(), sim_element.getMeanKf(),
-                               sim_element.getWavelength());
+    return lateralPhaseFactor(sim_element) * evaluateAmplitude(sim_element);
+}
 
-    auto P_in_coeffs = mp_fresnel_map->getInCoefficients(sim_element, m_layer_index);
-    auto P_out_coeffs = mp_fresnel_map->getOutCoefficients(sim_element, m_layer_index);
-    mP_ff->setSpecularInfo(std::move(P_in_coeffs), std::move(P_out_coeffs));
-    return mP_ff->evaluate(wavevectors);
+complex_t FormFactorCoherentPart::evaluate(const SimulationElement& sim_element,
+                                           std::vector<complex_t>& amplitudes) const
+{
+    if (m_amplitude_index == no_amplitude_index)
+        return evaluate(sim_element);
+    if (m_amplitude_index >= amplitudes.size())
+        amplitudes.resize(m_amplitude_index + 1, std::numeric_limits<double>::quiet_NaN());
+    complex_t& amplitude = amplitudes[m_amplitude_index];
+    if (std::isnan(amplitude.real()))
+        amplitude = evaluateAmplitude(sim_element);
+    return lateralPhaseFactor(sim_element) * amplitude;
 }
 
 Eigen::Matrix2cd FormFactorCoherentPart::evaluatePol(const SimulationElement& sim_element) const
@@ -59,8 +73,8 @@ Eigen::Matrix2cd FormFactorCoherentPart::evaluatePol(const SimulationElement& si
 
     auto P_in_coeffs = mp_fresnel_map->getInCoefficients(sim_element, m_layer_index);
     auto P_out_coeffs = mp_fresnel_map->getOutCoefficients(sim_element, m_layer_index);
-    mP_ff->setSpecularInfo(std::move(P_in_coeffs), std::move(P_out_coeffs));
-    return mP_ff->evaluatePol(wavevectors);
+    return lateralPhaseFactor(sim_element)
+           * mP_ff->evaluatePolInLayer(wavevectors, *P_in_coeffs, *P_out_coeffs);
 }
 
 void FormFactorCoherentPart::setSpecularInfo(const IFresnelMap* p_fresnel_map, size_t layer_index)
@@ -73,3 +87,23 @@ double FormFactorCoherentPart::radialExtension() const
 {
     return mP_ff->radialExtension();
 }
+
+complex_t FormFactorCoherentPart::evaluateAmplitude(const SimulationElement& sim_element) const
+{
+    WavevectorInfo wavevectors(sim_element.getKi(), sim_element.getMeanKf(),
+                               sim_element.getWavelength());
+
+    auto P_in_coeffs = mp_fresnel_map->getInCoefficients(sim_element, m_layer_index);
+    auto P_out_coeffs = mp_fresnel_map->getOutCoefficients(sim_element, m_layer_index);
+    return mP_ff->evaluateInLayer(wavevectors, *P_in_coeffs, *P_out_coeffs);
+}
+
+//! Returns the phase factor of the lateral position, which is the same for all DWBA terms,
+//! since these differ only in the z components of the wavevectors
+complex_t FormFactorCoherentPart::lateralPhaseFactor(const SimulationElement& sim_element) const
+{
+    if (m_lateral_position == kvector_t())
+        return 1.0;
+    kvector_t q = sim_element.getKi() - sim_element.getMeanKf();
+    return exp_I(m_lateral_position.dot(q));
+}
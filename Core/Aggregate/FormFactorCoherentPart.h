@@ -17,20 +17,24 @@
 
 #include "Complex.h"
 #include "EigenCore.h"
+#include "Vectors3D.h"
 #include "WinDllMacros.h"
 #include <memory>
+#include <vector>
 
 class IFresnelMap;
 class IFormFactor;
 class SimulationElement;
 
 //! Information about single particle form factor and specular info of the embedding layer.
+//! The form factor is not modified after construction, so that copies share it.
 //! @ingroup formfactors_internal
 
 class BA_CORE_API_ FormFactorCoherentPart
 {
 public:
     FormFactorCoherentPart(IFormFactor* p_ff);
+    FormFactorCoherentPart(std::shared_ptr<const IFormFactor> P_ff);
     FormFactorCoherentPart(const FormFactorCoherentPart& other);
     FormFactorCoherentPart(FormFactorCoherentPart&& other);
     FormFactorCoherentPart& operator=(const FormFactorCoherentPart& other);
@@ -38,16 +42,35 @@ public:
     ~FormFactorCoherentPart();
 
     complex_t evaluate(const SimulationElement& sim_element) const;
+
+    //! Returns the same as evaluate, but takes the amplitude without lateral phase factor from
+    //! the given table if it is there already (entries which are NaN are missing), and stores
+    //! it there otherwise
+    complex_t evaluate(const SimulationElement& sim_element,
+                       std::vector<complex_t>& amplitudes) const;
 #ifndef SWIG
     Eigen::Matrix2cd evaluatePol(const SimulationElement& sim_element) const;
 #endif
 
     void setSpecularInfo(const IFresnelMap* p_fresnel_map, size_t layer_index);
+
+    //! Sets the lateral position of the particle, which is not contained in the form factor
+    void setLateralPosition(kvector_t position) { m_lateral_position = position; }
+
+    //! Sets the index of the amplitude in the tables of evaluate; parts with the same index
+    //! must have identical form factors and layers
+    void setAmplitudeIndex(size_t index) { m_amplitude_index = index; }
+
     double radialExtension() const;
 private:
-    std::unique_ptr<IFormFactor> mP_ff;
+    complex_t evaluateAmplitude(const SimulationElement& sim_element) const;
+    complex_t lateralPhaseFactor(const SimulationElement& sim_element) const;
+
+    std::shared_ptr<const IFormFactor> mP_ff;
     const IFresnelMap* mp_fresnel_map;
     size_t m_layer_index;
+    kvector_t m_lateral_position;
+    size_t m_amplitude_index;
 };
 
 #endif // FORMFACTORCOHERENTPART_H
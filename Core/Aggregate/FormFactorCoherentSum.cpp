@@ -32,6 +32,16 @@ complex_t FormFactorCoherentSum::evaluate(const SimulationElement& sim_element)
     return result;
 }
 
+complex_t FormFactorCoherentSum::evaluate(const SimulationElement& sim_element,
+                                          std::vector<complex_t>& amplitudes) const
+{
+    complex_t result{};
+    for (auto& part : m_parts) {
+        result += part.evaluate(sim_element, amplitudes);
+    }
+    return result;
+}
+
 Eigen::Matrix2cd FormFactorCoherentSum::evaluatePol(const SimulationElement& sim_element) const
 {
     Eigen::Matrix2cd result = Eigen::Matrix2cd::Zero();
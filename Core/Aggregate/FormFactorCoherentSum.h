@@ -34,6 +34,11 @@ public:
 
     complex_t evaluate(const SimulationElement& sim_element) const;
 
+    //! Returns the same as evaluate, sharing amplitudes with other form factors through the
+    //! given table, see FormFactorCoherentPart::evaluate
+    complex_t evaluate(const SimulationElement& sim_element,
+                       std::vector<complex_t>& amplitudes) const;
+
 #ifndef SWIG
     Eigen::Matrix2cd evaluatePol(const SimulationElement& sim_element) const;
 #endif
@@ -41,6 +41,12 @@ public:
     //! and generates new particles if an IAbstractParticle denotes a collection
     virtual SafePointerVector<IParticle> particles() const = 0;
 
+#ifndef SWIG
+    //! Returns the particles of particles(), grouped by the particle type they are generated
+    //! from, in the same order; particle distributions generate groups of several particles
+    virtual std::vector<SafePointerVector<IParticle>> particleGroups() const = 0;
+#endif
+
     //! Returns the interference function
     virtual const IInterferenceFunction* interferenceFunction() const = 0;
 
@@ -141,10 +141,7 @@ VonMisesFisherGaussPeakShape::VonMisesFisherGaussPeakShape(double max_intensity,
                                                            double kappa_2)
     : m_max_intensity(max_intensity), m_radial_size(radial_size), m_zenith(zenith.unit()),
       m_kappa_1(kappa_1), m_kappa_2(kappa_2)
-{
-    mP_integrator
-        = make_integrator_real(this, &VonMisesFisherGaussPeakShape::integrand);
-}
+{}
 
 VonMisesFisherGaussPeakShape::~VonMisesFisherGaussPeakShape() = default;
 
@@ -166,42 +163,38 @@ double VonMisesFisherGaussPeakShape::evaluate(const kvector_t q,
     double norm_factor = m_radial_size / std::sqrt(M_TWOPI);
     double radial_part = norm_factor * std::exp(-dq2 * m_radial_size * m_radial_size / 2.0);
     // angular part
-    m_uy = m_zenith.cross(q_lattice_point);
+    kvector_t uy = m_zenith.cross(q_lattice_point);
     kvector_t zxq = m_zenith.cross(q);
-    m_up = q_lattice_point.unit();
-    if (m_uy.mag2() <= 0.0 || zxq.mag2() <= 0.0) {
-        double x = q.unit().dot(m_up);
+    kvector_t up = q_lattice_point.unit();
+    if (uy.mag2() <= 0.0 || zxq.mag2() <= 0.0) {
+        double x = q.unit().dot(up);
         double angular_part = FisherDistribution(x, m_kappa_1);
         return m_max_intensity * radial_part * angular_part;
     }
-    m_uy = m_uy.unit();
-    m_ux = m_uy.cross(m_zenith);
+    uy = uy.unit();
+    kvector_t ux = uy.cross(m_zenith);
     kvector_t q_ortho = q - q.dot(m_zenith) * m_zenith;
-    m_phi = std::acos(q_ortho.unit().dot(m_ux));
-    m_theta = std::acos(q.unit().dot(m_zenith));
+    double phi_q = std::acos(q_ortho.unit().dot(ux));
+    double theta_q = std::acos(q.unit().dot(m_zenith));
     double pre_1 = FisherPrefactor(m_kappa_1);
     double pre_2 = VonMisesPrefactor(m_kappa_2);
-    double integral = mP_integrator->integrate(0.0, M_TWOPI);
+    auto integrand = [&](double phi) {
+        kvector_t u_q = std::sin(theta_q) * std::cos(phi) * ux
+                      + std::sin(theta_q) * std::sin(phi) * uy
+                      + std::cos(theta_q) * m_zenith;
+        double fisher = std::exp(m_kappa_1*(u_q.dot(up) - 1.0));
+        double vonmises = std::exp(m_kappa_2*(std::cos(phi_q - phi) - 1.0));
+        return fisher * vonmises;
+    };
+    double integral = integrate_real(integrand, 0.0, M_TWOPI);
     return m_max_intensity * radial_part * pre_1 * pre_2 * integral;
 }
 
-double VonMisesFisherGaussPeakShape::integrand(double phi) const
-{
-    kvector_t u_q = std::sin(m_theta) * std::cos(phi) * m_ux
-                  + std::sin(m_theta) * std::sin(phi) * m_uy
-                  + std::cos(m_theta) * m_zenith;
-    double fisher = std::exp(m_kappa_1*(u_q.dot(m_up) - 1.0));
-    double vonmises = std::exp(m_kappa_2*(std::cos(m_phi - phi) - 1.0));
-    return fisher * vonmises;
-}
-
 VonMisesGaussPeakShape::VonMisesGaussPeakShape(double max_intensity, double radial_size,
                                                kvector_t zenith, double kappa)
     : m_max_intensity(max_intensity), m_radial_size(radial_size), m_zenith(zenith.unit())
     , m_kappa(kappa)
-{
-    mP_integrator = make_integrator_real(this, &VonMisesGaussPeakShape::integrand);
-}
+{}
 
 VonMisesGaussPeakShape::~VonMisesGaussPeakShape() = default;
 
@@ -212,35 +205,32 @@ VonMisesGaussPeakShape *VonMisesGaussPeakShape::clone() const
 
 double VonMisesGaussPeakShape::evaluate(const kvector_t q, const kvector_t q_lattice_point) const
 {
-    m_uy = m_zenith.cross(q_lattice_point);
+    kvector_t uy = m_zenith.cross(q_lattice_point);
     kvector_t zxq = m_zenith.cross(q);
-    if (m_uy.mag2() <= 0.0 || zxq.mag2() <= 0.0) {
+    if (uy.mag2() <= 0.0 || zxq.mag2() <= 0.0) {
         double dq2 = (q - q_lattice_point).mag2();
         return m_max_intensity * Gauss3D(dq2, m_radial_size);
     }
-    m_qr = q.mag();
-    m_p = q_lattice_point;
-    m_uy = m_uy.unit();
-    m_ux = m_uy.cross(m_zenith);
+    double q_r = q.mag();
+    uy = uy.unit();
+    kvector_t ux = uy.cross(m_zenith);
     kvector_t q_ortho = q - q.dot(m_zenith) * m_zenith;
-    m_phi = std::acos(q_ortho.unit().dot(m_ux));
-    m_theta = std::acos(q.unit().dot(m_zenith));
+    double phi_q = std::acos(q_ortho.unit().dot(ux));
+    double theta_q = std::acos(q.unit().dot(m_zenith));
     double pre = VonMisesPrefactor(m_kappa);
-    double integral = mP_integrator->integrate(0.0, M_TWOPI);
+    auto integrand = [&](double phi) {
+        kvector_t q_rot = q_r * (std::sin(theta_q) * std::cos(phi) * ux
+                               + std::sin(theta_q) * std::sin(phi) * uy
+                               + std::cos(theta_q) * m_zenith);
+        double dq2 = (q_rot - q_lattice_point).mag2();
+        double gauss = Gauss3D(dq2, m_radial_size);
+        double vonmises = std::exp(m_kappa*(std::cos(phi_q - phi) - 1.0));
+        return gauss * vonmises;
+    };
+    double integral = integrate_real(integrand, 0.0, M_TWOPI);
     return m_max_intensity * pre * integral;
 }
 
-double VonMisesGaussPeakShape::integrand(double phi) const
-{
-    kvector_t q_rot = m_qr * (std::sin(m_theta) * std::cos(phi) * m_ux
-                            + std::sin(m_theta) * std::sin(phi) * m_uy
-                            + std::cos(m_theta) * m_zenith);
-    double dq2 = (q_rot - m_p).mag2();
-    double gauss = Gauss3D(dq2, m_radial_size);
-    double vonmises = std::exp(m_kappa*(std::cos(m_phi - phi) - 1.0));
-    return gauss * vonmises;
-}
-
 
 namespace
 {
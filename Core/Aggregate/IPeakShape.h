@@ -18,8 +18,6 @@
 #include "ISample.h"
 #include "Vectors3D.h"
 
-template <class T> class IntegratorReal;
-
 //! Pure virtual interface class that defines the peak shape of a Bragg peak.
 //!
 //! @ingroup samples_internal
@@ -151,16 +149,10 @@ public:
 
     bool angularDisorder() const override { return true; }
 private:
-    double integrand(double phi) const;
     double m_max_intensity;
     double m_radial_size;
     kvector_t m_zenith;
     double m_kappa_1, m_kappa_2;
-    mutable double m_theta, m_phi;
-    mutable kvector_t m_ux, m_uy, m_up;
-#ifndef SWIG
-    std::unique_ptr<IntegratorReal<VonMisesFisherGaussPeakShape>> mP_integrator;
-#endif
 };
 
 //! Class that implements a peak shape that is a convolution of a von Mises-Fisher distribution
@@ -183,16 +175,10 @@ public:
 
     bool angularDisorder() const override { return true; }
 private:
-    double integrand(double phi) const;
     double m_max_intensity;
     double m_radial_size;
     kvector_t m_zenith;
     double m_kappa;
-    mutable double m_theta, m_phi, m_qr;
-    mutable kvector_t m_ux, m_uy, m_p;
-#ifndef SWIG
-    std::unique_ptr<IntegratorReal<VonMisesGaussPeakShape>> mP_integrator;
-#endif
 };
 
 
@@ -31,10 +31,11 @@ static const int min_points = 4;
 
 InterferenceFunction2DLattice::InterferenceFunction2DLattice(const Lattice2D& lattice)
     : m_integrate_xi(false)
+    , m_na(0), m_nb(0)
+    , m_kernel(DecayKernel::Generic)
 {
     setName(BornAgain::InterferenceFunction2DLatticeType);
     setLattice(lattice);
-    init_parameters();
 }
 
 //! Constructor of two-dimensional interference function.
@@ -46,10 +47,10 @@ InterferenceFunction2DLattice::InterferenceFunction2DLattice(double length_1, do
                                                              double alpha, double xi)
     : m_integrate_xi(false)
     , m_na(0), m_nb(0)
+    , m_kernel(DecayKernel::Generic)
 {
     setName(BornAgain::InterferenceFunction2DLatticeType);
     setLattice(BasicLattice(length_1, length_2, alpha, xi));
-    init_parameters();
 }
 
 InterferenceFunction2DLattice::~InterferenceFunction2DLattice()
@@ -124,16 +125,17 @@ double InterferenceFunction2DLattice::iff_without_dw(const kvector_t q) const
     if (!m_decay)
         throw Exceptions::NullPointerException("InterferenceFunction2DLattice::evaluate"
                                                " -> Error! No decay function defined.");
-    m_qx = q.x();
-    m_qy = q.y();
     if (!m_integrate_xi)
-        return interferenceForXi(m_lattice->rotationAngle());
-    return mP_integrator->integrate(0.0, M_TWOPI) / M_TWOPI;
+        return interferenceForXi(m_lattice->rotationAngle(), q.x(), q.y());
+    return integrate_real([&](double xi) { return interferenceForXi(xi, q.x(), q.y()); }, 0.0,
+                          M_TWOPI) / M_TWOPI;
 }
 
 InterferenceFunction2DLattice::InterferenceFunction2DLattice(
         const InterferenceFunction2DLattice& other)
     : IInterferenceFunction(other)
+    , m_na(0), m_nb(0)
+    , m_kernel(DecayKernel::Generic)
 {
     setName(other.getName());
     if(other.m_lattice)
@@ -141,7 +143,6 @@ InterferenceFunction2DLattice::InterferenceFunction2DLattice(
     if(other.m_decay)
         setDecayFunction(*other.m_decay);
     setIntegrationOverXi(other.integrationOverXi());
-    init_parameters();
 }
 
 void InterferenceFunction2DLattice::setLattice(const Lattice2D& lattice)
@@ -151,45 +152,46 @@ void InterferenceFunction2DLattice::setLattice(const Lattice2D& lattice)
     initialize_rec_vectors();
 }
 
-void InterferenceFunction2DLattice::init_parameters()
-{
-    mP_integrator
-        = make_integrator_real(this, &InterferenceFunction2DLattice::interferenceForXi);
-}
 
-double InterferenceFunction2DLattice::interferenceForXi(double xi) const
+double InterferenceFunction2DLattice::interferenceForXi(double xi, double qx, double qy) const
 {
-    double result = 0.0;
-    auto q_frac = calculateReciprocalVectorFraction(m_qx, m_qy, xi);
+    auto q_frac = calculateReciprocalVectorFraction(qx, qy, xi);
+    const double px = m_decay_xx * q_frac.first + m_decay_xy * q_frac.second;
+    const double py = m_decay_yx * q_frac.first + m_decay_yy * q_frac.second;
 
-    for (int i = -m_na - 1; i < m_na + 2; ++i) {
-        for (int j = -m_nb - 1; j < m_nb + 2; ++j) {
-            double qx = q_frac.first + i * m_sbase.m_asx + j * m_sbase.m_bsx;
-            double qy = q_frac.second + i * m_sbase.m_asy + j * m_sbase.m_bsy;
-            result += interferenceAtOneRecLatticePoint(qx, qy);
+    const size_t n = m_offsets_x.size();
+    const double* offsets_x = m_offsets_x.data();
+    const double* offsets_y = m_offsets_y.data();
+    double result = 0.0;
+    switch (m_kernel) {
+    case DecayKernel::Cauchy:
+        for (size_t i = 0; i < n; ++i) {
+            double x = px + offsets_x[i], y = py + offsets_y[i];
+            double t = 1.0 + x * x + y * y;
+            result += 1.0 / (t * std::sqrt(t));
+        }
+        break;
+    case DecayKernel::Gauss:
+        for (size_t i = 0; i < n; ++i) {
+            double x = px + offsets_x[i], y = py + offsets_y[i];
+            result += std::exp(-(x * x + y * y) / 2.0);
         }
+        break;
+    case DecayKernel::Voigt:
+        for (size_t i = 0; i < n; ++i) {
+            double x = px + offsets_x[i], y = py + offsets_y[i];
+            double sum_sq = x * x + y * y;
+            double t = 1.0 + sum_sq;
+            result += m_eta * std::exp(-sum_sq / 2.0) + (1.0 - m_eta) / (t * std::sqrt(t));
+        }
+        break;
+    case DecayKernel::Generic:
+        for (size_t i = 0; i < n; ++i)
+            result += m_decay->evaluate((px + offsets_x[i]) / m_decay->decayLengthX(),
+                                        (py + offsets_y[i]) / m_decay->decayLengthY());
+        break;
     }
-    return getParticleDensity()*result;
-}
-
-double InterferenceFunction2DLattice::interferenceAtOneRecLatticePoint(double qx, double qy) const
-{
-    if (!m_decay)
-        throw Exceptions::NullPointerException(
-            "InterferenceFunction2DLattice::interferenceAtOneRecLatticePoint"
-            " -> Error! No decay function defined.");
-    double gamma = m_decay->gamma();
-    auto qXY = rotateOrthonormal(qx, qy, gamma);
-    return m_decay->evaluate(qXY.first, qXY.second);
-}
-
-// Rotate by angle gamma between orthonormal systems
-std::pair<double, double>
-InterferenceFunction2DLattice::rotateOrthonormal(double qx, double qy, double gamma) const
-{
-    double q_X = qx * std::cos(gamma) + qy * std::sin(gamma);
-    double q_Y = -qx * std::sin(gamma) + qy * std::cos(gamma);
-    return {q_X, q_Y};
+    return getParticleDensity() * m_kernel_prefactor * result;
 }
 
 // (qx, qy) are in the global reciprocal reference frame
@@ -243,4 +245,37 @@ void InterferenceFunction2DLattice::initialize_calc_factors()
     m_nb = static_cast<int>(std::lround(q_bounds.second + 0.5));
     m_na = std::max(m_na, min_points);
     m_nb = std::max(m_nb, min_points);
+
+    const double length_x = m_decay->decayLengthX();
+    const double length_y = m_decay->decayLengthY();
+    m_kernel_prefactor = M_TWOPI * length_x * length_y;
+    m_eta = 0.0;
+    if (dynamic_cast<const FTDecayFunction2DCauchy*>(m_decay.get())) {
+        m_kernel = DecayKernel::Cauchy;
+    } else if (dynamic_cast<const FTDecayFunction2DGauss*>(m_decay.get())) {
+        m_kernel = DecayKernel::Gauss;
+    } else if (auto p_voigt = dynamic_cast<const FTDecayFunction2DVoigt*>(m_decay.get())) {
+        m_kernel = DecayKernel::Voigt;
+        m_eta = p_voigt->eta();
+    } else {
+        m_kernel = DecayKernel::Generic;
+        m_kernel_prefactor = 1.0;
+    }
+
+    const double gamma = m_decay->gamma();
+    m_decay_xx = length_x * std::cos(gamma);
+    m_decay_xy = length_x * std::sin(gamma);
+    m_decay_yx = -length_y * std::sin(gamma);
+    m_decay_yy = length_y * std::cos(gamma);
+
+    m_offsets_x.clear();
+    m_offsets_y.clear();
+    for (int i = -m_na - 1; i < m_na + 2; ++i) {
+        for (int j = -m_nb - 1; j < m_nb + 2; ++j) {
+            double qx = i * m_sbase.m_asx + j * m_sbase.m_bsx;
+            double qy = i * m_sbase.m_asy + j * m_sbase.m_bsy;
+            m_offsets_x.push_back(m_decay_xx * qx + m_decay_xy * qy);
+            m_offsets_y.push_back(m_decay_yx * qx + m_decay_yy * qy);
+        }
+    }
 }
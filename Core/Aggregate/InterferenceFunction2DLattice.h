@@ -19,8 +19,6 @@
 #include "FTDecayFunctions.h"
 #include "Lattice2D.h"
 
-template <class T> class IntegratorReal;
-
 //! Interference function of a 2D lattice.
 //! @ingroup interference
 
@@ -57,14 +55,7 @@ private:
     InterferenceFunction2DLattice(const InterferenceFunction2DLattice& other);
     void setLattice(const Lattice2D& lattice);
 
-    void init_parameters();
-    double interferenceForXi(double xi) const;
-
-    //! Returns interference from a single reciprocal lattice vector
-    double interferenceAtOneRecLatticePoint(double qx, double qy) const;
-
-    //! Returns reciprocal coordinates in the coordinate system rotated by the angle gamma
-    std::pair<double, double> rotateOrthonormal(double qx, double qy, double gamma) const;
+    double interferenceForXi(double xi, double qx, double qy) const;
 
     //! Returns qx,qy coordinates of q - qint, where qint is a reciprocal lattice vector
     //! bounding the reciprocal unit cell to which q belongs
@@ -74,19 +65,27 @@ private:
     //! Initializes the x,y coordinates of the a*,b* reciprocal bases
     void initialize_rec_vectors();
 
-    //! Initializes factors needed in each calculation
+    //! Initializes factors needed in each calculation, and the table of reciprocal lattice
+    //! offsets
     void initialize_calc_factors();
 
+    //! Decay functions with an inlined evaluation
+    enum class DecayKernel { Cauchy, Gauss, Voigt, Generic };
+
     bool m_integrate_xi; //!< Integrate over the orientation xi
     std::unique_ptr<IFTDecayFunction2D> m_decay;
     std::unique_ptr<Lattice2D> m_lattice;
     Lattice2D::ReciprocalBases m_sbase;  //!< reciprocal lattice is stored without xi
     int m_na, m_nb; //!< determines the number of reciprocal lattice points to use
-    mutable double m_qx;
-    mutable double m_qy;
-#ifndef SWIG
-    std::unique_ptr<IntegratorReal<InterferenceFunction2DLattice>> mP_integrator;
-#endif
+
+    DecayKernel m_kernel;
+    double m_kernel_prefactor;
+    double m_eta; //!< weight of the Gaussian in the Voigt kernel
+    //! Matrix that rotates q into the frame of the decay function and scales it by the decay
+    //! lengths, such that the decay function depends on the squared norm of the result
+    double m_decay_xx, m_decay_xy, m_decay_yx, m_decay_yy;
+    //! Reciprocal lattice vectors of the summed neighbourhood, in the same frame and scale
+    std::vector<double> m_offsets_x, m_offsets_y;
 };
 
 #endif // INTERFERENCEFUNCTION2DLATTICE_H
@@ -93,11 +93,10 @@ std::vector<const INode*> InterferenceFunction2DParaCrystal::getChildren() const
 
 double InterferenceFunction2DParaCrystal::iff_without_dw(const kvector_t q) const
 {
-    m_qx = q.x();
-    m_qy = q.y();
     if (!m_integrate_xi)
-        return interferenceForXi(m_lattice->rotationAngle());
-    return mP_integrator->integrate(0.0, M_TWOPI) / M_TWOPI;
+        return interferenceForXi(m_lattice->rotationAngle(), q.x(), q.y());
+    return integrate_real([&](double xi) { return interferenceForXi(xi, q.x(), q.y()); }, 0.0,
+                          M_TWOPI) / M_TWOPI;
 }
 
 InterferenceFunction2DParaCrystal::InterferenceFunction2DParaCrystal(
@@ -173,9 +172,6 @@ void InterferenceFunction2DParaCrystal::transformToPrincipalAxes(double qx, doub
 
 void InterferenceFunction2DParaCrystal::init_parameters()
 {
-    mP_integrator
-        = make_integrator_real(this, &InterferenceFunction2DParaCrystal::interferenceForXi);
-
     registerParameter(BornAgain::DampingLength, &m_damping_length).setUnit(BornAgain::UnitsNm)
         .setNonnegative();
     registerParameter(BornAgain::DomainSize1, &m_domain_sizes[0]).setUnit(BornAgain::UnitsNm)
@@ -185,10 +181,10 @@ void InterferenceFunction2DParaCrystal::init_parameters()
 }
 
 //! Returns interference function for fixed angle xi.
-double InterferenceFunction2DParaCrystal::interferenceForXi(double xi) const
+double InterferenceFunction2DParaCrystal::interferenceForXi(double xi, double qx, double qy) const
 {
-    double result = interference1D(m_qx, m_qy, xi, 0)
-                    * interference1D(m_qx, m_qy, xi + m_lattice->latticeAngle(), 1);
+    double result = interference1D(qx, qy, xi, 0)
+                    * interference1D(qx, qy, xi + m_lattice->latticeAngle(), 1);
     return result;
 }
 
@@ -21,7 +21,6 @@
 #include "Lattice2D.h"
 #include <memory>
 
-template <class T> class IntegratorReal;
 class IFTDistribution2D;
 
 //! Interference function of a 2D paracrystal.
@@ -87,7 +86,7 @@ private:
     void setLattice(const Lattice2D& lattice);
 
     void init_parameters();
-    double interferenceForXi(double xi) const;
+    double interferenceForXi(double xi, double qx, double qy) const;
     double interference1D(double qx, double qy, double xi, size_t index) const;
     complex_t FTPDF(double qx, double qy, double xi, size_t index) const;
     void transformToPrincipalAxes(double qx, double qy, double gamma, double delta, double& q_pa_1,
@@ -98,11 +97,6 @@ private:
     std::unique_ptr<Lattice2D> m_lattice;
     double m_damping_length; //!< Damping length for removing delta function singularity at q=0.
     double m_domain_sizes[2]; //!< Coherence domain sizes
-    mutable double m_qx;
-    mutable double m_qy;
-#ifndef SWIG
-    std::unique_ptr<IntegratorReal<InterferenceFunction2DParaCrystal>> mP_integrator;
-#endif
 };
 
 #endif // INTERFERENCEFUNCTION2DPARACRYSTAL_H
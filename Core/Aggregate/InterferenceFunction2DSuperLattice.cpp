@@ -36,7 +36,6 @@ InterferenceFunction2DSuperLattice::InterferenceFunction2DSuperLattice(
     setName(BornAgain::InterferenceFunction2DSuperLattice);
     setLattice(lattice);
     setSubstructureIFF(InterferenceFunctionNone());
-    init_parameters();
 }
 
 //! Constructor of two-dimensional interference function.
@@ -54,7 +53,6 @@ InterferenceFunction2DSuperLattice::InterferenceFunction2DSuperLattice(
     setName(BornAgain::InterferenceFunction2DSuperLattice);
     setLattice(BasicLattice(length_1, length_2, alpha, xi));
     setSubstructureIFF(InterferenceFunctionNone());
-    init_parameters();
 }
 
 InterferenceFunction2DSuperLattice::~InterferenceFunction2DSuperLattice() =default;
@@ -97,12 +95,11 @@ InterferenceFunction2DSuperLattice* InterferenceFunction2DSuperLattice::createHe
 
 double InterferenceFunction2DSuperLattice::evaluate(const kvector_t q, double outer_iff) const
 {
-    m_outer_iff = outer_iff;
-    m_qx = q.x();
-    m_qy = q.y();
     if (!m_integrate_xi)
-        return interferenceForXi(mP_lattice->rotationAngle());
-    return mP_integrator->integrate(0.0, M_TWOPI) / M_TWOPI;
+        return interferenceForXi(mP_lattice->rotationAngle(), q.x(), q.y(), outer_iff);
+    return integrate_real(
+               [&](double xi) { return interferenceForXi(xi, q.x(), q.y(), outer_iff); }, 0.0,
+               M_TWOPI) / M_TWOPI;
 }
 
 void InterferenceFunction2DSuperLattice::setIntegrationOverXi(bool integrate_xi)
@@ -125,12 +122,17 @@ std::vector<const INode*> InterferenceFunction2DSuperLattice::getChildren() cons
 }
 
 double InterferenceFunction2DSuperLattice::iff_without_dw(const kvector_t q) const
+{
+    return iffWithoutDWForXi(q, mP_lattice->rotationAngle());
+}
+
+double InterferenceFunction2DSuperLattice::iffWithoutDWForXi(const kvector_t q, double xi) const
 {
     double a = mP_lattice->length1();
     double b = mP_lattice->length2();
-    double xialpha = m_xi + mP_lattice->latticeAngle();
+    double xialpha = xi + mP_lattice->latticeAngle();
 
-    double qadiv2 = (q.x()*a*std::cos(m_xi) + q.y()*a*std::sin(m_xi)) / 2.0;
+    double qadiv2 = (q.x()*a*std::cos(xi) + q.y()*a*std::sin(xi)) / 2.0;
     double qbdiv2 = (q.x()*b*std::cos(xialpha) + q.y()*b*std::sin(xialpha)) / 2.0;
     double ampl = Laue(qadiv2, m_size_1)*Laue(qbdiv2, m_size_2);
     return ampl*ampl / (m_size_1*m_size_2);
@@ -147,7 +149,6 @@ InterferenceFunction2DSuperLattice::InterferenceFunction2DSuperLattice(
         setLattice(*other.mP_lattice);
     setSubstructureIFF(*other.mP_substructure);
     setIntegrationOverXi(other.integrationOverXi());
-    init_parameters();
 }
 
 void InterferenceFunction2DSuperLattice::setLattice(const Lattice2D& lattice)
@@ -156,17 +157,12 @@ void InterferenceFunction2DSuperLattice::setLattice(const Lattice2D& lattice)
     registerChild(mP_lattice.get());
 }
 
-void InterferenceFunction2DSuperLattice::init_parameters()
-{
-    mP_integrator
-        = make_integrator_real(this, &InterferenceFunction2DSuperLattice::interferenceForXi);
-}
 
-double InterferenceFunction2DSuperLattice::interferenceForXi(double xi) const
+double InterferenceFunction2DSuperLattice::interferenceForXi(double xi, double qx, double qy,
+                                                             double outer_iff) const
 {
-    m_xi = xi;
-    kvector_t q = kvector_t(m_qx, m_qy, 0.0);
-    double outer_iff = iff_no_inner(q, m_outer_iff);
+    kvector_t q = kvector_t(qx, qy, 0.0);
+    outer_iff = DWfactor(q)*(iffWithoutDWForXi(q, xi)*outer_iff - 1.0) + 1.0;
 
     double delta_xi = xi - mP_lattice->rotationAngle();
     q = q.rotatedZ(-delta_xi);
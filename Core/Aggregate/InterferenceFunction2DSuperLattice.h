@@ -18,8 +18,6 @@
 #include "IInterferenceFunction.h"
 #include "Lattice2D.h"
 
-template <class T> class IntegratorReal;
-
 //! Interference function of a 2D superlattice with a configurable interference function for
 //! each lattice site.
 //! @ingroup interference
@@ -60,20 +58,13 @@ private:
     InterferenceFunction2DSuperLattice(const InterferenceFunction2DSuperLattice& other);
     void setLattice(const Lattice2D& lattice);
 
-    void init_parameters();
-    double interferenceForXi(double xi) const;
+    double iffWithoutDWForXi(const kvector_t q, double xi) const;
+    double interferenceForXi(double xi, double qx, double qy, double outer_iff) const;
 
     bool m_integrate_xi; //!< Integrate over the orientation xi
     std::unique_ptr<Lattice2D> mP_lattice;
     std::unique_ptr<IInterferenceFunction> mP_substructure;  //!< IFF of substructure
     unsigned m_size_1, m_size_2;  //!< Size of the finite lattice in lattice units
-    mutable double m_outer_iff;
-    mutable double m_qx;
-    mutable double m_qy;
-    mutable double m_xi;
-#ifndef SWIG
-    std::unique_ptr<IntegratorReal<InterferenceFunction2DSuperLattice>> mP_integrator;
-#endif
 };
 
 #endif // INTERFERENCEFUNCTION2DSUPERLATTICE_H
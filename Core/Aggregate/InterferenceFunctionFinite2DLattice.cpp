@@ -15,12 +15,12 @@
 #include "InterferenceFunctionFinite2DLattice.h"
 #include "BornAgainNamespace.h"
 #include "Exceptions.h"
-#include "IntegratorReal.h"
 #include "Macros.h"
 #include "MathConstants.h"
 #include "MathFunctions.h"
 #include "RealParameter.h"
 
+#include <cmath>
 #include <limits>
 
 using MathFunctions::Laue;
@@ -38,7 +38,6 @@ InterferenceFunctionFinite2DLattice::InterferenceFunctionFinite2DLattice(
 {
     setName(BornAgain::InterferenceFunctionFinite2DLatticeType);
     setLattice(lattice);
-    init_parameters();
 }
 
 //! Constructor of two-dimensional finite lattice interference function.
@@ -56,7 +55,6 @@ InterferenceFunctionFinite2DLattice::InterferenceFunctionFinite2DLattice(
 {
     setName(BornAgain::InterferenceFunctionFinite2DLatticeType);
     setLattice(BasicLattice(length_1, length_2, alpha, xi));
-    init_parameters();
 }
 
 InterferenceFunctionFinite2DLattice::~InterferenceFunctionFinite2DLattice() =default;
@@ -117,11 +115,22 @@ std::vector<const INode*> InterferenceFunctionFinite2DLattice::getChildren() con
 
 double InterferenceFunctionFinite2DLattice::iff_without_dw(const kvector_t q) const
 {
-    m_qx = q.x();
-    m_qy = q.y();
     if (!m_integrate_xi)
-        return interferenceForXi(mP_lattice->rotationAngle());
-    return mP_integrator->integrate(0.0, M_TWOPI) / M_TWOPI;
+        return interferenceForXi(mP_lattice->rotationAngle(), q.x(), q.y());
+    // The integrand has period pi in xi. Expanding the squared Laue functions into Fejer
+    // sums, it is a sum of terms exp(i*|q|*|m*a + n*b|*cos(xi - xi_0)), whose Fourier
+    // coefficients decay faster than exponentially beyond the order
+    // |q|*((N_1-1)*a + (N_2-1)*b). The midpoint rule over one period integrates all lower
+    // orders exactly, so that it converges exponentially in the number of nodes.
+    const double order = std::sqrt(q.x() * q.x() + q.y() * q.y())
+                         * ((m_N_1 - 1.0) * mP_lattice->length1()
+                            + (m_N_2 - 1.0) * mP_lattice->length2());
+    const size_t n_nodes = 10 + static_cast<size_t>((order + std::cbrt(order)) / 2.0);
+    const double step = M_PI / n_nodes;
+    double result = 0.0;
+    for (size_t i = 0; i < n_nodes; ++i)
+        result += interferenceForXi((i + 0.5) * step, q.x(), q.y());
+    return result / n_nodes;
 }
 
 InterferenceFunctionFinite2DLattice::InterferenceFunctionFinite2DLattice(
@@ -134,7 +143,6 @@ InterferenceFunctionFinite2DLattice::InterferenceFunctionFinite2DLattice(
     if(other.mP_lattice)
         setLattice(*other.mP_lattice);
     setIntegrationOverXi(other.integrationOverXi());
-    init_parameters();
 }
 
 void InterferenceFunctionFinite2DLattice::setLattice(const Lattice2D& lattice)
@@ -143,20 +151,15 @@ void InterferenceFunctionFinite2DLattice::setLattice(const Lattice2D& lattice)
     registerChild(mP_lattice.get());
 }
 
-void InterferenceFunctionFinite2DLattice::init_parameters()
-{
-    mP_integrator
-        = make_integrator_real(this, &InterferenceFunctionFinite2DLattice::interferenceForXi);
-}
 
-double InterferenceFunctionFinite2DLattice::interferenceForXi(double xi) const
+double InterferenceFunctionFinite2DLattice::interferenceForXi(double xi, double qx, double qy) const
 {
     double a = mP_lattice->length1();
     double b = mP_lattice->length2();
     double xialpha = xi + mP_lattice->latticeAngle();
 
-    double qadiv2 = (m_qx*a*std::cos(xi) + m_qy*a*std::sin(xi)) / 2.0;
-    double qbdiv2 = (m_qx*b*std::cos(xialpha) + m_qy*b*std::sin(xialpha)) / 2.0;
+    double qadiv2 = (qx*a*std::cos(xi) + qy*a*std::sin(xi)) / 2.0;
+    double qbdiv2 = (qx*b*std::cos(xialpha) + qy*b*std::sin(xialpha)) / 2.0;
     double ampl = Laue(qadiv2, m_N_1)*Laue(qbdiv2, m_N_2);
     double lattice_factor = ampl*ampl / (m_N_1*m_N_2);
 
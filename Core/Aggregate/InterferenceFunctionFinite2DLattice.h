@@ -18,8 +18,6 @@
 #include "IInterferenceFunction.h"
 #include "Lattice2D.h"
 
-template <class T> class IntegratorReal;
-
 //! Interference function of a finite 2D lattice.
 //! @ingroup interference
 
@@ -58,17 +56,11 @@ private:
     InterferenceFunctionFinite2DLattice(const InterferenceFunctionFinite2DLattice& other);
     void setLattice(const Lattice2D& lattice);
 
-    void init_parameters();
-    double interferenceForXi(double xi) const;
+    double interferenceForXi(double xi, double qx, double qy) const;
 
     bool m_integrate_xi; //!< Integrate over the orientation xi
     std::unique_ptr<Lattice2D> mP_lattice;
     unsigned m_N_1, m_N_2;  //!< Size of the finite lattice in lattice units
-    mutable double m_qx;
-    mutable double m_qy;
-#ifndef SWIG
-    std::unique_ptr<IntegratorReal<InterferenceFunctionFinite2DLattice>> mP_integrator;
-#endif
 };
 
 #endif // INTERFERENCEFUNCTIONFINITE2DLATTICE_H
@@ -65,19 +65,18 @@ double InterferenceFunctionHardDisk::iff_without_dw(const kvector_t q) const
 {
     double qx = q.x();
     double qy = q.y();
-    m_q = 2.0*std::sqrt(qx*qx+qy*qy)*m_radius;
-    m_packing = packingRatio();
-    m_c_zero = Czero(m_packing);
-    m_s2 = S2(m_packing);
-    double c_q = 2.0*M_PI*mP_integrator->integrate(0.0, 1.0);
-    double rho = 4.0*m_packing/M_PI;
+    double q_r = 2.0*std::sqrt(qx*qx+qy*qy)*m_radius;
+    double packing = packingRatio();
+    double c_zero = Czero(packing);
+    double s2 = S2(packing);
+    double c_q = 2.0*M_PI*integrate_real(
+                     [&](double x) { return integrand(x, q_r, packing, c_zero, s2); }, 0.0, 1.0);
+    double rho = 4.0*packing/M_PI;
     return 1.0/(1.0 - rho*c_q);
 }
 
 void InterferenceFunctionHardDisk::init_parameters()
 {
-    mP_integrator =
-            make_integrator_real(this, &InterferenceFunctionHardDisk::integrand);
     registerParameter(BornAgain::Radius, &m_radius).setUnit(BornAgain::UnitsNm).setNonnegative();
     registerParameter(BornAgain::TotalParticleDensity, &m_density).setUnit(BornAgain::UnitsNm)
             .setNonnegative();
@@ -96,10 +95,11 @@ double InterferenceFunctionHardDisk::packingRatio() const
     return M_PI*m_radius*m_radius*m_density;
 }
 
-double InterferenceFunctionHardDisk::integrand(double x) const
+double InterferenceFunctionHardDisk::integrand(double x, double q, double packing,
+                                              double c_zero, double s2) const
 {
-    double cx = m_c_zero*(1.0 + 4.0*m_packing*(W2(x/2.0) - 1.0) + m_s2*x);
-    return x * cx * MathFunctions::Bessel_J0(m_q*x);
+    double cx = c_zero*(1.0 + 4.0*packing*(W2(x/2.0) - 1.0) + s2*x);
+    return x * cx * MathFunctions::Bessel_J0(q*x);
 }
 
 namespace {
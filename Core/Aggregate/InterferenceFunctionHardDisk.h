@@ -17,8 +17,6 @@
 
 #include "IInterferenceFunction.h"
 
-template <class T> class IntegratorReal;
-
 //! Percus-Yevick hard disk interference function.
 //!
 //! M.S. Ripoll & C.F. Tejero (1995) Approximate analytical expression for the direct correlation
@@ -46,13 +44,9 @@ private:
     void init_parameters();
     void validateParameters() const;
     double packingRatio() const;
-    double integrand(double x) const;
+    double integrand(double x, double q, double packing, double c_zero, double s2) const;
     double m_radius;
     double m_density;
-    mutable double m_q, m_c_zero, m_s2, m_packing;
-#ifndef SWIG
-    std::unique_ptr<IntegratorReal<InterferenceFunctionHardDisk>> mP_integrator;
-#endif
 };
 
 #endif // INTERFERENCEFUNCTIONHARDDISK_H
@@ -98,16 +98,25 @@ void ParticleLayout::addParticle(const IAbstractParticle& particle, double abund
 SafePointerVector<IParticle> ParticleLayout::particles() const
 {
     SafePointerVector<IParticle> particle_vector;
+    for (const auto& group : particleGroups())
+        for (const IParticle* particle : group)
+            particle_vector.push_back(particle->clone());
+    return particle_vector;
+}
+
+std::vector<SafePointerVector<IParticle>> ParticleLayout::particleGroups() const
+{
+    std::vector<SafePointerVector<IParticle>> result;
+    result.reserve(m_particles.size());
     for (auto particle: m_particles) {
         if (const auto* p_part_distr = dynamic_cast<const ParticleDistribution*>(particle)) {
-            SafePointerVector<IParticle> generated_particles = p_part_distr->generateParticles();
-            for (const IParticle* particle: generated_particles)
-                particle_vector.push_back(particle->clone());
+            result.push_back(p_part_distr->generateParticles());
         } else if (const auto* p_iparticle = dynamic_cast<const IParticle*>(particle)) {
-            particle_vector.push_back(p_iparticle->clone());
+            result.emplace_back();
+            result.back().push_back(p_iparticle->clone());
         }
     }
-    return particle_vector;
+    return result;
 }
 
 const IInterferenceFunction *ParticleLayout::interferenceFunction() const
@@ -44,6 +44,10 @@ public:
 
     SafePointerVector<IParticle> particles() const final override;
 
+#ifndef SWIG
+    std::vector<SafePointerVector<IParticle>> particleGroups() const final override;
+#endif
+
     const IInterferenceFunction* interferenceFunction() const final override;
 
     double getTotalAbundance() const final override;
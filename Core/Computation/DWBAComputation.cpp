@@ -28,11 +28,12 @@ static_assert(std::is_copy_constructible<DWBAComputation>::value == false,
 static_assert(std::is_copy_assignable<DWBAComputation>::value == false,
               "DWBAComputation should not be copy assignable");
 
-DWBAComputation::DWBAComputation(const MultiLayer& multilayer, const SimulationOptions& options,
-                                 ProgressHandler& progress,
+DWBAComputation::DWBAComputation(std::shared_ptr<const ProcessedSample> p_sample,
+                                 const SimulationOptions& options, ProgressHandler& progress,
                                  std::vector<SimulationElement>::iterator begin_it,
                                  std::vector<SimulationElement>::iterator end_it)
-    : IComputation(multilayer, options, progress), m_begin_it(begin_it), m_end_it(end_it)
+    : IComputation(std::move(p_sample), options, progress), m_begin_it(begin_it),
+      m_end_it(end_it)
 {
     auto p_fresnel_map = mP_processed_sample->fresnelMap();
     bool polarized = mP_processed_sample->containsMagneticMaterial();
@@ -60,9 +61,11 @@ void DWBAComputation::runProtected()
     if (!mp_progress->alive())
         return;
     m_single_computation.setProgressHandler(mp_progress);
+    mP_processed_sample->fresnelMap()->precomputeCoefficients(m_begin_it, m_end_it);
     for (auto it = m_begin_it; it != m_end_it; ++it) {
         if (!mp_progress->alive())
             break;
         m_single_computation.compute(*it);
     }
+    m_single_computation.flushProgress();
 }
@@ -31,8 +31,8 @@ class SimulationElement;
 class DWBAComputation : public IComputation
 {
 public:
-    DWBAComputation(const MultiLayer& multilayer, const SimulationOptions& options,
-                    ProgressHandler& progress,
+    DWBAComputation(std::shared_ptr<const ProcessedSample> p_sample,
+                    const SimulationOptions& options, ProgressHandler& progress,
                     std::vector<SimulationElement>::iterator begin_it,
                     std::vector<SimulationElement>::iterator end_it);
     ~DWBAComputation() override;
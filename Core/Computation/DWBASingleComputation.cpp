@@ -15,6 +15,7 @@
 #include "DWBASingleComputation.h"
 #include "DelayedProgressCounter.h"
 #include "GISASSpecularComputation.h"
+#include "Instrumentation.h"
 #include "ParticleLayoutComputation.h"
 #include "RoughMultiLayerComputation.h"
 
@@ -30,6 +31,12 @@ void DWBASingleComputation::setProgressHandler(ProgressHandler* p_progress)
     mP_progress_counter.reset(new DelayedProgressCounter(p_progress, 100));
 }
 
+void DWBASingleComputation::flushProgress()
+{
+    if (mP_progress_counter)
+        mP_progress_counter->flush();
+}
+
 void DWBASingleComputation::addLayoutComputation(ParticleLayoutComputation* p_layout_comp)
 {
     m_layout_comps.emplace_back(p_layout_comp);
@@ -48,6 +55,7 @@ void DWBASingleComputation::setSpecularBinComputation(GISASSpecularComputation*
 
 void DWBASingleComputation::compute(SimulationElement& elem) const
 {
+    BA_INSTRUMENT_COUNT(SimulationElements, 1);
     for (auto& layout_comp : m_layout_comps) {
         layout_comp->compute(elem);
     }
@@ -43,6 +43,9 @@ public:
 
     void setProgressHandler(ProgressHandler* p_progress);
 
+    //! Reports the progress that is still pending at the end of the computation
+    void flushProgress();
+
     void addLayoutComputation(ParticleLayoutComputation* p_layout_comp);
     void setRoughnessComputation(RoughMultiLayerComputation* p_roughness_comp);
     void setSpecularBinComputation(GISASSpecularComputation* p_spec_comp);
@@ -29,3 +29,12 @@ void DelayedProgressCounter::stepProgress()
         m_count = 0;
     }
 }
+
+void DelayedProgressCounter::flush()
+{
+    if (m_count > 0) {
+        const size_t count = m_count;
+        m_count = 0;
+        mp_progress->incrementDone(count);
+    }
+}
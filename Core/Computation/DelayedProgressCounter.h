@@ -20,15 +20,19 @@
 class ProgressHandler;
 
 //! Counter for reporting progress (with delay interval) in a threaded computation.
+//! The steps since the last report have to be reported by flush() at the end of the
+//! computation; they are not reported at destruction, where the subscriber must not be called.
 
 class DelayedProgressCounter
 {
 public:
     DelayedProgressCounter(ProgressHandler* p_progress, size_t interval);
-    ~DelayedProgressCounter() {}
 
     //! Increments inner counter; at regular intervals updates progress handler.
     void stepProgress();
+
+    //! Updates progress handler with the steps that are not yet reported.
+    void flush();
 private:
     ProgressHandler* mp_progress;
     const size_t m_interval;
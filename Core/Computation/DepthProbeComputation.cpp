@@ -22,12 +22,12 @@ static_assert(std::is_copy_constructible<DepthProbeComputation>::value == false,
 static_assert(std::is_copy_assignable<DepthProbeComputation>::value == false,
               "DepthProbeComputation should not be copy assignable");
 
-DepthProbeComputation::DepthProbeComputation(const MultiLayer& multilayer,
+DepthProbeComputation::DepthProbeComputation(std::shared_ptr<const ProcessedSample> p_sample,
                                              const SimulationOptions& options,
                                              ProgressHandler& progress,
                                              DepthProbeElementIter begin_it,
                                              DepthProbeElementIter end_it)
-    : IComputation(multilayer, options, progress)
+    : IComputation(std::move(p_sample), options, progress)
     , m_begin_it(begin_it), m_end_it(end_it)
     , m_computation_term(mP_processed_sample.get())
 {
@@ -43,4 +43,5 @@ void DepthProbeComputation::runProtected()
     for (auto it=m_begin_it; it != m_end_it; ++it) {
         m_computation_term.compute(*it);
     }
+    m_computation_term.flushProgress();
 }
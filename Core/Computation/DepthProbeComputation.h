@@ -31,8 +31,9 @@ class DepthProbeComputation : public IComputation
 {
     using DepthProbeElementIter = std::vector<DepthProbeElement>::iterator;
 public:
-    DepthProbeComputation(const MultiLayer& multilayer, const SimulationOptions& options,
-                          ProgressHandler& progress, DepthProbeElementIter begin_it,
+    DepthProbeComputation(std::shared_ptr<const ProcessedSample> p_sample,
+                          const SimulationOptions& options, ProgressHandler& progress,
+                          DepthProbeElementIter begin_it,
                           DepthProbeElementIter end_it);
     ~DepthProbeComputation() override;
 
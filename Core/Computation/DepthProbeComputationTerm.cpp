@@ -31,6 +31,12 @@ void DepthProbeComputationTerm::setProgressHandler(ProgressHandler* p_progress)
     mP_progress_counter.reset(new DelayedProgressCounter(p_progress, 100));
 }
 
+void DepthProbeComputationTerm::flushProgress()
+{
+    if (mP_progress_counter)
+        mP_progress_counter->flush();
+}
+
 void DepthProbeComputationTerm::compute(DepthProbeElement& elem) const
 {
     if (elem.isCalculated()) {
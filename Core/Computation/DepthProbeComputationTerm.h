@@ -30,6 +30,9 @@ public:
 
     void setProgressHandler(ProgressHandler* p_progress);
 
+    //! Reports the progress that is still pending at the end of the computation
+    void flushProgress();
+
     void compute(DepthProbeElement& elem) const;
 
 private:
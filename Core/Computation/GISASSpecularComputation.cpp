@@ -15,6 +15,7 @@
 #include "GISASSpecularComputation.h"
 #include "IFresnelMap.h"
 #include "ILayerRTCoefficients.h"
+#include "Instrumentation.h"
 #include "SimulationElement.h"
 
 GISASSpecularComputation::GISASSpecularComputation(const IFresnelMap* p_fresnel_map)
@@ -24,6 +25,7 @@ GISASSpecularComputation::GISASSpecularComputation(const IFresnelMap* p_fresnel_
 
 void GISASSpecularComputation::compute(SimulationElement& elem) const
 {
+    BA_INSTRUMENT_SCOPE(SpecularPeak);
     try {
         if (elem.isSpecular()) {
             complex_t R = mp_fresnel_map->getInCoefficients(elem, 0)->getScalarR();
@@ -13,16 +13,15 @@
 // ************************************************************************** //
 
 #include "IComputation.h"
-#include "MultiLayer.h"
 #include "ProcessedSample.h"
 #include "ProgressHandler.h"
 #include "SimulationElement.h"
 
-IComputation::IComputation(const MultiLayer& sample, const SimulationOptions& options,
-                           ProgressHandler& progress)
+IComputation::IComputation(std::shared_ptr<const ProcessedSample> p_sample,
+                           const SimulationOptions& options, ProgressHandler& progress)
     : m_sim_options(options),
       mp_progress(&progress),
-      mP_processed_sample(std::make_unique<ProcessedSample>(sample, options))
+      mP_processed_sample(std::move(p_sample))
 {}
 
 IComputation::~IComputation() = default;
@@ -20,12 +20,12 @@
 #include <memory>
 #include <vector>
 
-class MultiLayer;
 class ProcessedSample;
 class ProgressHandler;
 
 //! Interface for a single-threaded computation with given range of SimulationElements
-//! and ProgressHandler.
+//! and ProgressHandler. The ProcessedSample is shared read-only by all computations of
+//! a simulation.
 //!
 //! Controlled by the multi-threading machinery in Simulation::runSingleSimulation().
 //!
@@ -34,8 +34,8 @@ class ProgressHandler;
 class IComputation
 {
 public:
-    IComputation(const MultiLayer& sample, const SimulationOptions& options,
-                 ProgressHandler& progress);
+    IComputation(std::shared_ptr<const ProcessedSample> p_sample,
+                 const SimulationOptions& options, ProgressHandler& progress);
     virtual ~IComputation();
 
     void run();
@@ -47,7 +47,7 @@ protected:
     SimulationOptions m_sim_options;
     ProgressHandler* mp_progress;
     ComputationStatus m_status;
-    std::unique_ptr<ProcessedSample> mP_processed_sample;
+    std::shared_ptr<const ProcessedSample> mP_processed_sample;
 
 private:
     virtual void runProtected() = 0;
@@ -0,0 +1,259 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Computation/MirrorSymmetry.cpp
+//! @brief     Implements namespace MirrorSymmetry.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "MirrorSymmetry.h"
+#include "BornAgainNamespace.h"
+#include "FTDecayFunctions.h"
+#include "FTDistributions2D.h"
+#include "IFormFactor.h"
+#include "ILayout.h"
+#include "InterferenceFunctions.h"
+#include "Layer.h"
+#include "MathConstants.h"
+#include "MultiLayer.h"
+#include "Particle.h"
+#include "Rotations.h"
+#include "SimulationElement.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <tuple>
+
+namespace
+{
+const double angle_tolerance = 1e-10;
+const double key_resolution = 1e-8; // quantization of pixel centers, much finer than any pixel
+
+bool IsMultipleOfRightAngle(double angle);
+bool IsSymmetricRotation(const IRotation& rotation);
+bool IsSymmetricFormFactor(const IFormFactor& form_factor);
+bool IsSymmetricParticle(const IParticle& particle);
+bool HasInvariantDirections(const Lattice2D& lattice);
+bool IsSymmetricDecay(const IFTDecayFunction2D* p_decay, double xi);
+bool IsSymmetricPdf(const IFTDistribution2D* p_pdf, double direction);
+bool IsSymmetricInterference(const IInterferenceFunction& interference);
+bool AreMirrorImages(const SimulationElement& element, const SimulationElement& image);
+}
+
+bool MirrorSymmetry::IsSymmetric(const MultiLayer& multilayer)
+{
+    for (size_t i = 0; i < multilayer.numberOfLayers(); ++i) {
+        const Layer* p_layer = multilayer.layer(i);
+        if (p_layer->material()->isMagneticMaterial())
+            return false;
+        for (auto p_layout : p_layer->layouts()) {
+            for (auto p_particle : p_layout->particles())
+                if (!IsSymmetricParticle(*p_particle))
+                    return false;
+            if (auto p_iff = p_layout->interferenceFunction())
+                if (!IsSymmetricInterference(*p_iff))
+                    return false;
+        }
+    }
+    return true;
+}
+
+std::vector<size_t> MirrorSymmetry::Partners(const std::vector<SimulationElement>& elements)
+{
+    // pixel centers are looked up separately for each incident beam (e.g. off-specular scans)
+    using key_t = std::tuple<long long, long long, long long>;
+    auto quantize = [](const SimulationElement& element, double phi) {
+        return key_t(std::llround(element.getAlphaI() / key_resolution),
+                     std::llround(element.getAlphaMean() / key_resolution),
+                     std::llround(phi / key_resolution));
+    };
+    std::map<key_t, size_t> centers;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (std::abs(elements[i].getPhiI()) > angle_tolerance)
+            return {};
+        centers.emplace(quantize(elements[i], elements[i].getPhiMean()), i);
+    }
+
+    std::vector<size_t> result(elements.size());
+    bool found = false;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        result[i] = i;
+        const key_t key = quantize(elements[i], -elements[i].getPhiMean());
+        // neighbouring keys catch values that are rounded to different sides
+        for (long long da = -1; da <= 1 && result[i] == i; ++da) {
+            for (long long dp = -1; dp <= 1; ++dp) {
+                auto it = centers.find(key_t(std::get<0>(key), std::get<1>(key) + da,
+                                             std::get<2>(key) + dp));
+                if (it != centers.end() && it->second != i
+                    && AreMirrorImages(elements[i], elements[it->second])) {
+                    result[i] = it->second;
+                    found = true;
+                    break;
+                }
+            }
+        }
+    }
+    if (!found)
+        return {};
+    return result;
+}
+
+namespace
+{
+bool IsMultipleOfRightAngle(double angle)
+{
+    const double ratio = angle / M_PI_2;
+    return std::abs(ratio - std::round(ratio)) < angle_tolerance;
+}
+
+//! A rotation R commutes with the mirror operation iff it maps the xz-plane onto itself.
+bool IsSymmetricRotation(const IRotation& rotation)
+{
+    const Transform3D transform = rotation.getTransform3D();
+    const kvector_t ex = transform.transformed(kvector_t(1.0, 0.0, 0.0));
+    const kvector_t ey = transform.transformed(kvector_t(0.0, 1.0, 0.0));
+    const kvector_t ez = transform.transformed(kvector_t(0.0, 0.0, 1.0));
+    return std::abs(ex.y()) < angle_tolerance && std::abs(ez.y()) < angle_tolerance
+           && std::abs(ey.x()) < angle_tolerance && std::abs(ey.z()) < angle_tolerance;
+}
+
+//! Returns true for form factors whose shape is invariant under y -> -y in the particle frame.
+bool IsSymmetricFormFactor(const IFormFactor& form_factor)
+{
+    static const std::set<std::string> symmetric_shapes = {
+        BornAgain::FFAnisoPyramidType,
+        BornAgain::FFBoxType,
+        BornAgain::FFConeType,
+        BornAgain::FFCone6Type,
+        BornAgain::FFCuboctahedronType,
+        BornAgain::FFCylinderType,
+        BornAgain::FFDebyeBuecheType,
+        BornAgain::FFDotType,
+        BornAgain::FFEllipsoidalCylinderType,
+        BornAgain::FFFullSphereType,
+        BornAgain::FFFullSpheroidType,
+        BornAgain::FFGaussType,
+        BornAgain::FFHemiEllipsoidType,
+        BornAgain::FFLongBoxGaussType,
+        BornAgain::FFLongBoxLorentzType,
+        BornAgain::FFLorentzType,
+        BornAgain::FFOrnsteinZernikeType,
+        BornAgain::FFPrism3Type,
+        BornAgain::FFPrism6Type,
+        BornAgain::FFPyramidType,
+        BornAgain::FFRipple1Type,
+        BornAgain::FFLongRipple1GaussType,
+        BornAgain::FFLongRipple1LorentzType,
+        BornAgain::FFTetrahedronType,
+        BornAgain::FFTruncatedCubeType,
+        BornAgain::FFTruncatedSphereType,
+        BornAgain::FFTruncatedSpheroidType,
+        BornAgain::FormFactorSphereGaussianRadiusType,
+        BornAgain::FormFactorSphereLogNormalRadiusType,
+        BornAgain::FormFactorSphereUniformRadiusType};
+    return symmetric_shapes.find(form_factor.getName()) != symmetric_shapes.end();
+}
+
+bool IsSymmetricParticle(const IParticle& particle)
+{
+    if (particle.position().y() != 0.0)
+        return false;
+    if (auto p_particle = dynamic_cast<const Particle*>(&particle))
+        if (p_particle->material()->isMagneticMaterial())
+            return false;
+    for (auto p_child : particle.getChildren()) {
+        if (auto p_rotation = dynamic_cast<const IRotation*>(p_child)) {
+            if (!IsSymmetricRotation(*p_rotation))
+                return false;
+        } else if (auto p_subparticle = dynamic_cast<const IParticle*>(p_child)) {
+            if (!IsSymmetricParticle(*p_subparticle))
+                return false;
+        } else if (auto p_form_factor = dynamic_cast<const IFormFactor*>(p_child)) {
+            if (!IsSymmetricFormFactor(*p_form_factor))
+                return false;
+        } else {
+            return false; // e.g. the crystal of a mesocrystal
+        }
+    }
+    return true;
+}
+
+//! Returns true if both lattice directions are mapped onto themselves by the mirror operation.
+bool HasInvariantDirections(const Lattice2D& lattice)
+{
+    const double xi = lattice.rotationAngle();
+    return IsMultipleOfRightAngle(xi) && IsMultipleOfRightAngle(xi + lattice.latticeAngle());
+}
+
+//! Decay functions are even in both of their principal coordinates.
+bool IsSymmetricDecay(const IFTDecayFunction2D* p_decay, double xi)
+{
+    return p_decay
+           && (p_decay->decayLengthX() == p_decay->decayLengthY()
+               || IsMultipleOfRightAngle(xi + p_decay->gamma()));
+}
+
+bool IsSymmetricPdf(const IFTDistribution2D* p_pdf, double direction)
+{
+    return p_pdf
+           && (p_pdf->omegaX() == p_pdf->omegaY()
+               || (IsMultipleOfRightAngle(direction + p_pdf->gamma())
+                   && IsMultipleOfRightAngle(p_pdf->delta())));
+}
+
+bool IsSymmetricInterference(const IInterferenceFunction& interference)
+{
+    if (dynamic_cast<const InterferenceFunctionNone*>(&interference)
+        || dynamic_cast<const InterferenceFunctionHardDisk*>(&interference)
+        || dynamic_cast<const InterferenceFunctionRadialParaCrystal*>(&interference))
+        return true;
+    if (auto p_iff = dynamic_cast<const InterferenceFunction1DLattice*>(&interference))
+        return IsMultipleOfRightAngle(p_iff->getLatticeParameters().m_xi);
+    if (auto p_iff = dynamic_cast<const InterferenceFunction2DLattice*>(&interference)) {
+        if (p_iff->integrationOverXi())
+            return true;
+        const IFTDecayFunction2D* p_decay = nullptr;
+        for (auto p_child : p_iff->getChildren())
+            if (auto p_candidate = dynamic_cast<const IFTDecayFunction2D*>(p_child))
+                p_decay = p_candidate;
+        const Lattice2D& lattice = p_iff->lattice();
+        return HasInvariantDirections(lattice)
+               && IsSymmetricDecay(p_decay, lattice.rotationAngle());
+    }
+    if (auto p_iff = dynamic_cast<const InterferenceFunction2DParaCrystal*>(&interference)) {
+        if (p_iff->integrationOverXi())
+            return true;
+        const Lattice2D& lattice = p_iff->lattice();
+        const double xi = lattice.rotationAngle();
+        return HasInvariantDirections(lattice) && IsSymmetricPdf(p_iff->pdf1(), xi)
+               && IsSymmetricPdf(p_iff->pdf2(), xi + lattice.latticeAngle());
+    }
+    if (auto p_iff = dynamic_cast<const InterferenceFunctionFinite2DLattice*>(&interference))
+        return p_iff->integrationOverXi() || HasInvariantDirections(p_iff->lattice());
+    return false;
+}
+
+//! Returns true if the pixel of image is the mirror image of the pixel of element.
+bool AreMirrorImages(const SimulationElement& element, const SimulationElement& image)
+{
+    if (element.getAlphaI() != image.getAlphaI()
+        || element.getWavelength() != image.getWavelength()
+        || element.isSpecular() != image.isSpecular())
+        return false;
+    for (double x : {0.0, 1.0}) {
+        for (double y : {0.0, 1.0}) {
+            if (std::abs(element.getAlpha(x, y) - image.getAlpha(1.0 - x, y)) > angle_tolerance
+                || std::abs(element.getPhi(x, y) + image.getPhi(1.0 - x, y)) > angle_tolerance)
+                return false;
+        }
+    }
+    return true;
+}
+}
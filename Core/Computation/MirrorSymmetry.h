@@ -0,0 +1,44 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Computation/MirrorSymmetry.h
+//! @brief     Defines namespace MirrorSymmetry.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef MIRRORSYMMETRY_H
+#define MIRRORSYMMETRY_H
+
+#include "WinDllMacros.h"
+#include <cstddef>
+#include <vector>
+
+class MultiLayer;
+class SimulationElement;
+
+//! Utilities to exploit the mirror symmetry y -> -y of a scattering geometry.
+//!
+//! If the incoming beam lies in the xz-plane (phi_i = 0) and the sample is invariant under the
+//! mirror operation y -> -y, the intensities at (alpha_f, phi_f) and (alpha_f, -phi_f) coincide.
+
+namespace MirrorSymmetry
+{
+//! Returns true if the sample is invariant under y -> -y.
+//! The check is conservative: any sample component that is not known to be symmetric
+//! (magnetic materials, general rotations, unsupported form factors or interference
+//! functions, ...) breaks the symmetry.
+BA_CORE_API_ bool IsSymmetric(const MultiLayer& multilayer);
+
+//! Returns for each simulation element the index of its mirror image (alpha_f, -phi_f), or the
+//! element's own index if there is none. Returns an empty vector if the beam azimuth is not zero
+//! or no mirror pairs were found.
+BA_CORE_API_ std::vector<size_t> Partners(const std::vector<SimulationElement>& elements);
+} // namespace MirrorSymmetry
+
+#endif // MIRRORSYMMETRY_H
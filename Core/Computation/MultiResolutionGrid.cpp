@@ -0,0 +1,218 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Computation/MultiResolutionGrid.cpp
+//! @brief     Implements class MultiResolutionGrid.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "MultiResolutionGrid.h"
+#include "IDetector.h"
+#include "SimulationElement.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+MultiResolutionGrid::MultiResolutionGrid(const IDetector& detector, size_t step)
+    : m_step(step), m_nx(0), m_ny(0), m_ncx(0), m_ncy(0)
+{
+    if (detector.dimension() != 2 || m_step < 2)
+        return;
+
+    detector.iterate([&](IDetector::const_iterator it) {
+        assert(it.elementIndex() == m_x.size());
+        m_x.push_back(detector.axisBinIndex(it.detectorIndex(), 0));
+        m_y.push_back(detector.axisBinIndex(it.detectorIndex(), 1));
+    });
+    if (m_x.empty())
+        return;
+
+    const auto x_range = std::minmax_element(m_x.begin(), m_x.end());
+    const auto y_range = std::minmax_element(m_y.begin(), m_y.end());
+    const size_t x_min = *x_range.first;
+    const size_t y_min = *y_range.first;
+    m_nx = *x_range.second - x_min + 1;
+    m_ny = *y_range.second - y_min + 1;
+    m_ncx = (m_nx + m_step - 2) / m_step;
+    m_ncy = (m_ny + m_step - 2) / m_step;
+
+    m_grid.resize(m_nx * m_ny, -1);
+    m_status.resize(m_x.size(), Status::UNDEFINED);
+    for (size_t i = 0; i < m_x.size(); ++i) {
+        m_x[i] -= x_min;
+        m_y[i] -= y_min;
+        m_grid[m_x[i] * m_ny + m_y[i]] = static_cast<long>(i);
+        if (nodeCoordinate(m_x[i], m_nx) == m_x[i] && nodeCoordinate(m_y[i], m_ny) == m_y[i])
+            m_status[i] = Status::NODE;
+    }
+
+    // cells with missing corners (masked or outside of region of interest) are computed exactly
+    m_cell_error.resize(m_ncx * m_ncy, 0.0);
+    for (size_t cx = 0; cx < m_ncx; ++cx) {
+        for (size_t cy = 0; cy < m_ncy; ++cy) {
+            const size_t xa = cx * m_step, xb = std::min(xa + m_step, m_nx - 1);
+            const size_t ya = cy * m_step, yb = std::min(ya + m_step, m_ny - 1);
+            if (elementAt(xa, ya) < 0 || elementAt(xa, yb) < 0 || elementAt(xb, ya) < 0
+                || elementAt(xb, yb) < 0)
+                m_cell_error[cx * m_ncy + cy] = -1.0;
+        }
+    }
+    for (size_t i = 0; i < m_status.size(); ++i)
+        if (m_status[i] == Status::UNDEFINED && m_cell_error[cellIndex(m_x[i], m_y[i])] < 0.0)
+            m_status[i] = Status::EXACT;
+}
+
+bool MultiResolutionGrid::isValid(size_t n_elements) const
+{
+    // curvature estimates need at least three nodes along each axis
+    return m_ncx > 1 && m_ncy > 1 && n_elements == m_status.size();
+}
+
+std::vector<size_t> MultiResolutionGrid::coarseElements() const
+{
+    std::vector<size_t> result;
+    for (size_t i = 0; i < m_status.size(); ++i)
+        if (m_status[i] == Status::NODE || m_status[i] == Status::EXACT)
+            result.push_back(i);
+    return result;
+}
+
+std::vector<size_t> MultiResolutionGrid::refine(const std::vector<SimulationElement>& elements,
+                                                double threshold, double alpha_c)
+{
+    assert(elements.size() == m_status.size());
+    const auto curvature_x = nodeCurvature(elements, true);
+    const auto curvature_y = nodeCurvature(elements, false);
+
+    for (size_t cx = 0; cx < m_ncx; ++cx) {
+        for (size_t cy = 0; cy < m_ncy; ++cy) {
+            double& cell_error = m_cell_error[cx * m_ncy + cy];
+            if (cell_error < 0.0)
+                continue;
+            const size_t xa = cx * m_step, xb = std::min(xa + m_step, m_nx - 1);
+            const size_t ya = cy * m_step, yb = std::min(ya + m_step, m_ny - 1);
+            const size_t corners[4] = {xa * m_ny + ya, xa * m_ny + yb, xb * m_ny + ya,
+                                       xb * m_ny + yb};
+            double scale = 0.0, max_fxx = 0.0, max_fyy = 0.0;
+            double alpha_min = std::numeric_limits<double>::max();
+            double alpha_max = std::numeric_limits<double>::lowest();
+            for (size_t corner : corners) {
+                const auto& element = elements[static_cast<size_t>(m_grid[corner])];
+                scale += std::abs(element.getIntensity()) / 4.0;
+                max_fxx = std::max(max_fxx, curvature_x[corner]);
+                max_fyy = std::max(max_fyy, curvature_y[corner]);
+                alpha_min = std::min(alpha_min, element.getAlpha(0.0, 0.0));
+                alpha_max = std::max(alpha_max, element.getAlpha(1.0, 1.0));
+            }
+            // error bound of linear interpolation: |f''| h^2 / 8 along each axis
+            const double hx = static_cast<double>(xb - xa), hy = static_cast<double>(yb - ya);
+            const double abs_error = (max_fxx * hx * hx + max_fyy * hy * hy) / 8.0;
+            if (scale > 0.0)
+                cell_error = abs_error / scale;
+            else
+                cell_error = abs_error > 0.0 ? std::numeric_limits<double>::infinity() : 0.0;
+            const bool yoneda =
+                alpha_c > 0.0 && std::min(alpha_min, alpha_max) <= alpha_c
+                && alpha_c <= std::max(alpha_min, alpha_max);
+            if (cell_error > threshold || yoneda)
+                cell_error = -1.0;
+        }
+    }
+
+    std::vector<size_t> result;
+    for (size_t i = 0; i < m_status.size(); ++i) {
+        if (m_status[i] != Status::UNDEFINED && m_status[i] != Status::INTERPOLATED)
+            continue;
+        if (elements[i].isSpecular() || m_cell_error[cellIndex(m_x[i], m_y[i])] < 0.0) {
+            m_status[i] = Status::EXACT;
+            result.push_back(i);
+        } else {
+            m_status[i] = Status::INTERPOLATED;
+        }
+    }
+    return result;
+}
+
+void MultiResolutionGrid::interpolate(std::vector<SimulationElement>& elements,
+                                      std::vector<double>& errors) const
+{
+    assert(elements.size() == m_status.size());
+    errors.assign(elements.size(), 0.0);
+    for (size_t i = 0; i < m_status.size(); ++i) {
+        if (m_status[i] != Status::INTERPOLATED)
+            continue;
+        const size_t cx = std::min(m_x[i] / m_step, m_ncx - 1);
+        const size_t cy = std::min(m_y[i] / m_step, m_ncy - 1);
+        const size_t xa = cx * m_step, xb = std::min(xa + m_step, m_nx - 1);
+        const size_t ya = cy * m_step, yb = std::min(ya + m_step, m_ny - 1);
+        const double tx = static_cast<double>(m_x[i] - xa) / static_cast<double>(xb - xa);
+        const double ty = static_cast<double>(m_y[i] - ya) / static_cast<double>(yb - ya);
+        auto value = [&](size_t ix, size_t iy) {
+            return elements[static_cast<size_t>(elementAt(ix, iy))].getIntensity();
+        };
+        elements[i].setIntensity((1.0 - tx) * (1.0 - ty) * value(xa, ya)
+                                 + (1.0 - tx) * ty * value(xa, yb) + tx * (1.0 - ty) * value(xb, ya)
+                                 + tx * ty * value(xb, yb));
+        errors[i] = m_cell_error[cx * m_ncy + cy];
+    }
+}
+
+size_t MultiResolutionGrid::numberOfInterpolatedElements() const
+{
+    return static_cast<size_t>(
+        std::count(m_status.begin(), m_status.end(), Status::INTERPOLATED));
+}
+
+//! Returns the node coordinate below the given box coordinate; the last channel is always a node.
+size_t MultiResolutionGrid::nodeCoordinate(size_t pos, size_t n) const
+{
+    return pos + 1 == n ? pos : (pos / m_step) * m_step;
+}
+
+size_t MultiResolutionGrid::cellIndex(size_t ix, size_t iy) const
+{
+    return std::min(ix / m_step, m_ncx - 1) * m_ncy + std::min(iy / m_step, m_ncy - 1);
+}
+
+long MultiResolutionGrid::elementAt(size_t ix, size_t iy) const
+{
+    return m_grid[ix * m_ny + iy];
+}
+
+//! Returns absolute second derivatives (in channel units) of the intensity at the nodes,
+//! estimated from divided differences of neighbouring nodes along the given axis.
+std::vector<double>
+MultiResolutionGrid::nodeCurvature(const std::vector<SimulationElement>& elements,
+                                   bool along_x) const
+{
+    std::vector<double> result(m_grid.size(), 0.0);
+    const size_t n = along_x ? m_nx : m_ny;
+    for (size_t i = 0; i < m_status.size(); ++i) {
+        if (m_status[i] != Status::NODE)
+            continue;
+        const size_t pos = along_x ? m_x[i] : m_y[i];
+        if (pos == 0 || pos + 1 == n)
+            continue;
+        const size_t prev = nodeCoordinate(pos - 1, n);
+        const size_t next = std::min(pos + m_step, n - 1);
+        const long i_prev = along_x ? elementAt(prev, m_y[i]) : elementAt(m_x[i], prev);
+        const long i_next = along_x ? elementAt(next, m_y[i]) : elementAt(m_x[i], next);
+        if (i_prev < 0 || i_next < 0)
+            continue;
+        const double f0 = elements[static_cast<size_t>(i_prev)].getIntensity();
+        const double f1 = elements[i].getIntensity();
+        const double f2 = elements[static_cast<size_t>(i_next)].getIntensity();
+        const double h0 = static_cast<double>(pos - prev);
+        const double h1 = static_cast<double>(next - pos);
+        result[m_x[i] * m_ny + m_y[i]] =
+            std::abs(2.0 * ((f2 - f1) / h1 - (f1 - f0) / h0) / (h0 + h1));
+    }
+    return result;
+}
@@ -0,0 +1,78 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Computation/MultiResolutionGrid.h
+//! @brief     Defines class MultiResolutionGrid.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef MULTIRESOLUTIONGRID_H
+#define MULTIRESOLUTIONGRID_H
+
+#include "WinDllMacros.h"
+#include <cstddef>
+#include <vector>
+
+class IDetector;
+class SimulationElement;
+
+//! Coarse-to-fine evaluation scheme for the simulation elements of a 2D detector.
+//!
+//! The detector channels are divided into cells, whose corners (the nodes) lie on every
+//! step-th channel along each axis. After the nodes are computed, the linear interpolation
+//! error of every cell is estimated from the second differences of the node intensities.
+//! Cells with a large relative error, cells spanning the critical angle of the substrate and
+//! the specular channel are computed exactly; all remaining channels are interpolated.
+//!
+//! @ingroup algorithms_internal
+
+class BA_CORE_API_ MultiResolutionGrid
+{
+public:
+    MultiResolutionGrid(const IDetector& detector, size_t step);
+
+    //! Returns true if the given number of simulation elements can be treated on a coarse grid
+    bool isValid(size_t n_elements) const;
+
+    //! Returns indices of the elements to be computed in the first (coarse) pass
+    std::vector<size_t> coarseElements() const;
+
+    //! Flags the cells that need exact computation, based on the node intensities.
+    //! Returns the indices of the elements to be computed in the second (fine) pass.
+    //! @param threshold Maximal tolerated relative interpolation error
+    //! @param alpha_c Critical angle of the sample; ignored if not positive
+    std::vector<size_t> refine(const std::vector<SimulationElement>& elements, double threshold,
+                               double alpha_c);
+
+    //! Sets the intensities of all elements that were not computed by bilinear interpolation
+    //! and stores the estimated relative interpolation error of each element in errors.
+    void interpolate(std::vector<SimulationElement>& elements, std::vector<double>& errors) const;
+
+    //! Returns the number of elements that are interpolated instead of computed
+    size_t numberOfInterpolatedElements() const;
+
+private:
+    enum class Status { UNDEFINED, NODE, EXACT, INTERPOLATED };
+
+    size_t nodeCoordinate(size_t pos, size_t n) const;
+    size_t cellIndex(size_t ix, size_t iy) const;
+    long elementAt(size_t ix, size_t iy) const;
+    std::vector<double> nodeCurvature(const std::vector<SimulationElement>& elements,
+                                      bool along_x) const;
+
+    size_t m_step;
+    size_t m_nx, m_ny;             //!< size of the bounding box of all elements
+    size_t m_ncx, m_ncy;           //!< number of cells along each axis
+    std::vector<long> m_grid;      //!< element index for each channel of the box, or -1
+    std::vector<size_t> m_x, m_y;  //!< box coordinates of each element
+    std::vector<Status> m_status;  //!< evaluation status of each element
+    std::vector<double> m_cell_error; //!< estimated relative error of each cell (-1: exact)
+};
+
+#endif // MULTIRESOLUTIONGRID_H
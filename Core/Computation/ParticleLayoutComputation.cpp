@@ -14,6 +14,7 @@
 
 #include "ParticleLayoutComputation.h"
 #include "IInterferenceFunctionStrategy.h"
+#include "Instrumentation.h"
 #include "LayoutStrategyBuilder.h"
 #include "ProcessedLayout.h"
 #include "SimulationElement.h"
@@ -32,6 +33,7 @@ ParticleLayoutComputation::~ParticleLayoutComputation() =default;
 
 void ParticleLayoutComputation::compute(SimulationElement& elem) const
 {
+    BA_INSTRUMENT_SCOPE(ParticleLayouts);
     double alpha_f = elem.getAlphaMean();
     size_t n_layers = mp_layout->numberOfSlices();
     if (n_layers > 1 && alpha_f < 0) {
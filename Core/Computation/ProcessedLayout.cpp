@@ -20,6 +20,7 @@
 #include "IInterferenceFunction.h"
 #include "ILayout.h"
 #include "IParticle.h"
+#include "ProcessedSampleCache.h"
 #include "Slice.h"
 #include "SlicedFormFactorList.h"
 
@@ -33,7 +34,18 @@ ProcessedLayout::ProcessedLayout(const ILayout& layout, const std::vector<Slice>
     : mp_fresnel_map(p_fresnel_map), m_polarized(polarized)
 {
     m_n_slices = slices.size();
-    collectFormFactors(layout, slices, z_ref);
+    collectFormFactors(layout, slices, z_ref, nullptr, std::string());
+    if (auto p_iff = layout.interferenceFunction())
+        mP_iff.reset(p_iff->clone());
+}
+
+ProcessedLayout::ProcessedLayout(const ILayout& layout, const std::vector<Slice>& slices,
+                                 double z_ref, const IFresnelMap* p_fresnel_map, bool polarized,
+                                 ProcessedSampleCache& cache, const std::string& key_prefix)
+    : mp_fresnel_map(p_fresnel_map), m_polarized(polarized)
+{
+    m_n_slices = slices.size();
+    collectFormFactors(layout, slices, z_ref, &cache, key_prefix);
     if (auto p_iff = layout.interferenceFunction())
         mP_iff.reset(p_iff->clone());
 }
@@ -45,6 +57,7 @@ ProcessedLayout::ProcessedLayout(ProcessedLayout&& other)
     m_n_slices = other.m_n_slices;
     m_surface_density = other.m_surface_density;
     m_formfactors = std::move(other.m_formfactors);
+    m_ff_group_sizes = std::move(other.m_ff_group_sizes);
     mP_iff = std::move(other.mP_iff);
     m_region_map = std::move(other.m_region_map);
 }
@@ -64,6 +77,11 @@ const std::vector<FormFactorCoherentSum>& ProcessedLayout::formFactorList() cons
     return m_formfactors;
 }
 
+const std::vector<size_t>& ProcessedLayout::formFactorGroupSizes() const
+{
+    return m_ff_group_sizes;
+}
+
 const IInterferenceFunction* ProcessedLayout::interferenceFunction() const
 {
     return mP_iff.get();
@@ -77,13 +95,22 @@ std::map<size_t, std::vector<HomogeneousRegion>> ProcessedLayout::regionMap() co
 ProcessedLayout::~ProcessedLayout() = default;
 
 void ProcessedLayout::collectFormFactors(const ILayout& layout, const std::vector<Slice>& slices,
-                                         double z_ref)
+                                         double z_ref, ProcessedSampleCache* p_cache,
+                                         const std::string& key_prefix)
 {
     double layout_abundance = layout.getTotalAbundance();
-    for (auto p_particle : layout.particles()) {
-        auto ff_coh = ProcessParticle(*p_particle, slices, z_ref);
-        ff_coh.scaleRelativeAbundance(layout_abundance);
-        m_formfactors.push_back(std::move(ff_coh));
+    // form factors with identical amplitudes get the same index, so that these are only
+    // evaluated once per simulation element
+    std::map<std::string, size_t> amplitude_indices;
+    for (const auto& group : layout.particleGroups()) {
+        for (auto p_particle : group) {
+            auto P_processed = processedParticle(*p_particle, slices, z_ref, p_cache, key_prefix);
+            mergeRegionMap(P_processed->region_map);
+            auto ff_coh = createCoherentSum(*P_processed, amplitude_indices);
+            ff_coh.scaleRelativeAbundance(layout_abundance);
+            m_formfactors.push_back(std::move(ff_coh));
+        }
+        m_ff_group_sizes.push_back(group.size());
     }
     double weight = layout.weight();
     m_surface_density = weight * layout.totalParticleSurfaceDensity();
@@ -91,16 +118,36 @@ void ProcessedLayout::collectFormFactors(const ILayout& layout, const std::vecto
     ScaleRegionMap(m_region_map, scale_factor);
 }
 
-FormFactorCoherentSum ProcessedLayout::ProcessParticle(const IParticle& particle,
-                                                       const std::vector<Slice>& slices,
-                                                       double z_ref)
+std::shared_ptr<const ProcessedParticle>
+ProcessedLayout::processedParticle(const IParticle& particle, const std::vector<Slice>& slices,
+                                   double z_ref, ProcessedSampleCache* p_cache,
+                                   const std::string& key_prefix) const
+{
+    std::string key;
+    if (p_cache) {
+        const std::string particle_key = ProcessedSampleCache::particleKey(particle);
+        if (!particle_key.empty()) {
+            key = key_prefix + particle_key;
+            if (auto P_result = p_cache->findParticle(key))
+                return P_result;
+        }
+    }
+    auto P_result = std::make_shared<const ProcessedParticle>(
+        ProcessParticle(particle, slices, z_ref));
+    if (key.empty())
+        return P_result;
+    return p_cache->insertParticle(key, std::move(P_result));
+}
+
+ProcessedParticle ProcessedLayout::ProcessParticle(const IParticle& particle,
+                                                   const std::vector<Slice>& slices,
+                                                   double z_ref) const
 {
-    double abundance = particle.abundance();
+    ProcessedParticle result;
+    result.abundance = particle.abundance();
     auto sliced_ffs = SlicedFormFactorList::CreateSlicedFormFactors(particle, slices, z_ref);
-    auto region_map = sliced_ffs.regionMap();
-    ScaleRegionMap(region_map, abundance);
-    mergeRegionMap(region_map);
-    auto result = FormFactorCoherentSum(abundance);
+    result.region_map = sliced_ffs.regionMap();
+    ScaleRegionMap(result.region_map, result.abundance);
     for (size_t i = 0; i < sliced_ffs.size(); ++i) {
         auto ff_pair = sliced_ffs[i];
         std::unique_ptr<IFormFactor> P_ff_framework;
@@ -120,9 +167,24 @@ FormFactorCoherentSum ProcessedLayout::ProcessParticle(const IParticle& particle
         const Material slice_material = slices[slice_index].material();
         P_ff_framework->setAmbientMaterial(slice_material);
 
-        auto part = FormFactorCoherentPart(P_ff_framework.release());
-        part.setSpecularInfo(mp_fresnel_map, slice_index);
+        result.parts.push_back({std::move(P_ff_framework), slice_index,
+                                sliced_ffs.lateralPosition(i), sliced_ffs.amplitudeKey(i)});
+    }
+    return result;
+}
 
+FormFactorCoherentSum
+ProcessedLayout::createCoherentSum(const ProcessedParticle& particle,
+                                   std::map<std::string, size_t>& amplitude_indices) const
+{
+    auto result = FormFactorCoherentSum(particle.abundance);
+    for (const auto& processed_part : particle.parts) {
+        auto part = FormFactorCoherentPart(processed_part.P_form_factor);
+        part.setSpecularInfo(mp_fresnel_map, processed_part.slice_index);
+        part.setLateralPosition(processed_part.lateral_position);
+        auto entry = amplitude_indices.emplace(processed_part.amplitude_key,
+                                               amplitude_indices.size());
+        part.setAmplitudeIndex(entry.first->second);
         result.addCoherentPart(part);
     }
     return result;
@@ -15,18 +15,42 @@
 #ifndef PROCESSEDLAYOUT_H
 #define PROCESSEDLAYOUT_H
 
+#include "HomogeneousRegion.h"
+#include "Vectors3D.h"
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 class FormFactorCoherentSum;
-struct HomogeneousRegion;
+class IFormFactor;
 class IFresnelMap;
 class IInterferenceFunction;
 class ILayout;
 class IParticle;
+class ProcessedSampleCache;
 class Slice;
 
+//! Sliced form factors of a particle in one layer of a layer stack, independent of the layout.
+//! Particles with identical content share them through the ProcessedSampleCache.
+//!
+//! @ingroup algorithms_internal
+
+struct ProcessedParticle {
+    //! Form factor of one slice of the particle, within the DWBA or BA framework and with the
+    //! ambient material of its slice
+    struct Part {
+        std::shared_ptr<const IFormFactor> P_form_factor;
+        size_t slice_index;
+        kvector_t lateral_position;
+        std::string amplitude_key; //!< equal for parts with identical amplitudes
+    };
+    double abundance;
+    std::vector<Part> parts;
+    //! Regions of the particle in the slices, scaled by its abundance
+    std::map<size_t, std::vector<HomogeneousRegion>> region_map;
+};
+
 //! Data structure that contains preprocessed data for a single layout.
 //!
 //! If particles in the layout crossed the limits of the layer slices, these particles will
@@ -39,24 +63,41 @@ class ProcessedLayout
 public:
     ProcessedLayout(const ILayout& layout, const std::vector<Slice>& slices, double z_ref,
                     const IFresnelMap* p_fresnel_map, bool polarized);
+    //! Takes the particles from the given cache if possible; the key prefix identifies the
+    //! layer stack and the layer
+    ProcessedLayout(const ILayout& layout, const std::vector<Slice>& slices, double z_ref,
+                    const IFresnelMap* p_fresnel_map, bool polarized,
+                    ProcessedSampleCache& cache, const std::string& key_prefix);
     ProcessedLayout(ProcessedLayout&& other);
     ~ProcessedLayout();
 
     size_t numberOfSlices() const;
     double surfaceDensity() const;
     const std::vector<FormFactorCoherentSum>& formFactorList() const;
+    //! Returns the sizes of consecutive groups in formFactorList(), each of which stems from
+    //! one particle type of the layout, e.g. from one particle distribution
+    const std::vector<size_t>& formFactorGroupSizes() const;
     const IInterferenceFunction* interferenceFunction() const;
     std::map<size_t, std::vector<HomogeneousRegion>> regionMap() const;
 
 private:
-    void collectFormFactors(const ILayout& layout, const std::vector<Slice>& slices, double z_ref);
-    FormFactorCoherentSum ProcessParticle(const IParticle& particle, const std::vector<Slice>& slices, double z_ref);
+    void collectFormFactors(const ILayout& layout, const std::vector<Slice>& slices, double z_ref,
+                            ProcessedSampleCache* p_cache, const std::string& key_prefix);
+    std::shared_ptr<const ProcessedParticle>
+    processedParticle(const IParticle& particle, const std::vector<Slice>& slices, double z_ref,
+                      ProcessedSampleCache* p_cache, const std::string& key_prefix) const;
+    ProcessedParticle ProcessParticle(const IParticle& particle,
+                                      const std::vector<Slice>& slices, double z_ref) const;
+    FormFactorCoherentSum
+    createCoherentSum(const ProcessedParticle& particle,
+                      std::map<std::string, size_t>& amplitude_indices) const;
     void mergeRegionMap(const std::map<size_t, std::vector<HomogeneousRegion>>& region_map);
     const IFresnelMap* mp_fresnel_map;
     bool m_polarized;
     size_t m_n_slices;
     double m_surface_density;
     std::vector<FormFactorCoherentSum> m_formfactors;
+    std::vector<size_t> m_ff_group_sizes;
     std::unique_ptr<IInterferenceFunction> mP_iff;
     std::map<size_t, std::vector<HomogeneousRegion>> m_region_map;
 };
@@ -21,6 +21,7 @@
 #include "MultiLayer.h"
 #include "MultiLayerUtils.h"
 #include "ProcessedLayout.h"
+#include "ProcessedSampleCache.h"
 #include "ScalarFresnelMap.h"
 #include "SimulationOptions.h"
 #include "Slice.h"
@@ -44,10 +45,41 @@ ProcessedSample::ProcessedSample(const MultiLayer& sample, const SimulationOptio
     initSlices(sample, options);
     mP_fresnel_map = CreateFresnelMap(m_slices, options);
     initBFields();
-    initLayouts(sample);
+    initLayouts(sample, nullptr, std::string());
     initFresnelMap(options);
 }
 
+//! If another simulation cached the same layer stack in the meantime, this sample keeps its own
+//! stack, to which its form factors refer.
+ProcessedSample::ProcessedSample(const MultiLayer& sample, const SimulationOptions& options,
+                                 ProcessedSampleCache& cache, double wavelength)
+    : m_slices{}, m_top_z{0.0}, m_polarized{false}, m_crossCorrLength{sample.crossCorrLength()},
+      m_ext_field{sample.externalField()}
+{
+    // samples that cannot be described are processed without the cache
+    const std::string stack_key = ProcessedSampleCache::stackKey(sample, options);
+    ProcessedSampleCache* p_cache = stack_key.empty() ? nullptr : &cache;
+    if (p_cache) {
+        if (auto P_stack = p_cache->findStack(stack_key, wavelength)) {
+            m_slices = P_stack->slices;
+            m_top_z = P_stack->top_z;
+            mP_fresnel_map = P_stack->P_fresnel_map;
+            initLayouts(sample, p_cache, stack_key);
+            return;
+        }
+    }
+    initSlices(sample, options);
+    mP_fresnel_map = CreateFresnelMap(m_slices, options);
+    initBFields();
+    initLayouts(sample, p_cache, stack_key);
+    initFresnelMap(options);
+    if (p_cache)
+        p_cache->insertStack(stack_key,
+                             std::make_shared<const ProcessedSampleCache::Stack>(
+                                 ProcessedSampleCache::Stack{m_slices, m_top_z, mP_fresnel_map}),
+                             wavelength);
+}
+
 ProcessedSample::~ProcessedSample() = default;
 
 size_t ProcessedSample::numberOfSlices() const
@@ -75,6 +107,11 @@ const IFresnelMap* ProcessedSample::fresnelMap() const
     return mP_fresnel_map.get();
 }
 
+void ProcessedSample::clearFresnelCache()
+{
+    mP_fresnel_map->clearCache();
+}
+
 double ProcessedSample::crossCorrelationLength() const
 {
     return m_crossCorrLength;
@@ -205,7 +242,9 @@ void ProcessedSample::initSlices(const MultiLayer& sample, const SimulationOptio
     }
 }
 
-void ProcessedSample::initLayouts(const MultiLayer& sample)
+//! With a cache, the particles are keyed by the layer stack, the layer and the polarization.
+void ProcessedSample::initLayouts(const MultiLayer& sample, ProcessedSampleCache* p_cache,
+                                  const std::string& stack_key)
 {
     double z_ref = -m_top_z;
     m_polarized = ContainsMagneticMaterial(sample);
@@ -214,7 +253,15 @@ void ProcessedSample::initLayouts(const MultiLayer& sample)
             z_ref -= MultiLayerUtils::LayerThickness(sample, i-1);
         auto p_layer = sample.layer(i);
         for (auto p_layout : p_layer->layouts()) {
-            m_layouts.emplace_back(*p_layout, m_slices, z_ref, mP_fresnel_map.get(), m_polarized);
+            if (p_cache) {
+                const std::string key_prefix =
+                    stack_key + std::to_string(i) + (m_polarized ? "p" : "s") + '\0';
+                m_layouts.emplace_back(*p_layout, m_slices, z_ref, mP_fresnel_map.get(),
+                                       m_polarized, *p_cache, key_prefix);
+            } else {
+                m_layouts.emplace_back(*p_layout, m_slices, z_ref, mP_fresnel_map.get(),
+                                       m_polarized);
+            }
             mergeRegionMap(m_layouts.back().regionMap());
         }
     }
@@ -20,6 +20,7 @@
 #include "Vectors3D.h"
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 struct HomogeneousRegion;
@@ -27,6 +28,7 @@ class IFresnelMap;
 class LayerRoughness;
 class MultiLayer;
 class ProcessedLayout;
+class ProcessedSampleCache;
 class SimulationOptions;
 
 //! Data structure that contains all the necessary data for scattering calculations.
@@ -40,6 +42,10 @@ class BA_CORE_API_ ProcessedSample
 {
 public:
     ProcessedSample(const MultiLayer& sample, const SimulationOptions& options);
+    //! Shares the slices, the Fresnel map and the form factors with earlier samples through
+    //! the given cache, see ProcessedSampleCache
+    ProcessedSample(const MultiLayer& sample, const SimulationOptions& options,
+                    ProcessedSampleCache& cache, double wavelength);
     ~ProcessedSample();
 
     size_t numberOfSlices() const;
@@ -47,6 +53,8 @@ public:
     const std::vector<Slice>& averageSlices() const;
     const std::vector<ProcessedLayout>& layouts() const;
     const IFresnelMap* fresnelMap() const;
+    //! Discards the Fresnel coefficients cached so far, e.g. after a change of wavelength
+    void clearFresnelCache();
     double crossCorrelationLength() const;
     kvector_t externalField() const;
     const LayerRoughness* bottomRoughness(size_t i) const;
@@ -61,7 +69,8 @@ public:
 
 private:
     void initSlices(const MultiLayer& sample, const SimulationOptions& options);
-    void initLayouts(const MultiLayer& sample);
+    void initLayouts(const MultiLayer& sample, ProcessedSampleCache* p_cache,
+                     const std::string& stack_key);
     void addSlice(double thickness, const Material& material,
                   const LayerRoughness* p_roughness = nullptr);
     void addNSlices(size_t n, double thickness, const Material& material,
@@ -69,7 +78,7 @@ private:
     void initBFields();
     void mergeRegionMap(const std::map<size_t, std::vector<HomogeneousRegion>>& region_map);
     void initFresnelMap(const SimulationOptions& sim_options);
-    std::unique_ptr<IFresnelMap> mP_fresnel_map;
+    std::shared_ptr<IFresnelMap> mP_fresnel_map;
     std::vector<Slice> m_slices;
     double m_top_z;
     bool m_polarized;
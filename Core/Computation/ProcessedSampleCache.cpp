@@ -0,0 +1,305 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Computation/ProcessedSampleCache.cpp
+//! @brief     Implements class ProcessedSampleCache.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "ProcessedSampleCache.h"
+#include "Crystal.h"
+#include "IFresnelMap.h"
+#include "ILayout.h"
+#include "IParticle.h"
+#include "Layer.h"
+#include "LayerRoughness.h"
+#include "Material.h"
+#include "MultiLayer.h"
+#include "MultiLayerUtils.h"
+#include "ParameterPool.h"
+#include "ProcessedLayout.h"
+#include "ProcessedSample.h"
+#include "RealParameter.h"
+#include "SimulationOptions.h"
+
+namespace
+{
+const size_t default_capacity = 10;
+
+//! Appends the exact binary representation of the value
+template <class T> void append(std::string& key, T value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void append(std::string& key, const std::string& text)
+{
+    append(key, text.size());
+    key += text;
+}
+
+void append(std::string& key, const kvector_t& vector)
+{
+    append(key, vector.x());
+    append(key, vector.y());
+    append(key, vector.z());
+}
+
+void append(std::string& key, const Material& material)
+{
+    append(key, material.getName());
+    append(key, static_cast<int>(material.typeID()));
+    append(key, material.materialData().real());
+    append(key, material.materialData().imag());
+    append(key, material.magnetization());
+}
+
+//! Appends the node, its parameters and material, and its descendants. Returns false if the
+//! node cannot be described: nodes without name are defined outside of the library.
+bool appendNode(std::string& key, const INode& node)
+{
+    const std::string name = node.getName();
+    if (name.empty())
+        return false;
+    append(key, name);
+    const auto& parameters = node.parameterPool()->parameters();
+    append(key, parameters.size());
+    for (const auto p_parameter : parameters) {
+        append(key, p_parameter->getName());
+        append(key, p_parameter->value());
+    }
+    if (auto p_sample = dynamic_cast<const ISample*>(&node))
+        if (auto p_material = p_sample->material())
+            append(key, *p_material);
+    // the Debye-Waller factor is no parameter
+    if (auto p_crystal = dynamic_cast<const Crystal*>(&node))
+        append(key, p_crystal->debyeWallerFactor());
+    const auto children = node.getChildren();
+    append(key, children.size());
+    for (auto p_child : children)
+        if (!p_child || !appendNode(key, *p_child))
+            return false;
+    return true;
+}
+
+//! Appends the particles of the layout and their surface density, which determine the regions
+//! of the average materials
+bool appendParticles(std::string& key, const ILayout& layout)
+{
+    append(key, layout.weight());
+    append(key, layout.getTotalAbundance());
+    append(key, layout.totalParticleSurfaceDensity());
+    for (const auto& group : layout.particleGroups()) {
+        append(key, group.size());
+        for (auto p_particle : group) {
+            const std::string particle_key = ProcessedSampleCache::particleKey(*p_particle);
+            if (particle_key.empty())
+                return false;
+            append(key, particle_key);
+        }
+    }
+    return true;
+}
+} // namespace
+
+ProcessedSampleCache::ProcessedSampleCache() : m_capacity(default_capacity) {}
+
+std::shared_ptr<ProcessedSample>
+ProcessedSampleCache::processedSample(const MultiLayer& sample, const SimulationOptions& options,
+                                      double wavelength)
+{
+    return std::make_shared<ProcessedSample>(sample, options, *this, wavelength);
+}
+
+std::shared_ptr<const ProcessedSampleCache::Stack>
+ProcessedSampleCache::findStack(const std::string& key, double wavelength)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto p_entry = m_stacks.find(key);
+    if (!p_entry)
+        return nullptr;
+    handOut(*p_entry, wavelength);
+    return p_entry->value;
+}
+
+std::shared_ptr<const ProcessedSampleCache::Stack>
+ProcessedSampleCache::insertStack(const std::string& key, std::shared_ptr<const Stack> P_stack,
+                                  double wavelength)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& entry = m_stacks.insert(key, std::move(P_stack), wavelength);
+    handOut(entry, wavelength);
+    auto result = entry.value;
+    m_stacks.shrink(m_capacity);
+    return result;
+}
+
+std::shared_ptr<const ProcessedParticle> ProcessedSampleCache::findParticle(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto p_entry = m_particles.find(key);
+    return p_entry ? p_entry->value : nullptr;
+}
+
+std::shared_ptr<const ProcessedParticle>
+ProcessedSampleCache::insertParticle(const std::string& key,
+                                     std::shared_ptr<const ProcessedParticle> P_particle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto result = m_particles.insert(key, std::move(P_particle), 0.0).value;
+    m_particles.shrink(particles_per_stack * m_capacity);
+    return result;
+}
+
+void ProcessedSampleCache::setCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    m_stacks.shrink(m_capacity);
+    m_particles.shrink(particles_per_stack * m_capacity);
+}
+
+size_t ProcessedSampleCache::capacity() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+size_t ProcessedSampleCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stacks.list.size();
+}
+
+size_t ProcessedSampleCache::hits() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stacks.hits;
+}
+
+size_t ProcessedSampleCache::misses() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stacks.misses;
+}
+
+size_t ProcessedSampleCache::particleCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_particles.list.size();
+}
+
+size_t ProcessedSampleCache::particleHits() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_particles.hits;
+}
+
+size_t ProcessedSampleCache::particleMisses() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_particles.misses;
+}
+
+void ProcessedSampleCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stacks.clear();
+    m_particles.clear();
+}
+
+//! The key holds the layers with their materials and roughnesses, and, with average materials,
+//! the particles of all layouts.
+std::string ProcessedSampleCache::stackKey(const MultiLayer& sample,
+                                           const SimulationOptions& options)
+{
+    std::string result;
+    append(result, options.useAvgMaterials());
+    append(result, options.isIntegrate());
+    append(result, sample.crossCorrLength());
+    append(result, sample.externalField());
+    append(result, sample.numberOfLayers());
+    for (size_t i = 0; i < sample.numberOfLayers(); ++i) {
+        const Layer* p_layer = sample.layer(i);
+        append(result, p_layer->thickness());
+        append(result, p_layer->numberOfSlices());
+        append(result, *p_layer->material());
+        const LayerRoughness* p_roughness = MultiLayerUtils::LayerTopRoughness(sample, i);
+        append(result, p_roughness != nullptr);
+        if (p_roughness && !appendNode(result, *p_roughness))
+            return std::string();
+        if (!options.useAvgMaterials())
+            continue;
+        append(result, p_layer->layouts().size());
+        for (auto p_layout : p_layer->layouts())
+            if (!appendParticles(result, *p_layout))
+                return std::string();
+    }
+    return result;
+}
+
+std::string ProcessedSampleCache::particleKey(const IParticle& particle)
+{
+    std::string result;
+    return appendNode(result, particle) ? result : std::string();
+}
+
+//! Simulations that still use the stack keep working, since the Fresnel map computes
+//! discarded coefficients again.
+void ProcessedSampleCache::handOut(Entries<Stack>::Entry& entry, double wavelength)
+{
+    if (entry.wavelength != wavelength) {
+        entry.value->P_fresnel_map->clearCache();
+        entry.wavelength = wavelength;
+    }
+}
+
+template <class T>
+typename ProcessedSampleCache::Entries<T>::Entry*
+ProcessedSampleCache::Entries<T>::find(const std::string& key)
+{
+    auto it = index.find(key);
+    if (it == index.end()) {
+        ++misses;
+        return nullptr;
+    }
+    list.splice(list.begin(), list, it->second);
+    ++hits;
+    return &*it->second;
+}
+
+//! If another thread processed the same part in the meantime, its result is kept.
+template <class T>
+typename ProcessedSampleCache::Entries<T>::Entry&
+ProcessedSampleCache::Entries<T>::insert(const std::string& key, std::shared_ptr<const T> value,
+                                         double wavelength)
+{
+    auto it = index.find(key);
+    if (it != index.end())
+        return *it->second;
+    list.push_front({key, std::move(value), wavelength});
+    index[key] = list.begin();
+    return list.front();
+}
+
+template <class T> void ProcessedSampleCache::Entries<T>::shrink(size_t capacity)
+{
+    while (list.size() > capacity) {
+        index.erase(list.back().key);
+        list.pop_back();
+    }
+}
+
+template <class T> void ProcessedSampleCache::Entries<T>::clear()
+{
+    list.clear();
+    index.clear();
+    hits = 0;
+    misses = 0;
+}
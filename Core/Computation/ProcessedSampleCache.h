@@ -0,0 +1,147 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Computation/ProcessedSampleCache.h
+//! @brief     Defines class ProcessedSampleCache.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef PROCESSEDSAMPLECACHE_H
+#define PROCESSEDSAMPLECACHE_H
+
+#include "ISingleton.h"
+#include "Slice.h"
+#include "WinDllMacros.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class IFresnelMap;
+class IParticle;
+class MultiLayer;
+class ProcessedSample;
+struct ProcessedParticle;
+class SimulationOptions;
+
+//! Process-wide cache of the parts of processed samples, shared by all simulations that enable
+//! SimulationOptions::setSampleCaching. The parts are keyed by the sub-trees of the sample
+//! they stem from:
+//! - the slices and the Fresnel map by the layer stack, i.e. the layers with their
+//!   materials and roughnesses, and the simulation options that affect the processing;
+//! - the form factors by the particle, together with the layer stack and the layer.
+//!
+//! The keys hold the exact values of all parameters and materials. Samples that differ only in
+//! their interference functions, or simulations that differ only in the beam or the detector,
+//! thus share the slices, the Fresnel coefficients and the form factors. With average materials,
+//! the slices depend on the particles and their densities, which are then part of the layer
+//! stack key. Samples with nodes that cannot be described, like form factors defined in Python,
+//! are not cached.
+//!
+//! The least recently used layer stacks are dropped once the capacity is exceeded, and the least
+//! recently used particles once particles_per_stack times the capacity is exceeded. The
+//! capacity counts entries, not memory. To bound the Fresnel coefficients kept by each layer
+//! stack, they are discarded whenever the stack is handed to a simulation with a different
+//! wavelength, so that each stack holds the coefficients of a single wavelength.
+//!
+//! @ingroup algorithms_internal
+
+class BA_CORE_API_ ProcessedSampleCache : public ISingleton<ProcessedSampleCache>
+{
+public:
+    //! Processed layer stack of a sample
+    struct Stack {
+        std::vector<Slice> slices;
+        double top_z;
+        std::shared_ptr<IFresnelMap> P_fresnel_map;
+    };
+
+    static const size_t particles_per_stack = 100;
+
+    //! Returns the processed sample, sharing its parts with earlier samples where possible.
+    std::shared_ptr<ProcessedSample> processedSample(const MultiLayer& sample,
+                                                     const SimulationOptions& options,
+                                                     double wavelength);
+
+    //! Returns the cached layer stack, or nullptr. The cached Fresnel coefficients are
+    //! discarded if they were computed for another wavelength.
+    std::shared_ptr<const Stack> findStack(const std::string& key, double wavelength);
+
+    //! Caches the layer stack unless the key is present already, and returns the cached stack
+    std::shared_ptr<const Stack> insertStack(const std::string& key,
+                                             std::shared_ptr<const Stack> P_stack,
+                                             double wavelength);
+
+    //! Returns the cached particle, or nullptr
+    std::shared_ptr<const ProcessedParticle> findParticle(const std::string& key);
+
+    //! Caches the particle unless the key is present already, and returns the cached particle
+    std::shared_ptr<const ProcessedParticle>
+    insertParticle(const std::string& key, std::shared_ptr<const ProcessedParticle> P_particle);
+
+    //! Sets the maximal number of cached layer stacks
+    void setCapacity(size_t capacity);
+    size_t capacity() const;
+
+    //! Returns the number of cached layer stacks
+    size_t size() const;
+    //! Returns the number of layer stack lookups that were served from the cache
+    size_t hits() const;
+    //! Returns the number of layer stack lookups that were not served from the cache
+    size_t misses() const;
+
+    size_t particleCount() const;
+    size_t particleHits() const;
+    size_t particleMisses() const;
+
+    //! Drops all cached parts and resets the hit and miss counts
+    void clear();
+
+    //! Returns the key of the layer stack, or an empty string if the stack cannot be described
+    static std::string stackKey(const MultiLayer& sample, const SimulationOptions& options);
+
+    //! Returns the key of the particle, or an empty string if it cannot be described. Particles
+    //! with equal keys in the same layer of the same stack have the same form factors.
+    static std::string particleKey(const IParticle& particle);
+
+protected:
+    ProcessedSampleCache();
+    friend class ISingleton<ProcessedSampleCache>;
+
+private:
+    //! Least recently used entries of one kind
+    template <class T> struct Entries {
+        struct Entry {
+            std::string key;
+            std::shared_ptr<const T> value;
+            double wavelength; //!< wavelength of the cached Fresnel coefficients
+        };
+        std::list<Entry> list; //!< most recently used first
+        std::unordered_map<std::string, typename std::list<Entry>::iterator> index;
+        size_t hits;
+        size_t misses;
+
+        Entries() : hits(0), misses(0) {}
+        Entry* find(const std::string& key);
+        Entry& insert(const std::string& key, std::shared_ptr<const T> value, double wavelength);
+        void shrink(size_t capacity);
+        void clear();
+    };
+
+    static void handOut(Entries<Stack>::Entry& entry, double wavelength);
+
+    mutable std::mutex m_mutex;
+    size_t m_capacity;
+    Entries<Stack> m_stacks;
+    Entries<ProcessedParticle> m_particles;
+};
+
+#endif // PROCESSEDSAMPLECACHE_H
@@ -13,9 +13,31 @@
 // ************************************************************************** //
 
 #include "ProgressHandler.h"
-#include <mutex>
 #include <stdexcept>
 
+namespace
+{
+std::chrono::steady_clock::rep now()
+{
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+} // namespace
+
+const std::chrono::milliseconds ProgressHandler::inform_interval(50);
+
+ProgressHandler::ProgressHandler()
+    : m_inform(nullptr), m_expected_nticks(0), m_completed_nticks(0), m_continuation_flag(true),
+      m_next_inform(0)
+{}
+
+ProgressHandler::ProgressHandler(const ProgressHandler& other)
+    : m_inform(other.m_inform) // not clear whether we want multiple copies of this
+    , m_expected_nticks(other.m_expected_nticks.load())
+    , m_completed_nticks(other.m_completed_nticks.load())
+    , m_continuation_flag(true)
+    , m_next_inform(0)
+{}
+
 void ProgressHandler::subscribe(ProgressHandler::Callback_t inform)
 {
     if (m_inform)
@@ -24,22 +46,49 @@ void ProgressHandler::subscribe(ProgressHandler::Callback_t inform)
     m_inform = inform;
 }
 
+void ProgressHandler::reset()
+{
+    m_completed_nticks = 0;
+    m_continuation_flag = true;
+    m_next_inform = 0;
+}
+
 //! Increments number of completed computation steps (ticks).
-//! Performs callback (method m_inform) to inform the subscriber about
-//! the state of the computation and to obtain as return value a flag
-//! that indicates whether to continue the computation.
+//! If the subscriber is due, performs callback (method m_inform) to inform it about the state
+//! of the computation and to obtain as return value a flag that indicates whether to continue
+//! the computation. A thread that finds another one calling the subscriber does not wait.
 void ProgressHandler::incrementDone(size_t ticks_done)
 {
-    static std::mutex single_mutex;
-    std::unique_lock<std::mutex> single_lock( single_mutex );
+    const size_t previous = m_completed_nticks.fetch_add(ticks_done, std::memory_order_relaxed);
+    if (!m_inform)
+        return;
+    const size_t expected = m_expected_nticks.load(std::memory_order_relaxed);
+    if (previous < expected && previous + ticks_done >= expected) {
+        std::lock_guard<std::mutex> lock(m_inform_mutex);
+        inform(m_completed_nticks.load(std::memory_order_relaxed));
+        return;
+    }
+    if (now() < m_next_inform.load(std::memory_order_relaxed))
+        return;
+    std::unique_lock<std::mutex> lock(m_inform_mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+        return;
+    inform(m_completed_nticks.load(std::memory_order_relaxed));
+}
 
-    m_completed_nticks += ticks_done;
-    if (m_completed_nticks > m_expected_nticks)
-        m_expected_nticks = m_completed_nticks+1;
+void ProgressHandler::inform(size_t completed_nticks)
+{
+    m_next_inform.store(now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                    inform_interval).count(),
+                        std::memory_order_relaxed);
+    size_t expected_nticks = m_expected_nticks.load(std::memory_order_relaxed);
+    if (completed_nticks > expected_nticks)
+        expected_nticks = completed_nticks + 1;
 
-    int percentage_done = (int) (100.*m_completed_nticks/m_expected_nticks);
+    int percentage_done = (int) (100.*completed_nticks/expected_nticks);
     // fractional part is discarded, which is fine here:
     // the value 100 is only returned if everything is done
 
-    m_continuation_flag = ( !m_inform || m_inform(percentage_done) ) && m_continuation_flag;
+    if (!m_inform(percentage_done))
+        m_continuation_flag.store(false, std::memory_order_relaxed);
 }
@@ -16,7 +16,10 @@
 #define PROGRESSHANDLER_H
 
 #include "WinDllMacros.h"
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <mutex>
 
 class MultiLayer;
 
@@ -26,6 +29,11 @@ class MultiLayer;
 //! It is then periodically called back by inform(..).
 //! The return value of inform(..) can be used to request termination of the computation.
 //!
+//! Completed ticks are only accumulated in an atomic counter. The subscriber is called at most
+//! once per inform_interval, by the thread whose ticks fall due first, and never waits on
+//! other threads; the call for the completion of all ticks is always made. The termination
+//! request is a relaxed flag that the computations poll through alive().
+//!
 //! @ingroup algorithms_internal
 
 class BA_CORE_API_ ProgressHandler
@@ -33,24 +41,25 @@ class BA_CORE_API_ ProgressHandler
 public:
     typedef std::function<bool(size_t)> Callback_t;
 
-    ProgressHandler()
-        : m_inform(nullptr), m_expected_nticks(0), m_completed_nticks(0), m_continuation_flag(true)
-    {}
-    ProgressHandler(const ProgressHandler& other)
-        : m_inform(other.m_inform) // not clear whether we want multiple copies of this
-        , m_expected_nticks(other.m_expected_nticks)
-        , m_completed_nticks(other.m_completed_nticks) {}
+    //! Minimal time between two calls of the subscriber
+    static const std::chrono::milliseconds inform_interval;
+
+    ProgressHandler();
+    ProgressHandler(const ProgressHandler& other);
     void subscribe(ProgressHandler::Callback_t callback);
-    void reset() { m_completed_nticks = 0; m_continuation_flag = true; }
-    void setExpectedNTicks(size_t n) { m_expected_nticks = n; }
+    void reset();
+    void setExpectedNTicks(size_t n) { m_expected_nticks.store(n, std::memory_order_relaxed); }
     void incrementDone(size_t ticks_done);
-    bool alive() { return m_continuation_flag; }
+    bool alive() const { return m_continuation_flag.load(std::memory_order_relaxed); }
 
 private:
+    void inform(size_t completed_nticks);
     Callback_t m_inform;
-    size_t m_expected_nticks;
-    size_t m_completed_nticks;
-    bool m_continuation_flag;
+    std::atomic<size_t> m_expected_nticks;
+    std::atomic<size_t> m_completed_nticks;
+    std::atomic<bool> m_continuation_flag;
+    std::atomic<std::chrono::steady_clock::rep> m_next_inform; //!< earliest time of next call
+    std::mutex m_inform_mutex; //!< serializes the calls of the subscriber
     bool defaultMonitorExec(int);
 };
 
@@ -16,6 +16,7 @@
 #include "ILayerRTCoefficients.h"
 #include "IFresnelMap.h"
 #include "Faddeeva.hh"
+#include "Instrumentation.h"
 #include "Layer.h"
 #include "LayerInterface.h"
 #include "LayerRoughness.h"
@@ -45,6 +46,7 @@ RoughMultiLayerComputation::RoughMultiLayerComputation(const ProcessedSample* p_
 
 void RoughMultiLayerComputation::compute(SimulationElement& elem) const
 {
+    BA_INSTRUMENT_SCOPE(Roughness);
     if (elem.getAlphaMean()<0.0)
         return;
     auto n_slices = mp_sample->numberOfSlices();
@@ -60,7 +60,7 @@ void Slice::setMaterial(const Material& material)
     m_material = material;
 }
 
-Material Slice::material() const
+const Material& Slice::material() const
 {
     return m_material;
 }
@@ -35,7 +35,7 @@ public:
     ~Slice();
 
     void setMaterial(const Material& material);
-    Material material() const;
+    const Material& material() const;
 
     double thickness() const;
     const LayerRoughness* topRoughness() const;
@@ -23,16 +23,19 @@ static_assert(std::is_copy_constructible<SpecularComputation>::value == false,
 static_assert(std::is_copy_assignable<SpecularComputation>::value == false,
               "SpecularComputation should not be copy assignable");
 
-SpecularComputation::SpecularComputation(const MultiLayer& multilayer,
+SpecularComputation::SpecularComputation(std::shared_ptr<const ProcessedSample> p_sample,
                                          const SimulationOptions& options,
                                          ProgressHandler& progress, SpecularElementIter begin_it,
                                          SpecularElementIter end_it)
-    : IComputation(multilayer, options, progress), m_begin_it(begin_it), m_end_it(end_it)
+    : IComputation(std::move(p_sample), options, progress), m_begin_it(begin_it),
+      m_end_it(end_it)
 {
     if (mP_processed_sample->containsMagneticMaterial()
         || mP_processed_sample->externalField() != kvector_t{})
         throw std::runtime_error("Error in SpecularComputation::SpecularComputation: magnetized "
                                  "samples are not currently handled.");
+    if (m_sim_options.useSpecularKzGrid())
+        m_computation_term.setKzGridThreshold(m_sim_options.specularKzGridThreshold());
 }
 
 SpecularComputation::~SpecularComputation() = default;
@@ -44,6 +47,6 @@ void SpecularComputation::runProtected()
 
     m_computation_term.setProgressHandler(mp_progress);
     auto& slices = mP_processed_sample->averageSlices();
-    for (auto it = m_begin_it; it != m_end_it; ++it)
-        m_computation_term.compute(*it, slices);
+    m_computation_term.compute(m_begin_it, m_end_it, slices);
+    m_computation_term.flushProgress();
 }
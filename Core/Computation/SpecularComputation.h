@@ -33,8 +33,9 @@ class SpecularComputation : public IComputation
     using SpecularElementIter = std::vector<SpecularSimulationElement>::iterator;
 
 public:
-    SpecularComputation(const MultiLayer& multilayer, const SimulationOptions& options,
-                        ProgressHandler& progress, SpecularElementIter begin_it,
+    SpecularComputation(std::shared_ptr<const ProcessedSample> p_sample,
+                        const SimulationOptions& options, ProgressHandler& progress,
+                        SpecularElementIter begin_it,
                         SpecularElementIter end_it);
     ~SpecularComputation() override;
 
@@ -14,11 +14,47 @@
 
 #include "SpecularComputationTerm.h"
 #include "DelayedProgressCounter.h"
+#include "MathConstants.h"
 #include "ScalarRTCoefficients.h"
+#include "Slice.h"
 #include "SpecularMatrix.h"
 #include "SpecularSimulationElement.h"
+#include <algorithm>
+#include <limits>
+#include <utility>
 
-SpecularComputationTerm::SpecularComputationTerm() {}
+namespace
+{
+double reflectivity(const std::vector<Slice>& slices, const std::vector<complex_t>& kz);
+bool definedBySLD(const std::vector<Slice>& slices);
+double maxKzStep(const std::vector<Slice>& slices);
+double mergeTolerance(double kz, double max_step, double threshold);
+
+//! Reflectivities on the sorted, distinct values of kz in the top slice. Values are computed
+//! exactly on nodes which are chosen by bisection, and linearly interpolated in between.
+class KzGrid
+{
+public:
+    KzGrid(std::vector<double> kz, std::vector<SpecularSimulationElement*> elements,
+           const std::vector<Slice>& slices, double threshold);
+
+    double intensity(size_t i) const { return m_intensity[i]; }
+
+private:
+    double exact(size_t i);
+    double interpolated(size_t lo, size_t hi, size_t i) const;
+    void refine(size_t lo, size_t hi);
+
+    std::vector<double> m_kz;
+    std::vector<SpecularSimulationElement*> m_elements; //!< one element for each kz
+    const std::vector<Slice>& m_slices;
+    double m_threshold;
+    double m_max_step;
+    std::vector<double> m_intensity; //!< negative: not yet computed
+};
+} // namespace
+
+SpecularComputationTerm::SpecularComputationTerm() : m_kz_grid_threshold(0.0) {}
 
 SpecularComputationTerm::~SpecularComputationTerm() = default;
 
@@ -27,15 +63,152 @@ void SpecularComputationTerm::setProgressHandler(ProgressHandler* p_progress)
     mP_progress_counter.reset(new DelayedProgressCounter(p_progress, 100));
 }
 
-void SpecularComputationTerm::compute(SpecularSimulationElement& elem,
+void SpecularComputationTerm::flushProgress()
+{
+    if (mP_progress_counter)
+        mP_progress_counter->flush();
+}
+
+void SpecularComputationTerm::compute(SpecularElementIter begin_it, SpecularElementIter end_it,
                                       const std::vector<Slice>& slices) const
 {
-    if (!elem.isCalculated())
+    if (m_kz_grid_threshold > 0.0 && definedBySLD(slices))
+        computeOnKzGrid(begin_it, end_it, slices);
+    else
+        computeExactly(begin_it, end_it, slices);
+}
+
+void SpecularComputationTerm::computeExactly(SpecularElementIter begin_it,
+                                             SpecularElementIter end_it,
+                                             const std::vector<Slice>& slices) const
+{
+    for (auto it = begin_it; it != end_it; ++it) {
+        if (!it->isCalculated())
+            continue;
+        it->setIntensity(reflectivity(slices, it->produceKz(slices)));
+        if (mP_progress_counter)
+            mP_progress_counter->stepProgress();
+    }
+}
+
+//! For materials defined by SLD, kz in the top slice determines kz in all other slices, so
+//! that the reflectivity is a smooth function of it, which is interpolated on a grid. Values of
+//! kz closer than the tolerance of mergeTolerance() share one grid node.
+void SpecularComputationTerm::computeOnKzGrid(SpecularElementIter begin_it,
+                                              SpecularElementIter end_it,
+                                              const std::vector<Slice>& slices) const
+{
+    // kz in the other slices is only needed for the nodes of the grid
+    const std::vector<Slice> top_slice(slices.begin(), slices.begin() + 1);
+    using KzRequest = std::pair<double, SpecularSimulationElement*>;
+    std::vector<KzRequest> requests;
+    for (auto it = begin_it; it != end_it; ++it)
+        if (it->isCalculated())
+            requests.emplace_back(it->produceKz(top_slice)[0].real(), &*it);
+
+    std::sort(requests.begin(), requests.end(), [](const KzRequest& lhs, const KzRequest& rhs) {
+        return lhs.first < rhs.first;
+    });
+    const double max_step = maxKzStep(slices);
+    std::vector<double> kz;
+    std::vector<SpecularSimulationElement*> elements;
+    std::vector<size_t> node_of_request;
+    for (const auto& request : requests) {
+        if (kz.empty()
+            || request.first - kz.back()
+                   > mergeTolerance(kz.back(), max_step, m_kz_grid_threshold)) {
+            kz.push_back(request.first);
+            elements.push_back(request.second);
+        }
+        node_of_request.push_back(kz.size() - 1);
+    }
+
+    KzGrid grid(std::move(kz), std::move(elements), slices, m_kz_grid_threshold);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        requests[i].second->setIntensity(grid.intensity(node_of_request[i]));
+        if (mP_progress_counter)
+            mP_progress_counter->stepProgress();
+    }
+}
+
+namespace
+{
+double reflectivity(const std::vector<Slice>& slices, const std::vector<complex_t>& kz)
+{
+    auto coeff = SpecularMatrix::Execute(slices, kz);
+    return std::norm(coeff[0].getScalarR());
+}
+
+bool definedBySLD(const std::vector<Slice>& slices)
+{
+    return std::all_of(slices.begin(), slices.end(), [](const Slice& slice) {
+        return slice.material().typeID() == MATERIAL_TYPES::MaterialBySLD;
+    });
+}
+
+//! Returns the largest admissible distance of grid nodes, which is a quarter of the period
+//! of the thickness fringes of the whole stack.
+double maxKzStep(const std::vector<Slice>& slices)
+{
+    double thickness = 0.0;
+    for (const auto& slice : slices)
+        thickness += slice.thickness();
+    return thickness > 0.0 ? M_PI / (4.0 * thickness) : std::numeric_limits<double>::infinity();
+}
+
+//! Returns the distance below which two values of kz are merged into one grid node. The
+//! reflectivity changes on the scales of kz itself (its asymptotic decay) and of the fringe
+//! period, so that shifting kz by a quarter of the threshold times the smaller of both scales
+//! changes it by about the threshold at most.
+double mergeTolerance(double kz, double max_step, double threshold)
+{
+    return 0.25 * threshold * std::min(std::abs(kz), max_step);
+}
+
+KzGrid::KzGrid(std::vector<double> kz, std::vector<SpecularSimulationElement*> elements,
+               const std::vector<Slice>& slices, double threshold)
+    : m_kz(std::move(kz)), m_elements(std::move(elements)), m_slices(slices),
+      m_threshold(threshold), m_max_step(maxKzStep(slices)), m_intensity(m_kz.size(), -1.0)
+{
+    if (m_kz.empty())
         return;
+    exact(0);
+    exact(m_kz.size() - 1);
+    refine(0, m_kz.size() - 1);
+}
 
-    auto coeff = SpecularMatrix::Execute(slices, elem.produceKz(slices));
-    elem.setIntensity(std::norm(coeff[0].getScalarR()));
+double KzGrid::exact(size_t i)
+{
+    if (m_intensity[i] < 0.0)
+        m_intensity[i] = reflectivity(m_slices, m_elements[i]->produceKz(m_slices));
+    return m_intensity[i];
+}
 
-    if (mP_progress_counter)
-        mP_progress_counter->stepProgress();
+double KzGrid::interpolated(size_t lo, size_t hi, size_t i) const
+{
+    const double t = (m_kz[i] - m_kz[lo]) / (m_kz[hi] - m_kz[lo]);
+    return (1.0 - t) * m_intensity[lo] + t * m_intensity[hi];
+}
+
+//! Computes the node in the middle of [lo, hi] exactly; if its linear interpolation from
+//! the ends is accurate enough, all other values inside are interpolated, else both halves
+//! are refined further.
+void KzGrid::refine(size_t lo, size_t hi)
+{
+    if (hi - lo < 2)
+        return;
+    const size_t mid = (lo + hi) / 2;
+    const double estimate = interpolated(lo, hi, mid);
+    const double value = exact(mid);
+    if (m_kz[hi] - m_kz[lo] <= m_max_step
+        && std::abs(estimate - value) <= m_threshold * value) {
+        for (size_t i = lo + 1; i < mid; ++i)
+            m_intensity[i] = interpolated(lo, mid, i);
+        for (size_t i = mid + 1; i < hi; ++i)
+            m_intensity[i] = interpolated(mid, hi, i);
+        return;
+    }
+    refine(lo, mid);
+    refine(mid, hi);
 }
+} // namespace
@@ -29,15 +29,33 @@ class SpecularSimulationElement;
 
 class SpecularComputationTerm
 {
+    using SpecularElementIter = std::vector<SpecularSimulationElement>::iterator;
+
 public:
     SpecularComputationTerm();
     ~SpecularComputationTerm();
 
     void setProgressHandler(ProgressHandler* p_progress);
-    void compute(SpecularSimulationElement& elem, const std::vector<Slice>& slices) const;
+
+    //! Reports the progress that is still pending at the end of the computation
+    void flushProgress();
+
+    //! Enables interpolation on an adaptive kz grid with the given relative error threshold,
+    //! for samples whose materials are all defined by SLD
+    void setKzGridThreshold(double threshold) { m_kz_grid_threshold = threshold; }
+
+    //! Computes all elements of the given range, on the adaptive kz grid if enabled
+    void compute(SpecularElementIter begin_it, SpecularElementIter end_it,
+                 const std::vector<Slice>& slices) const;
 
 private:
+    void computeExactly(SpecularElementIter begin_it, SpecularElementIter end_it,
+                        const std::vector<Slice>& slices) const;
+    void computeOnKzGrid(SpecularElementIter begin_it, SpecularElementIter end_it,
+                         const std::vector<Slice>& slices) const;
+
     std::unique_ptr<DelayedProgressCounter> mP_progress_counter;
+    double m_kz_grid_threshold; //!< zero: no interpolation
 };
 
 #endif /* SPECULARCOMPUTATIONTERM_H_ */
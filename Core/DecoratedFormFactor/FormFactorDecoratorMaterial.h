@@ -46,9 +46,11 @@ public:
     Eigen::Matrix2cd evaluatePol(const WavevectorInfo& wavevectors) const override final;
 #endif
 
-private:
+    //! Returns the scalar contrast factor, which only depends on the wavelength
     complex_t getRefractiveIndexFactor(const WavevectorInfo& wavevectors) const;
 
+private:
+
     Material m_material;
     Material m_ambient_material;
 };
@@ -46,12 +46,22 @@ double FormFactorDecoratorRotation::topZ(const IRotation& rotation) const
 
 complex_t FormFactorDecoratorRotation::evaluate(const WavevectorInfo& wavevectors) const
 {
-    return mp_form_factor->evaluate(wavevectors.transformed(m_transform.getInverse()));
+    return mp_form_factor->evaluate(rotatedWavevectors(wavevectors));
 }
 
 Eigen::Matrix2cd FormFactorDecoratorRotation::evaluatePol(const WavevectorInfo& wavevectors) const
 {
-    return mp_form_factor->evaluatePol(wavevectors.transformed(m_transform.getInverse()));
+    return mp_form_factor->evaluatePol(rotatedWavevectors(wavevectors));
+}
+
+//! Returns the wavevectors in the frame of the undecorated form factor, using the inverse
+//! matrix stored in the transformation
+WavevectorInfo FormFactorDecoratorRotation::rotatedWavevectors(
+    const WavevectorInfo& wavevectors) const
+{
+    return WavevectorInfo(m_transform.transformedInverse(wavevectors.getKi()),
+                          m_transform.transformedInverse(wavevectors.getKf()),
+                          wavevectors.getWavelength());
 }
 
 FormFactorDecoratorRotation::FormFactorDecoratorRotation(
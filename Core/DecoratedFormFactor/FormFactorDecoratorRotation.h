@@ -41,6 +41,8 @@ public:
 #endif
 
 private:
+    WavevectorInfo rotatedWavevectors(const WavevectorInfo& wavevectors) const;
+
     Transform3D m_transform;
     //! Private constructor for cloning.
     FormFactorDecoratorRotation(const IFormFactor& form_factor, const Transform3D& transform);
@@ -52,6 +52,31 @@ private:
     std::unique_ptr<ObjectiveMetric> m_module;
 };
 
+namespace
+{
+//! Appends the differences between the experimental and the simulated values
+template <class T>
+void appendResiduals(std::vector<double>& result, const std::vector<T>& exp_values,
+                     const std::vector<double>& sim_values)
+{
+    for (size_t i = 0, size = sim_values.size(); i < size; ++i)
+        result.push_back(exp_values[i] - sim_values[i]);
+}
+
+//! Returns the sum of the squared residuals of the chi-squared module
+template <class T>
+double squaredResiduals(IChiSquaredModule& module, const std::vector<double>& sim_values,
+                        const std::vector<T>& exp_values, const std::vector<T>& weights)
+{
+    double result = 0.0;
+    for (size_t i = 0, size = sim_values.size(); i < size; ++i) {
+        double value = module.residual(sim_values[i], exp_values[i], weights[i]);
+        result += value * value;
+    }
+    return result;
+}
+} // namespace
+
 simulation_builder_t FitObjective::simulationBuilder(PyBuilderCallback& callback)
 {
     return [&callback](const Fit::Parameters& params) {
@@ -83,6 +108,12 @@ void FitObjective::addSimulationAndData(simulation_builder_t builder,
     m_fit_objects.emplace_back(builder, data, std::move(uncertainties), weight);
 }
 
+void FitObjective::addSimulationAndData(PyBuilderCallback& callback,
+                                        const OutputData<double>& data, double weight)
+{
+    addSimulationAndData(simulationBuilder(callback), data, nullptr, weight);
+}
+
 double FitObjective::evaluate(const Fit::Parameters& params)
 {
     run_simulations(params);
@@ -95,10 +126,16 @@ std::vector<double> FitObjective::evaluate_residuals(const Fit::Parameters& para
 {
     evaluate(params);
 
-    std::vector<double> result = experimental_array(); // init result with experimental data values
-    const std::vector<double> sim_values = simulation_array();
-    std::transform(result.begin(), result.end(), sim_values.begin(), result.begin(),
-                   [](double lhs, double rhs) { return lhs - rhs; });
+    std::vector<double> result;
+    result.reserve(numberOfFitElements());
+    for (auto& obj : m_fit_objects) {
+        const std::vector<double> sim_values = obj.simulation_array();
+        // single-precision data are read in place
+        if (obj.singlePrecision())
+            appendResiduals(result, obj.experimentalValues(), sim_values);
+        else
+            appendResiduals(result, obj.experimental_array(), sim_values);
+    }
     return result;
 }
 
@@ -335,14 +372,13 @@ double ChiModuleWrapper::compute(const std::vector<SimDataPair>& fit_objects, si
     double result = 0.0;
     for (auto& obj: fit_objects) {
         const auto sim_array = obj.simulation_array();
-        const auto exp_array = obj.experimental_array();
-        const auto weights = obj.user_weights_array();
-        const size_t n_elements = sim_array.size();
-        for(size_t i = 0; i < n_elements; ++i) {
-            double value = m_module->residual(sim_array[i], exp_array[i], weights[i]);
-            result += value * value;
-        }
-        n_points += n_elements;
+        if (obj.singlePrecision())
+            result += squaredResiduals(*m_module, sim_array, obj.experimentalValues(),
+                                       obj.userWeightValues());
+        else
+            result += squaredResiduals(*m_module, sim_array, obj.experimental_array(),
+                                       obj.user_weights_array());
+        n_points += sim_array.size();
     }
 
     int fnorm = static_cast<int>(n_points) - static_cast<int>(n_pars);
@@ -56,6 +56,14 @@ public:
                              weight);
     }
 
+    //! Constructs simulation/data pair for later fit from data which is already available as
+    //! OutputData, e.g. from PyArrayImport::importNumpyArray, saving an intermediate copy.
+    //! @param callback: simulation builder capable of producing simulations
+    //! @param data: experimental data
+    //! @param weight: weight of dataset in metric calculations
+    void addSimulationAndData(PyBuilderCallback& callback, const OutputData<double>& data,
+                              double weight = 1.0);
+
     //! Constructs simulation/data pair for later fit.
     //! @param callback: simulation builder capable of producing simulations
     //! @param data: experimental data array
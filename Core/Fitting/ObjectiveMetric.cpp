@@ -24,6 +24,11 @@ const double double_max = std::numeric_limits<double>::max();
 const double double_min = std::numeric_limits<double>::min();
 const double ln10 = std::log(10.0);
 
+std::vector<double> toDouble(const std::vector<float>& values)
+{
+    return std::vector<double>(values.begin(), values.end());
+}
+
 template<class T>
 T* copyMetric(const T& metric)
 {
@@ -32,8 +37,9 @@ T* copyMetric(const T& metric)
     return result.release();
 }
 
-void checkIntegrity(const std::vector<double>& sim_data, const std::vector<double>& exp_data,
-                    const std::vector<double>& weight_factors)
+template <class T>
+void checkIntegrity(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+                    const std::vector<T>& weight_factors)
 {
     const size_t sim_size = sim_data.size();
     if (sim_size != exp_data.size() || sim_size != weight_factors.size())
@@ -46,9 +52,9 @@ void checkIntegrity(const std::vector<double>& sim_data, const std::vector<doubl
                 "Error in ObjectiveMetric: simulation data array contains negative values");
 }
 
-void checkIntegrity(const std::vector<double>& sim_data, const std::vector<double>& exp_data,
-                    const std::vector<double>& uncertainties,
-                    const std::vector<double>& weight_factors)
+template <class T>
+void checkIntegrity(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+                    const std::vector<T>& uncertainties, const std::vector<T>& weight_factors)
 {
     if (sim_data.size() != uncertainties.size())
         throw std::runtime_error(
@@ -56,6 +62,120 @@ void checkIntegrity(const std::vector<double>& sim_data, const std::vector<doubl
 
     checkIntegrity(sim_data, exp_data, weight_factors);
 }
+
+// The metric kernels below read the experimental data, uncertainties and weights either in
+// double or in single precision (T = double or float) and always accumulate in double precision.
+
+template <class T>
+double chi2(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+            const std::vector<T>& uncertainties, const std::vector<T>& weight_factors,
+            const std::function<double(double)>& norm_fun)
+{
+    checkIntegrity(sim_data, exp_data, uncertainties, weight_factors);
+
+    double result = 0.0;
+    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
+        if (exp_data[i] >= 0.0 && weight_factors[i] > 0.0 && uncertainties[i] > 0.0)
+            result += norm_fun((exp_data[i] - sim_data[i]) / uncertainties[i]) * weight_factors[i];
+
+    return std::isfinite(result) ? result : double_max;
+}
+
+template <class T>
+double chi2(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+            const std::vector<T>& weight_factors, const std::function<double(double)>& norm_fun)
+{
+    checkIntegrity(sim_data, exp_data, weight_factors);
+
+    double result = 0.0;
+    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
+        if (exp_data[i] >= 0.0 && weight_factors[i] > 0.0)
+            result += norm_fun(exp_data[i] - sim_data[i]) * weight_factors[i];
+
+    return std::isfinite(result) ? result : double_max;
+}
+
+template <class T>
+double poissonLike(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+                   const std::vector<T>& weight_factors,
+                   const std::function<double(double)>& norm_fun)
+{
+    checkIntegrity(sim_data, exp_data, weight_factors);
+
+    double result = 0.0;
+    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
+    {
+        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0)
+            continue;
+        const double variance = std::max(1.0, sim_data[i]);
+        const double value = (sim_data[i] - exp_data[i]) / std::sqrt(variance);
+        result += norm_fun(value) * weight_factors[i];
+    }
+
+    return std::isfinite(result) ? result : double_max;
+}
+
+template <class T>
+double logDifference(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+                     const std::vector<T>& uncertainties, const std::vector<T>& weight_factors,
+                     const std::function<double(double)>& norm_fun)
+{
+    checkIntegrity(sim_data, exp_data, uncertainties, weight_factors);
+
+    double result = 0.0;
+    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
+    {
+        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0 || uncertainties[i] <= 0.0)
+            continue;
+        const double sim_val = std::max(double_min, sim_data[i]);
+        const double exp_val = std::max(double_min, static_cast<double>(exp_data[i]));
+        double value = std::log10(sim_val) - std::log10(exp_val);
+        value *= exp_val * ln10 / uncertainties[i];
+        result += norm_fun(value) * weight_factors[i];
+    }
+
+    return std::isfinite(result) ? result : double_max;
+}
+
+template <class T>
+double logDifference(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+                     const std::vector<T>& weight_factors,
+                     const std::function<double(double)>& norm_fun)
+{
+    checkIntegrity(sim_data, exp_data, weight_factors);
+
+    double result = 0.0;
+    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
+    {
+        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0)
+            continue;
+        const double sim_val = std::max(double_min, sim_data[i]);
+        const double exp_val = std::max(double_min, static_cast<double>(exp_data[i]));
+        result += norm_fun(std::log10(sim_val) - std::log10(exp_val)) * weight_factors[i];
+    }
+
+    return std::isfinite(result) ? result : double_max;
+}
+
+template <class T>
+double relativeDifference(const std::vector<double>& sim_data, const std::vector<T>& exp_data,
+                          const std::vector<T>& weight_factors,
+                          const std::function<double(double)>& norm_fun)
+{
+    checkIntegrity(sim_data, exp_data, weight_factors);
+
+    double result = 0.0;
+    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
+    {
+        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0)
+            continue;
+        const double sim_val = std::max(double_min, sim_data[i]);
+        const double exp_val = std::max(double_min, static_cast<double>(exp_data[i]));
+        result += norm_fun((exp_val - sim_val) / (exp_val + sim_val)) * weight_factors[i];
+    }
+
+    return std::isfinite(result) ? result : double_max;
+}
 }
 
 ObjectiveMetric::ObjectiveMetric(std::function<double(double)> norm)
@@ -68,6 +188,16 @@ double ObjectiveMetric::compute(const SimDataPair& data_pair, bool use_weights)
         throw std::runtime_error("Error in ObjectiveMetric::compute: the metric is weighted, but "
                                  "the simulation-data pair does not contain uncertainties");
 
+    if (data_pair.singlePrecision()) {
+        if (use_weights)
+            return computeFromSinglePrecision(
+                data_pair.simulation_array(), data_pair.experimentalValues(),
+                data_pair.uncertaintyValues(), data_pair.userWeightValues());
+        return computeFromSinglePrecision(data_pair.simulation_array(),
+                                          data_pair.experimentalValues(),
+                                          data_pair.userWeightValues());
+    }
+
     if (use_weights)
         return computeFromArrays(data_pair.simulation_array(), data_pair.experimental_array(),
                                  data_pair.uncertainties_array(), data_pair.user_weights_array());
@@ -76,6 +206,22 @@ double ObjectiveMetric::compute(const SimDataPair& data_pair, bool use_weights)
                                  data_pair.user_weights_array());
 }
 
+double ObjectiveMetric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                                   const std::vector<float>& exp_data,
+                                                   const std::vector<float>& uncertainties,
+                                                   const std::vector<float>& weight_factors) const
+{
+    return computeFromArrays(sim_data, toDouble(exp_data), toDouble(uncertainties),
+                             toDouble(weight_factors));
+}
+
+double ObjectiveMetric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                                   const std::vector<float>& exp_data,
+                                                   const std::vector<float>& weight_factors) const
+{
+    return computeFromArrays(sim_data, toDouble(exp_data), toDouble(weight_factors));
+}
+
 void ObjectiveMetric::setNorm(std::function<double(double)> norm)
 {
     m_norm = std::move(norm);
@@ -96,29 +242,28 @@ double Chi2Metric::computeFromArrays(std::vector<double> sim_data, std::vector<d
                                      std::vector<double> uncertainties,
                                      std::vector<double> weight_factors) const
 {
-    checkIntegrity(sim_data, exp_data, uncertainties, weight_factors);
-
-    double result = 0.0;
-    auto norm_fun = norm();
-    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
-        if (exp_data[i] >= 0.0 && weight_factors[i] > 0.0 && uncertainties[i] > 0.0)
-            result += norm_fun((exp_data[i] - sim_data[i]) / uncertainties[i]) * weight_factors[i];
-
-    return std::isfinite(result) ? result : double_max;
+    return chi2(sim_data, exp_data, uncertainties, weight_factors, norm());
 }
 
 double Chi2Metric::computeFromArrays(std::vector<double> sim_data, std::vector<double> exp_data,
                                      std::vector<double> weight_factors) const
 {
-    checkIntegrity(sim_data, exp_data, weight_factors);
+    return chi2(sim_data, exp_data, weight_factors, norm());
+}
 
-    auto norm_fun = norm();
-    double result = 0.0;
-    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
-        if (exp_data[i] >= 0.0 && weight_factors[i] > 0.0)
-            result += norm_fun(exp_data[i] - sim_data[i]) * weight_factors[i];
+double Chi2Metric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                              const std::vector<float>& exp_data,
+                                              const std::vector<float>& uncertainties,
+                                              const std::vector<float>& weight_factors) const
+{
+    return chi2(sim_data, exp_data, uncertainties, weight_factors, norm());
+}
 
-    return std::isfinite(result) ? result : double_max;
+double Chi2Metric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                              const std::vector<float>& exp_data,
+                                              const std::vector<float>& weight_factors) const
+{
+    return chi2(sim_data, exp_data, weight_factors, norm());
 }
 
 // ----------------------- Poisson-like metric ---------------------------
@@ -136,20 +281,14 @@ double PoissonLikeMetric::computeFromArrays(std::vector<double> sim_data,
                                             std::vector<double> exp_data,
                                             std::vector<double> weight_factors) const
 {
-    checkIntegrity(sim_data, exp_data, weight_factors);
-
-    double result = 0.0;
-    auto norm_fun = norm();
-    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
-    {
-        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0)
-            continue;
-        const double variance = std::max(1.0, sim_data[i]);
-        const double value = (sim_data[i] - exp_data[i]) / std::sqrt(variance);
-        result += norm_fun(value) * weight_factors[i];
-    }
+    return poissonLike(sim_data, exp_data, weight_factors, norm());
+}
 
-    return std::isfinite(result) ? result : double_max;
+double PoissonLikeMetric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                                     const std::vector<float>& exp_data,
+                                                     const std::vector<float>& weight_factors) const
+{
+    return poissonLike(sim_data, exp_data, weight_factors, norm());
 }
 
 // ----------------------- Log metric ---------------------------
@@ -167,41 +306,28 @@ double LogMetric::computeFromArrays(std::vector<double> sim_data, std::vector<do
                                     std::vector<double> uncertainties,
                                     std::vector<double> weight_factors) const
 {
-    checkIntegrity(sim_data, exp_data, uncertainties, weight_factors);
-
-    double result = 0.0;
-    auto norm_fun = norm();
-    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
-    {
-        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0 || uncertainties[i] <= 0.0)
-            continue;
-        const double sim_val = std::max(double_min, sim_data[i]);
-        const double exp_val = std::max(double_min, exp_data[i]);
-        double value = std::log10(sim_val) - std::log10(exp_val);
-        value *= exp_val * ln10 / uncertainties[i];
-        result += norm_fun(value) * weight_factors[i];
-    }
-
-    return std::isfinite(result) ? result : double_max;
+    return logDifference(sim_data, exp_data, uncertainties, weight_factors, norm());
 }
 
 double LogMetric::computeFromArrays(std::vector<double> sim_data, std::vector<double> exp_data,
                                     std::vector<double> weight_factors) const
 {
-    checkIntegrity(sim_data, exp_data, weight_factors);
+    return logDifference(sim_data, exp_data, weight_factors, norm());
+}
 
-    double result = 0.0;
-    auto norm_fun = norm();
-    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
-    {
-        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0)
-            continue;
-        const double sim_val = std::max(double_min, sim_data[i]);
-        const double exp_val = std::max(double_min, exp_data[i]);
-        result += norm_fun(std::log10(sim_val) - std::log10(exp_val)) * weight_factors[i];
-    }
+double LogMetric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                             const std::vector<float>& exp_data,
+                                             const std::vector<float>& uncertainties,
+                                             const std::vector<float>& weight_factors) const
+{
+    return logDifference(sim_data, exp_data, uncertainties, weight_factors, norm());
+}
 
-    return std::isfinite(result) ? result : double_max;
+double LogMetric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                             const std::vector<float>& exp_data,
+                                             const std::vector<float>& weight_factors) const
+{
+    return logDifference(sim_data, exp_data, weight_factors, norm());
 }
 
 // ----------------------- Relative difference ---------------------------
@@ -219,20 +345,15 @@ double RelativeDifferenceMetric::computeFromArrays(std::vector<double> sim_data,
                                                    std::vector<double> exp_data,
                                                    std::vector<double> weight_factors) const
 {
-    checkIntegrity(sim_data, exp_data, weight_factors);
-
-    double result = 0.0;
-    auto norm_fun = norm();
-    for (size_t i = 0, sim_size = sim_data.size(); i < sim_size; ++i)
-    {
-        if (weight_factors[i] <= 0.0 || exp_data[i] < 0.0)
-            continue;
-        const double sim_val = std::max(double_min, sim_data[i]);
-        const double exp_val = std::max(double_min, exp_data[i]);
-        result += norm_fun((exp_val - sim_val) / (exp_val + sim_val)) * weight_factors[i];
-    }
+    return relativeDifference(sim_data, exp_data, weight_factors, norm());
+}
 
-    return std::isfinite(result) ? result : double_max;
+double
+RelativeDifferenceMetric::computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                                     const std::vector<float>& exp_data,
+                                                     const std::vector<float>& weight_factors) const
+{
+    return relativeDifference(sim_data, exp_data, weight_factors, norm());
 }
 
 // ----------------------- RQ4 metric ---------------------------
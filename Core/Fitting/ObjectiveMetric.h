@@ -57,6 +57,24 @@ public:
     virtual double computeFromArrays(std::vector<double> sim_data, std::vector<double> exp_data,
                                      std::vector<double> weight_factors) const = 0;
 
+#ifndef SWIG
+    //! Computes metric value from the simulated intensities and from experimental data,
+    //! uncertainties and user weights held in single precision (see
+    //! SimulationOptions::setSinglePrecisionData). Accumulates in double precision. The default
+    //! implementation calls computeFromArrays on double-precision copies of the data; the
+    //! metrics of this library read the single-precision values directly.
+    virtual double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                              const std::vector<float>& exp_data,
+                                              const std::vector<float>& uncertainties,
+                                              const std::vector<float>& weight_factors) const;
+
+    //! Computes unweighted metric value from the simulated intensities and from experimental
+    //! data and user weights held in single precision.
+    virtual double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                              const std::vector<float>& exp_data,
+                                              const std::vector<float>& weight_factors) const;
+#endif
+
     void setNorm(std::function<double(double)> norm);
 
     //! Returns a copy of the normalization function used.
@@ -97,6 +115,17 @@ public:
     //! is chosen.
     double computeFromArrays(std::vector<double> sim_data, std::vector<double> exp_data,
                              std::vector<double> weight_factors) const override;
+
+#ifndef SWIG
+    double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                      const std::vector<float>& exp_data,
+                                      const std::vector<float>& uncertainties,
+                                      const std::vector<float>& weight_factors) const override;
+
+    double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                      const std::vector<float>& exp_data,
+                                      const std::vector<float>& weight_factors) const override;
+#endif
 };
 
 //! Implementation of \f$ \chi^2 \f$ metric
@@ -123,6 +152,14 @@ public:
     //! is chosen.
     double computeFromArrays(std::vector<double> sim_data, std::vector<double> exp_data,
                              std::vector<double> weight_factors) const override;
+
+#ifndef SWIG
+    using Chi2Metric::computeFromSinglePrecision;
+
+    double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                      const std::vector<float>& exp_data,
+                                      const std::vector<float>& weight_factors) const override;
+#endif
 };
 
 //! Implementation of the standard \f$ \chi^2 \f$ metric with intensity \f$I\f$
@@ -157,6 +194,17 @@ public:
     //! is chosen.
     double computeFromArrays(std::vector<double> sim_data, std::vector<double> exp_data,
                              std::vector<double> weight_factors) const override;
+
+#ifndef SWIG
+    double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                      const std::vector<float>& exp_data,
+                                      const std::vector<float>& uncertainties,
+                                      const std::vector<float>& weight_factors) const override;
+
+    double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                      const std::vector<float>& exp_data,
+                                      const std::vector<float>& weight_factors) const override;
+#endif
 };
 
 //! Implementation of relative difference metric.
@@ -181,6 +229,14 @@ public:
     //! is chosen.
     double computeFromArrays(std::vector<double> sim_data, std::vector<double> exp_data,
                              std::vector<double> weight_factors) const override;
+
+#ifndef SWIG
+    using Chi2Metric::computeFromSinglePrecision;
+
+    double computeFromSinglePrecision(const std::vector<double>& sim_data,
+                                      const std::vector<float>& exp_data,
+                                      const std::vector<float>& weight_factors) const override;
+#endif
 };
 
 //! Implementation of relative difference metric.
@@ -33,6 +33,19 @@ std::unique_ptr<OutputData<double>> initUserWeights(const OutputData<double>& sh
     result->setAllTo(value);
     return result;
 }
+
+std::vector<float> singlePrecisionValues(const SimulationResult& result)
+{
+    std::vector<float> values(result.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<float>(result[i]);
+    return values;
+}
+
+std::vector<double> doublePrecisionValues(const std::vector<float>& values)
+{
+    return std::vector<double>(values.begin(), values.end());
+}
 }
 
 SimDataPair::SimDataPair(simulation_builder_t builder, const OutputData<double>& data,
@@ -65,6 +78,9 @@ SimDataPair::SimDataPair(SimDataPair&& other)
     , m_exp_data(std::move(other.m_exp_data))
     , m_uncertainties(std::move(other.m_uncertainties))
     , m_user_weights(std::move(other.m_user_weights))
+    , m_exp_values(std::move(other.m_exp_values))
+    , m_uncertainty_values(std::move(other.m_uncertainty_values))
+    , m_weight_values(std::move(other.m_weight_values))
     , m_raw_data(std::move(other.m_raw_data))
     , m_raw_uncertainties(std::move(other.m_raw_uncertainties))
     , m_raw_user_weights(std::move(other.m_raw_user_weights))
@@ -85,7 +101,7 @@ void SimDataPair::runSimulation(const Fit::Parameters& params)
 
 bool SimDataPair::containsUncertainties() const
 {
-    return static_cast<bool>(m_raw_uncertainties);
+    return m_raw_uncertainties || !m_uncertainty_values.empty();
 }
 
 size_t SimDataPair::numberOfFitElements() const
@@ -102,6 +118,8 @@ SimulationResult SimDataPair::simulationResult() const
 
 SimulationResult SimDataPair::experimentalData() const
 {
+    if (singlePrecision())
+        return resultFromValues(m_exp_values);
     if (m_exp_data.size() == 0)
         throwInitializationException("experimentalData");
     return m_exp_data;
@@ -109,6 +127,8 @@ SimulationResult SimDataPair::experimentalData() const
 
 SimulationResult SimDataPair::uncertainties() const
 {
+    if (singlePrecision())
+        return resultFromValues(m_uncertainty_values);
     if (m_uncertainties.size() == 0)
         throwInitializationException("uncertainties");
     return m_uncertainties;
@@ -117,6 +137,8 @@ SimulationResult SimDataPair::uncertainties() const
 //! Returns the user uncertainties cut to the ROI area.
 SimulationResult SimDataPair::userWeights() const
 {
+    if (singlePrecision())
+        return resultFromValues(m_weight_values);
     if (m_user_weights.size() == 0)
         throwInitializationException("userWeights");
     return m_user_weights;
@@ -126,30 +148,32 @@ SimulationResult SimDataPair::userWeights() const
 
 SimulationResult SimDataPair::relativeDifference() const
 {
-    if (m_sim_data.size() == 0 || m_exp_data.size() == 0)
+    if (m_sim_data.size() == 0 || (m_exp_data.size() == 0 && !singlePrecision()))
         throwInitializationException("relativeDifference");
 
     SimulationResult result = m_sim_data;
     for (size_t i = 0, size = result.size(); i < size; ++i)
-        result[i] = Numeric::GetRelativeDifference(result[i], m_exp_data[i]);
+        result[i] = Numeric::GetRelativeDifference(result[i], experimentalValue(i));
 
     return result;
 }
 
 SimulationResult SimDataPair::absoluteDifference() const
 {
-    if (m_sim_data.size() == 0 || m_exp_data.size() == 0)
+    if (m_sim_data.size() == 0 || (m_exp_data.size() == 0 && !singlePrecision()))
         throwInitializationException("absoluteDifference");
 
     SimulationResult result = m_sim_data;
     for (size_t i = 0, size = result.size(); i < size; ++i)
-        result[i] = Numeric::GetAbsoluteDifference(result[i], m_exp_data[i]);
+        result[i] = Numeric::GetAbsoluteDifference(result[i], experimentalValue(i));
 
     return result;
 }
 
 std::vector<double> SimDataPair::experimental_array() const
 {
+    if (singlePrecision())
+        return doublePrecisionValues(m_exp_values);
     if (m_exp_data.size() == 0)
         throwInitializationException("experimental_array");
     return m_exp_data.data()->getRawDataVector();
@@ -164,6 +188,9 @@ std::vector<double> SimDataPair::simulation_array() const
 
 std::vector<double> SimDataPair::uncertainties_array() const
 {
+    if (singlePrecision())
+        return m_uncertainty_values.empty() ? std::vector<double>(m_exp_values.size(), 0.0)
+                                            : doublePrecisionValues(m_uncertainty_values);
     if (m_uncertainties.size() == 0)
         throwInitializationException("uncertainties_array");
     return m_uncertainties.data()->getRawDataVector();
@@ -171,6 +198,8 @@ std::vector<double> SimDataPair::uncertainties_array() const
 
 std::vector<double> SimDataPair::user_weights_array() const
 {
+    if (singlePrecision())
+        return doublePrecisionValues(m_weight_values);
     if (m_user_weights.size() == 0)
         throwInitializationException("user_weights_array");
     return m_user_weights.data()->getRawDataVector();
@@ -178,6 +207,15 @@ std::vector<double> SimDataPair::user_weights_array() const
 
 void SimDataPair::initResultArrays()
 {
+    if (singlePrecision()) {
+        if (m_sim_data.size() != m_exp_values.size())
+            throw std::runtime_error(
+                "Error in SimDataPair::initResultArrays: the fit area of the simulation differs "
+                "from the one of the single-precision data. The data passed by the user were "
+                "released and cannot be converted to the new fit area.");
+        return;
+    }
+
     if (m_exp_data.size() != 0 && m_uncertainties.size() != 0 && m_user_weights.size() != 0)
         return;
 
@@ -197,6 +235,33 @@ void SimDataPair::initResultArrays()
     }
 
     m_user_weights = IntensityDataFunctions::ConvertData(*m_simulation, *m_raw_user_weights, true);
+
+    if (!m_simulation->getOptions().useSinglePrecisionData() || m_exp_data.size() == 0)
+        return;
+    m_exp_values = singlePrecisionValues(m_exp_data);
+    if (containsUncertainties())
+        m_uncertainty_values = singlePrecisionValues(m_uncertainties);
+    m_weight_values = singlePrecisionValues(m_user_weights);
+    m_exp_data = SimulationResult();
+    m_uncertainties = SimulationResult();
+    m_user_weights = SimulationResult();
+    // the values are not converted again, so that the raw data are no longer needed
+    m_raw_data.reset();
+    m_raw_uncertainties.reset();
+    m_raw_user_weights.reset();
+}
+
+double SimDataPair::experimentalValue(size_t i) const
+{
+    return singlePrecision() ? m_exp_values[i] : m_exp_data[i];
+}
+
+SimulationResult SimDataPair::resultFromValues(const std::vector<float>& values) const
+{
+    SimulationResult result = m_sim_data;
+    for (size_t i = 0, size = result.size(); i < size; ++i)
+        result[i] = values.empty() ? 0.0 : values[i];
+    return result;
 }
 
 void SimDataPair::validate() const
@@ -204,6 +269,16 @@ void SimDataPair::validate() const
     if (!m_simulation_builder)
         throw std::runtime_error("Error in SimDataPair: simulation builder is empty");
 
+    // the raw data are released once the data are held in single precision
+    if (singlePrecision()) {
+        if (m_weight_values.size() != m_exp_values.size()
+            || (!m_uncertainty_values.empty()
+                && m_uncertainty_values.size() != m_exp_values.size()))
+            throw std::runtime_error("Error in SimDataPair: single-precision data, uncertainties "
+                                     "and user weights have different sizes");
+        return;
+    }
+
     if (!m_raw_data)
         throw std::runtime_error("Error in SimDataPair: passed experimental data array is empty");
 
@@ -17,6 +17,7 @@
 
 #include "FitTypes.h"
 #include "SimulationResult.h"
+#include <vector>
 
 template<class T> class OutputData;
 
@@ -93,9 +94,30 @@ public:
     //! cut to the ROI area.
     std::vector<double> user_weights_array() const;
 
+#ifndef SWIG
+    //! Returns true if the experimental data, uncertainties and user weights are held in
+    //! single precision (see SimulationOptions::setSinglePrecisionData)
+    bool singlePrecision() const { return !m_exp_values.empty(); }
+
+    //! Returns the single-precision experimental data cut to the ROI area, without copying.
+    //! Empty unless the data are held in single precision.
+    const std::vector<float>& experimentalValues() const { return m_exp_values; }
+
+    //! Returns the single-precision uncertainties cut to the ROI area, without copying.
+    //! Empty unless the data are held in single precision and uncertainties were provided.
+    const std::vector<float>& uncertaintyValues() const { return m_uncertainty_values; }
+
+    //! Returns the single-precision user weights cut to the ROI area, without copying.
+    //! Empty unless the data are held in single precision.
+    const std::vector<float>& userWeightValues() const { return m_weight_values; }
+#endif
+
 private:
     void initResultArrays();
     void validate() const;
+    double experimentalValue(size_t i) const;
+    //! Returns a result shaped like the simulation result, holding the given values
+    SimulationResult resultFromValues(const std::vector<float>& values) const;
 
     //! Simulation builder from the user to construct simulation for given set of parameters.
     simulation_builder_t m_simulation_builder;
@@ -112,7 +134,17 @@ private:
     //! Manually defined (user) weights. Masked areas are nullified.
     SimulationResult m_user_weights;
 
-    //! Raw experimental data as obtained from the user.
+    //! Experimental data, uncertainties and user weights in single precision, held instead of
+    //! the three results above and of the raw data below if the simulation options ask for it.
+    //! Uncertainties are only held if they were provided. Only these arrays are stored in
+    //! single precision; the simulated intensities stay in double precision.
+    std::vector<float> m_exp_values;
+    std::vector<float> m_uncertainty_values;
+    std::vector<float> m_weight_values;
+
+    //! Raw experimental data as obtained from the user. The raw data are released once the
+    //! data are held in single precision, so that the pair cannot be converted again to
+    //! another fit area: later simulations must keep the fit area of the first one.
     std::unique_ptr<OutputData<double>> m_raw_data;
     //! Data uncertainties as provided by the user
     std::unique_ptr<OutputData<double>> m_raw_uncertainties;
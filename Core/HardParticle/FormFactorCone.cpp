@@ -16,6 +16,7 @@
 #include "BornAgainNamespace.h"
 #include "DoubleEllipse.h"
 #include "Exceptions.h"
+#include "GaussLegendre.h"
 #include "MathFunctions.h"
 #include "MathConstants.h"
 #include "RealParameter.h"
@@ -46,22 +47,19 @@ FormFactorCone::FormFactorCone(double radius, double height, double alpha)
     registerParameter(BornAgain::Alpha, &m_alpha).setUnit(BornAgain::UnitsRad)
         .setLimited(0., M_PI_2);
 
-    mP_integrator = make_integrator_complex(this, &FormFactorCone::Integrand);
     onChange();
 }
 
 //! Integrand for complex formfactor.
-complex_t FormFactorCone::Integrand(double Z) const
+complex_t FormFactorCone::Integrand(double Z, complex_t q_p, complex_t q_z) const
 {
     double Rz = m_radius - Z*m_cot_alpha;
-    complex_t q_p = std::sqrt(m_q.x()*m_q.x()+m_q.y()*m_q.y()); // sqrt(x*x + y*y)
-    return Rz*Rz*MathFunctions::Bessel_J1c(q_p*Rz) * exp_I(m_q.z()*Z);
+    return Rz*Rz*MathFunctions::Bessel_J1c(q_p*Rz) * exp_I(q_z*Z);
 }
 
 complex_t FormFactorCone::evaluate_for_q(cvector_t q) const
 {
-    m_q = q;
-    if ( std::abs(m_q.mag()) < std::numeric_limits<double>::epsilon()) {
+    if ( std::abs(q.mag()) < std::numeric_limits<double>::epsilon()) {
         double R = m_radius;
         double H = m_height;
         if (m_cot_alpha==0.0)
@@ -70,7 +68,10 @@ complex_t FormFactorCone::evaluate_for_q(cvector_t q) const
         double apex_height = R/m_cot_alpha;
         return M_PI/3.*(R*R*H +(R*R - R2*R2)*(apex_height-H));
     } else {
-        complex_t integral = mP_integrator->integrate(0., m_height);
+        complex_t q_p = std::sqrt(q.x()*q.x()+q.y()*q.y()); // sqrt(x*x + y*y)
+        double phase = std::abs(q.z())*m_height + std::abs(q_p)*m_height*m_cot_alpha;
+        complex_t integral = GaussLegendre::integrate(
+            [&](double Z) { return Integrand(Z, q_p, q.z()); }, 0., m_height, phase);
         return M_TWOPI*integral;
     }
 }
@@ -16,10 +16,6 @@
 #define FORMFACTORCONE_H
 
 #include "IFormFactorBorn.h"
-#include "IntegratorComplex.h"
-
-// Forward declaration to prevent IntegratorComplex.h to be parsed for Python API:
-template <class T> class IntegratorComplex;
 
 //! A conical frustum (cone truncated parallel to the base) with circular base.
 //! @ingroup hardParticle
@@ -48,17 +44,12 @@ protected:
     void onChange() override final;
 
 private:
-    complex_t Integrand(double Z) const;
+    complex_t Integrand(double Z, complex_t q_p, complex_t q_z) const;
 
     double m_radius;
     double m_height;
     double m_alpha;
     double m_cot_alpha;
-    mutable cvector_t m_q;
-
-#ifndef SWIG
-    std::unique_ptr<IntegratorComplex<FormFactorCone>> mP_integrator;
-#endif
 };
 
 #endif // FORMFACTORCONE_H
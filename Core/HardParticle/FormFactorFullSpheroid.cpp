@@ -14,6 +14,7 @@
 
 #include "FormFactorFullSpheroid.h"
 #include "BornAgainNamespace.h"
+#include "GaussLegendre.h"
 #include "FormFactorTruncatedSpheroid.h"
 #include "MathFunctions.h"
 #include "MathConstants.h"
@@ -30,34 +31,41 @@ FormFactorFullSpheroid::FormFactorFullSpheroid(double radius, double height )
     setName(BornAgain::FFFullSpheroidType);
     registerParameter(BornAgain::Radius, &m_radius).setUnit(BornAgain::UnitsNm).setNonnegative();
     registerParameter(BornAgain::Height, &m_height).setUnit(BornAgain::UnitsNm).setNonnegative();
-    mP_integrator = make_integrator_complex(this, &FormFactorFullSpheroid::Integrand);
     onChange();
 }
 
-//! Integrand for complex formfactor.
-complex_t FormFactorFullSpheroid::Integrand(double Z) const
+//! Integrand for the difference between the complex formfactor and the volume, as function
+//! of the polar angle theta of the surface point at Z = H/2*cos(theta), Rz = R*sin(theta).
+//! Unlike the integrand in Z, it is free of the square-root behaviour at the poles, and
+//! therefore suited for Gauss-Legendre quadrature; subtracting the volume keeps the
+//! quadrature error relative to the formfactor at small q.
+complex_t FormFactorFullSpheroid::Integrand(double theta, complex_t q_p, complex_t q_z) const
 {
     double R = m_radius;
     double H = m_height;
 
-    double Rz  = R*std::sqrt(1-4.0*Z*Z/(H*H));
-    complex_t qxy = std::sqrt(m_q.x()*m_q.x()+m_q.y()*m_q.y());
-    complex_t qrRz = qxy*Rz;
+    double Z = H/2.0*std::cos(theta);
+    double Rz = R*std::sin(theta);
+    complex_t qrRz = q_p*Rz;
     complex_t J1_qrRz_div_qrRz = MathFunctions::Bessel_J1c(qrRz);
 
-    return Rz*Rz* J1_qrRz_div_qrRz *std::cos(m_q.z()*Z);
+    return Rz*Rz* (J1_qrRz_div_qrRz *std::cos(q_z*Z) - 0.5) * H/2.0*std::sin(theta);
 }
 
 complex_t FormFactorFullSpheroid::evaluate_for_q(cvector_t q) const
 {
     double H = m_height;
     double R = m_radius;
-    m_q = q;
 
-    if (std::abs(m_q.mag()) <= std::numeric_limits<double>::epsilon())
-        return M_TWOPI*R*R*H/3.;
+    double volume = M_TWOPI*R*R*H/3.;
+    if (std::abs(q.mag()) <= std::numeric_limits<double>::epsilon())
+        return volume;
+    complex_t q_p = std::sqrt(q.x()*q.x()+q.y()*q.y());
+    double phase = (std::abs(q.z())*H/2.0 + std::abs(q_p)*R)*M_PI_2;
     complex_t qzH_half = H/2*q.z();
-    return 4 * M_PI * mP_integrator->integrate(0.0, H/2.0) * exp_I(qzH_half);
+    complex_t integral = GaussLegendre::integrate(
+        [&](double theta) { return Integrand(theta, q_p, q.z()); }, 0.0, M_PI_2, phase);
+    return (volume + 4 * M_PI * integral) * exp_I(qzH_half);
 }
 
 IFormFactor*FormFactorFullSpheroid:: sliceFormFactor(ZLimits limits, const IRotation& rot,
@@ -16,7 +16,6 @@
 #define FORMFACTORFULLSPHEROID_H
 
 #include "IFormFactorBorn.h"
-#include "IntegratorComplex.h"
 
 //! A full spheroid (an ellipsoid with two equal axes, hence with circular cross section)
 //! @ingroup hardParticle
@@ -44,15 +43,10 @@ protected:
     void onChange() override final;
 
 private:
-    complex_t Integrand(double Z) const;
+    complex_t Integrand(double theta, complex_t q_p, complex_t q_z) const;
 
     double m_radius;
     double m_height;
-    mutable cvector_t m_q;
-
-#ifndef SWIG
-    std::unique_ptr<IntegratorComplex<FormFactorFullSpheroid>> mP_integrator;
-#endif
 };
 
 #endif // FORMFACTORFULLSPHEROID_H
@@ -14,6 +14,7 @@
 
 #include "FormFactorHemiEllipsoid.h"
 #include "BornAgainNamespace.h"
+#include "GaussLegendre.h"
 #include "MathFunctions.h"
 #include "MathConstants.h"
 #include "RealParameter.h"
@@ -34,7 +35,6 @@ FormFactorHemiEllipsoid::FormFactorHemiEllipsoid(double radius_x, double radius_
         .setNonnegative();
     registerParameter(BornAgain::Height, &m_height).setUnit(BornAgain::UnitsNm)
         .setNonnegative();
-    mP_integrator = make_integrator_complex(this, &FormFactorHemiEllipsoid::Integrand);
     onChange();
 }
 
@@ -43,35 +43,40 @@ double FormFactorHemiEllipsoid::radialExtension() const
     return ( m_radius_x + m_radius_y ) / 2.0;
 }
 
-//! Integrand for complex formfactor.
-complex_t FormFactorHemiEllipsoid::Integrand(double Z) const
+//! Integrand for the difference between the complex formfactor and the volume, as function
+//! of the polar angle theta of the surface point at Z = H*cos(theta), Rz = R*sin(theta),
+//! Wz = W*sin(theta).
+complex_t FormFactorHemiEllipsoid::Integrand(double theta, cvector_t q) const
 {
     double R = m_radius_x;
     double W = m_radius_y;
     double H = m_height;
 
-    double Rz = R * std::sqrt(1.0 - Z*Z/(H*H));
-    double Wz = W * std::sqrt(1.0 - Z*Z/(H*H));
+    double Z = H * std::cos(theta);
+    double Rz = R * std::sin(theta);
+    double Wz = W * std::sin(theta);
 
-    complex_t qxRz = m_q.x()*Rz;
-    complex_t qyWz = m_q.y()*Wz;
+    complex_t qxRz = q.x()*Rz;
+    complex_t qyWz = q.y()*Wz;
 
     complex_t gamma = std::sqrt(qxRz*qxRz + qyWz*qyWz);
     complex_t J1_gamma_div_gamma = MathFunctions::Bessel_J1c(gamma);
 
-    return Rz * Wz * J1_gamma_div_gamma * exp_I(m_q.z()*Z);
+    return Rz * Wz * (J1_gamma_div_gamma * exp_I(q.z()*Z) - 0.5) * H * std::sin(theta);
 }
 
 complex_t FormFactorHemiEllipsoid::evaluate_for_q(cvector_t q) const
 {
-     m_q = q;
      double R = m_radius_x;
      double W = m_radius_y;
      double H = m_height;
 
-     if (std::abs(m_q.mag()) <= std::numeric_limits<double>::epsilon())
-         return M_TWOPI*R*W*H/3.;
-     return M_TWOPI*mP_integrator->integrate(0.,H );
+     double volume = M_TWOPI*R*W*H/3.;
+     if (std::abs(q.mag()) <= std::numeric_limits<double>::epsilon())
+         return volume;
+     double phase = (std::abs(q.z())*H + std::abs(q.x())*R + std::abs(q.y())*W)*M_PI_2;
+     return volume + M_TWOPI*GaussLegendre::integrate(
+         [&](double theta) { return Integrand(theta, q); }, 0., M_PI_2, phase);
 }
 
 void FormFactorHemiEllipsoid::onChange()
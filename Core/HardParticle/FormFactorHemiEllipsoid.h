@@ -16,7 +16,6 @@
 #define FORMFACTORHEMIELLIPSOID_H
 
 #include "IFormFactorBorn.h"
-#include "IntegratorComplex.h"
 
 //! An hemi ellipsoid,
 //!   obtained by truncating a full ellipsoid in the middle plane spanned by two principal axes.
@@ -44,16 +43,11 @@ protected:
     void onChange() override final;
 
 private:
-    complex_t Integrand(double Z) const;
+    complex_t Integrand(double theta, cvector_t q) const;
 
     double m_radius_x;
     double m_radius_y;
     double m_height;
-    mutable cvector_t m_q;
-
-#ifndef SWIG
-    std::unique_ptr<IntegratorComplex<FormFactorHemiEllipsoid>> mP_integrator;
-#endif
 };
 
 #endif // FORMFACTORHEMIELLIPSOID_H
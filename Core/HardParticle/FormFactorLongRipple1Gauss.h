@@ -16,7 +16,6 @@
 #define FORMFACTORLONGRIPPLE1GAUSS_H
 
 #include "IFormFactorBorn.h"
-#include "IntegratorComplex.h"
 
 //! The formfactor for a cosine ripple.
 //! @ingroup legacyGrating
@@ -46,18 +45,12 @@ protected:
     void onChange() override final;
 
 private:
-    complex_t Integrand(double u) const;
+    complex_t Integrand(double u, complex_t ay, complex_t az) const;
     bool check_initialization() const;
 
     double m_length;
     double m_width;
     double m_height;
-    mutable complex_t m_ay;
-    mutable complex_t m_az;
-
-#ifndef SWIG
-    std::unique_ptr<IntegratorComplex<FormFactorLongRipple1Gauss>> mP_integrator;
-#endif
 };
 
 #endif // FORMFACTORLONGRIPPLE1GAUSS_H
@@ -16,6 +16,7 @@
 #include "BornAgainNamespace.h"
 #include "Box.h"
 #include "Exceptions.h"
+#include "GaussLegendre.h"
 #include "MathFunctions.h"
 #include "MathConstants.h"
 #include "RealParameter.h"
@@ -29,7 +30,6 @@ FormFactorLongRipple1Lorentz::FormFactorLongRipple1Lorentz(
     registerParameter(BornAgain::Length, &m_length).setUnit(BornAgain::UnitsNm).setNonnegative();
     registerParameter(BornAgain::Width, &m_width).setUnit(BornAgain::UnitsNm).setNonnegative();
     registerParameter(BornAgain::Height, &m_height).setUnit(BornAgain::UnitsNm).setNonnegative();
-    mP_integrator = make_integrator_complex(this, &FormFactorLongRipple1Lorentz::Integrand);
     onChange();
 }
 
@@ -54,9 +54,9 @@ double FormFactorLongRipple1Lorentz::radialExtension() const
 }
 
 //! Integrand for complex formfactor.
-complex_t FormFactorLongRipple1Lorentz::Integrand(double u) const
+complex_t FormFactorLongRipple1Lorentz::Integrand(double u, complex_t ay, complex_t az) const
 {
-    return sin(u) * exp(m_az*std::cos(u)) * ( m_ay==0. ? u : sin(m_ay*u)/m_ay );
+    return sin(u) * exp(az*std::cos(u)) * ( ay==0. ? u : sin(ay*u)/ay );
 }
 
 //! Complex formfactor.
@@ -77,10 +77,12 @@ complex_t FormFactorLongRipple1Lorentz::evaluate_for_q(cvector_t q) const
     }
 
     // numerical integration otherwise
-    m_ay = q.y() * m_width / M_TWOPI;
-    m_az = complex_t(0,1) * q.z() * (m_height/2);
-    complex_t integral = mP_integrator->integrate(0, M_PI);
-    return factor * integral * exp(m_az) * (m_height/2);
+    complex_t ay = q.y() * m_width / M_TWOPI;
+    complex_t az = complex_t(0,1) * q.z() * (m_height/2);
+    double phase = 2.0*std::abs(az) + M_PI*std::abs(ay) + M_PI;
+    complex_t integral = GaussLegendre::integrate(
+        [&](double u) { return Integrand(u, ay, az); }, 0, M_PI, phase);
+    return factor * integral * exp(az) * (m_height/2);
 }
 
 void FormFactorLongRipple1Lorentz::onChange()
@@ -72,8 +72,6 @@ double FormFactorLongRipple2Gauss::radialExtension() const
 //! Complex formfactor.
 complex_t FormFactorLongRipple2Gauss::evaluate_for_q(cvector_t q) const
 {
-    m_q = q;
-
     complex_t qxL2 = std::pow(m_length * q.x(), 2) / 2.0;
     complex_t factor = m_length * std::exp(-qxL2) * m_width;
     complex_t result = 0;
@@ -54,7 +54,6 @@ private:
     double m_height;
     double m_length;
     double m_d;
-    mutable cvector_t m_q;
 };
 
 #endif // FORMFACTORLONGRIPPLE2GAUSS_H
@@ -74,8 +74,6 @@ complex_t FormFactorLongRipple2Lorentz::evaluate_for_q(cvector_t q) const
 {
     check_parameters();
 
-    m_q = q;
-
     complex_t qxL2 = 2.5*std::pow(m_length * q.x(), 2);
     complex_t factor = m_length / (1.0 + qxL2) * m_width;
 
@@ -48,7 +48,6 @@ private:
     double m_width;
     double m_height;
     double m_d;
-    mutable cvector_t m_q;
 };
 
 #endif // FORMFACTORLONGRIPPLE2LORENTZ_H
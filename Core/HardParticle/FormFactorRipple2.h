@@ -47,7 +47,6 @@ private:
     double m_width;
     double m_height;
     double m_d;
-    mutable cvector_t m_q;
 };
 
 #endif // FORMFACTORRIPPLE2_H
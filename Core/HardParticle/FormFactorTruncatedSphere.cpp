@@ -15,6 +15,7 @@
 #include "FormFactorTruncatedSphere.h"
 #include "BornAgainNamespace.h"
 #include "Exceptions.h"
+#include "GaussLegendre.h"
 #include "RealLimits.h"
 #include "MathFunctions.h"
 #include "MathConstants.h"
@@ -36,7 +37,6 @@ FormFactorTruncatedSphere::FormFactorTruncatedSphere(double radius, double heigh
     registerParameter(BornAgain::Radius, &m_radius).setUnit(BornAgain::UnitsNm).setNonnegative();
     registerParameter(BornAgain::Height, &m_height).setUnit(BornAgain::UnitsNm).setNonnegative();
     registerParameter(BornAgain::DeltaHeight, &m_dh).setUnit(BornAgain::UnitsNm).setNonnegative();
-    mP_integrator = make_integrator_complex(this, &FormFactorTruncatedSphere::Integrand);
     onChange();
 }
 
@@ -54,27 +54,31 @@ bool FormFactorTruncatedSphere::check_initialization() const
     return result;
 }
 
-//! Integrand for complex formfactor.
-complex_t FormFactorTruncatedSphere::Integrand(double Z) const
+//! Integrand for the difference between the complex formfactor and the volume, as function
+//! of the polar angle theta of the surface point at Z = R*cos(theta), Rz = R*sin(theta).
+complex_t FormFactorTruncatedSphere::Integrand(double theta, complex_t q_p, complex_t q_z) const
 {
-    double Rz = std::sqrt(m_radius*m_radius-Z*Z );
-    complex_t qx = m_q.x();
-    complex_t qy = m_q.y();
-    complex_t q_p = std::sqrt(qx*qx + qy*qy); // NOT the modulus!
-    return Rz*Rz*MathFunctions::Bessel_J1c(q_p*Rz) * exp_I(m_q.z()*Z);
+    double Z = m_radius*std::cos(theta);
+    double Rz = m_radius*std::sin(theta);
+    return Rz*Rz*(MathFunctions::Bessel_J1c(q_p*Rz) * exp_I(q_z*Z) - 0.5) * Rz;
 }
 
 //! Complex formfactor.
 complex_t FormFactorTruncatedSphere::evaluate_for_q(cvector_t q) const
 {
-    m_q = q;
-    if ( std::abs(q.mag()) < std::numeric_limits<double>::epsilon()) {
-        return M_PI/3.*(  m_height*m_height*(3.*m_radius - m_height)
-                        - m_dh*m_dh*(3.*m_radius - m_dh) );
-    }
+    double volume = M_PI/3.*(  m_height*m_height*(3.*m_radius - m_height)
+                             - m_dh*m_dh*(3.*m_radius - m_dh) );
+    if ( std::abs(q.mag()) < std::numeric_limits<double>::epsilon())
+        return volume;
     // else
-    complex_t integral = mP_integrator->integrate(m_radius-m_height, m_radius - m_dh);
-    return M_TWOPI * integral * exp_I(q.z()*(m_height-m_radius));
+    complex_t q_p = std::sqrt(q.x()*q.x() + q.y()*q.y()); // NOT the modulus!
+    double theta_top = std::acos((m_radius - m_dh)/m_radius);
+    double theta_bottom = std::acos((m_radius - m_height)/m_radius);
+    double phase = (std::abs(q.z()) + std::abs(q_p))*m_radius*(theta_bottom - theta_top);
+    complex_t integral = GaussLegendre::integrate(
+        [&](double theta) { return Integrand(theta, q_p, q.z()); },
+        theta_top, theta_bottom, phase);
+    return (volume + M_TWOPI * integral) * exp_I(q.z()*(m_height-m_radius));
 }
 
 IFormFactor* FormFactorTruncatedSphere::sliceFormFactor(ZLimits limits, const IRotation& rot,
@@ -16,7 +16,6 @@
 #define FORMFACTORTRUNCATEDSPHERE_H
 
 #include "IFormFactorBorn.h"
-#include "IntegratorComplex.h"
 
 //! A truncated Sphere.
 //! @ingroup hardParticle
@@ -46,16 +45,11 @@ protected:
 
 private:
     bool check_initialization() const;
-    complex_t Integrand(double Z) const;
+    complex_t Integrand(double theta, complex_t q_p, complex_t q_z) const;
 
     double m_radius;
     double m_height;
     double m_dh;
-    mutable cvector_t m_q;
-
-#ifndef SWIG
-    std::unique_ptr<IntegratorComplex<FormFactorTruncatedSphere>> mP_integrator;
-#endif
 };
 
 #endif // FORMFACTORTRUNCATEDSPHERE_H
@@ -15,6 +15,7 @@
 #include "FormFactorTruncatedSpheroid.h"
 #include "BornAgainNamespace.h"
 #include "Exceptions.h"
+#include "GaussLegendre.h"
 #include "MathFunctions.h"
 #include "MathConstants.h"
 #include "RealParameter.h"
@@ -39,7 +40,6 @@ FormFactorTruncatedSpheroid::FormFactorTruncatedSpheroid(
     registerParameter(BornAgain::Height, &m_height).setUnit(BornAgain::UnitsNm).setNonnegative();
     registerParameter(BornAgain::HeightFlattening, &m_height_flattening).setNonnegative();
     registerParameter(BornAgain::DeltaHeight, &m_dh).setUnit(BornAgain::UnitsNm).setNonnegative();
-    mP_integrator = make_integrator_complex(this, &FormFactorTruncatedSpheroid::Integrand);
     onChange();
 }
 
@@ -59,17 +59,19 @@ bool FormFactorTruncatedSpheroid::check_initialization() const
     return result;
 }
 
-//! Integrand for complex formfactor.
-complex_t FormFactorTruncatedSpheroid::Integrand(double Z) const
+//! Integrand for the difference between the complex formfactor and the volume, as function
+//! of the polar angle theta of the surface point at Z = fp*R*cos(theta), Rz = R*sin(theta).
+complex_t FormFactorTruncatedSpheroid::Integrand(double theta, complex_t q_p, complex_t q_z) const
 {
     double R = m_radius;
     double fp = m_height_flattening;
 
-    double Rz  = std::sqrt(R*R-Z*Z/(fp*fp));
-    complex_t qrRz = std::sqrt(m_q.x()*m_q.x()+m_q.y()*m_q.y())*Rz;
+    double Z = fp*R*std::cos(theta);
+    double Rz  = R*std::sin(theta);
+    complex_t qrRz = q_p*Rz;
     complex_t J1_qrRz_div_qrRz = MathFunctions::Bessel_J1c(qrRz);
 
-    return Rz * Rz * J1_qrRz_div_qrRz * std::exp(complex_t(0.0,1.0)*m_q.z()*Z);
+    return Rz * Rz * (J1_qrRz_div_qrRz * std::exp(complex_t(0.0,1.0)*q_z*Z) - 0.5) * fp*Rz;
 }
 
 complex_t FormFactorTruncatedSpheroid::evaluate_for_q(cvector_t q) const
@@ -77,12 +79,18 @@ complex_t FormFactorTruncatedSpheroid::evaluate_for_q(cvector_t q) const
     double H = m_height;
     double R = m_radius;
     double fp = m_height_flattening;
-    m_q = q;
 
-    if (std::abs(m_q.mag()) <= std::numeric_limits<double>::epsilon())
-        return M_PI/3./fp*( H*H*(3.*R-H/fp) - m_dh*m_dh*(3.*R-m_dh/fp));
-    complex_t z_part    =  std::exp(complex_t(0.0, 1.0)*m_q.z()*(H-fp*R));
-    return M_TWOPI * z_part *mP_integrator->integrate(fp*R-H,fp*R-m_dh );
+    double volume = M_PI/3./fp*( H*H*(3.*R-H/fp) - m_dh*m_dh*(3.*R-m_dh/fp));
+    if (std::abs(q.mag()) <= std::numeric_limits<double>::epsilon())
+        return volume;
+    complex_t q_p = std::sqrt(q.x()*q.x()+q.y()*q.y());
+    double theta_top = std::acos((fp*R-m_dh)/(fp*R));
+    double theta_bottom = std::acos((fp*R-H)/(fp*R));
+    double phase = (std::abs(q.z())*fp + std::abs(q_p))*R*(theta_bottom - theta_top);
+    complex_t z_part    =  std::exp(complex_t(0.0, 1.0)*q.z()*(H-fp*R));
+    return z_part * (volume + M_TWOPI * GaussLegendre::integrate(
+        [&](double theta) { return Integrand(theta, q_p, q.z()); },
+        theta_top, theta_bottom, phase));
 }
 
 IFormFactor* FormFactorTruncatedSpheroid::sliceFormFactor(ZLimits limits, const IRotation& rot,
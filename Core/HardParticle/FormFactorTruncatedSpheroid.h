@@ -16,7 +16,6 @@
 #define FORMFACTORTRUNCATEDSPHEROID_H
 
 #include "IFormFactorBorn.h"
-#include "IntegratorComplex.h"
 
 //! A truncated spheroid.
 //! An ellipsoid with two equal axis, truncated by a plane perpendicular to the third axis.
@@ -49,17 +48,12 @@ protected:
 
 private:
     bool check_initialization() const;
-    complex_t Integrand(double Z) const;
+    complex_t Integrand(double theta, complex_t q_p, complex_t q_z) const;
 
     double m_radius;
     double m_height;
     double m_height_flattening;
     double m_dh;
-    mutable cvector_t m_q;
-
-#ifndef SWIG
-    std::unique_ptr<IntegratorComplex<FormFactorTruncatedSpheroid>> mP_integrator;
-#endif
 };
 
 #endif // FORMFACTORTRUNCATEDSPHEROID_H
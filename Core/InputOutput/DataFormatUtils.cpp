@@ -19,6 +19,7 @@
 #include "PointwiseAxis.h"
 #include "OutputData.h"
 #include "StringUtils.h"
+#include <cstdint>
 #include <iterator>
 #include <iostream>
 
@@ -43,6 +44,8 @@ const std::string BzipExtension = ".bz2";
 const std::string IntExtension = ".int";
 const std::string TiffExtension = ".tif";
 const std::string TiffExtension2 = ".tiff";
+const std::string BinaryExtension = ".bab";
+const std::string SinglePrecisionBinaryExtension = ".babf";
 }
 
 bool DataFormatUtils::isCompressed(const std::string& name)
@@ -87,6 +90,23 @@ bool DataFormatUtils::isTiffFile(const std::string& file_name)
             GetFileMainExtension(file_name) == TiffExtension2 );
 }
 
+bool DataFormatUtils::isBinaryFile(const std::string& file_name)
+{
+    return (GetFileMainExtension(file_name) == BinaryExtension ||
+            isSinglePrecisionBinaryFile(file_name));
+}
+
+bool DataFormatUtils::isSinglePrecisionBinaryFile(const std::string& file_name)
+{
+    return GetFileMainExtension(file_name) == SinglePrecisionBinaryExtension;
+}
+
+bool DataFormatUtils::isLittleEndian()
+{
+    const uint16_t probe = 1;
+    return *reinterpret_cast<const unsigned char*>(&probe) == 1;
+}
+
 //! Creates axis of certain type from input stream
 std::unique_ptr<IAxis> DataFormatUtils::createAxis(std::istream& input_stream)
 {
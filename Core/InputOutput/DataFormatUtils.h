@@ -26,6 +26,9 @@ template <class T> class OutputData;
 //! Utility functions for data input and output.
 
 namespace DataFormatUtils {
+//! Signature at the beginning of files in the BornAgain binary format
+const std::string BinarySignature = "BABINARY";
+
 //! Returns true if name contains *.gz extension
 BA_CORE_API_ bool isCompressed(const std::string& name);
 
@@ -44,6 +47,15 @@ BA_CORE_API_ bool isIntFile(const std::string& file_name);
 //! returns true if file name corresponds to tiff file (can be also compressed)
 BA_CORE_API_ bool isTiffFile(const std::string& file_name);
 
+//! returns true if file name corresponds to BornAgain binary format (can be also compressed)
+BA_CORE_API_ bool isBinaryFile(const std::string& file_name);
+
+//! returns true if file name corresponds to BornAgain binary format with single precision
+BA_CORE_API_ bool isSinglePrecisionBinaryFile(const std::string& file_name);
+
+//! Returns true if the native byte order is little-endian, as in the binary format
+BA_CORE_API_ bool isLittleEndian();
+
 BA_CORE_API_ std::unique_ptr<IAxis> createAxis(std::istream& input_stream);
 
 BA_CORE_API_ void fillOutputData(OutputData<double>* data, std::istream& input_stream);
@@ -27,6 +27,8 @@ class SimulationResult;
 //! *.txt - ASCII file with 2D array [nrow][ncol], layout as in numpy.
 //! *.int - BornAgain internal ASCII format.
 //! *.tif - 32-bits tiff file.
+//! *.bab - BornAgain binary format with double precision values.
+//! *.babf - BornAgain binary format with single precision values.
 //! If file name ends woth "*.gz" or "*.bz2" the file will be zipped on the fly using
 //! appropriate algorithm.
 
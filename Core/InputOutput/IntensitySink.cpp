@@ -0,0 +1,96 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/InputOutput/IntensitySink.cpp
+//! @brief     Implements class IntensityFileSink.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "IntensitySink.h"
+#include "DataFormatUtils.h"
+#include "Exceptions.h"
+#include "FileSystemUtils.h"
+#include "IAxis.h"
+#include "OutputDataWriteStrategy.h"
+#include <algorithm>
+#include <cstring>
+
+IntensityFileSink::IntensityFileSink(const std::string& file_name)
+    : m_file_name(file_name)
+    , m_total_size(0)
+    , m_data_offset(0)
+{}
+
+IntensityFileSink::~IntensityFileSink() = default;
+
+void IntensityFileSink::open(const std::vector<std::unique_ptr<IAxis>>& axes)
+{
+    if (m_stream.is_open())
+        m_stream.close();
+    m_stream.clear();
+#ifdef _WIN32
+    m_stream.open(FileSystemUtils::convert_utf8_to_utf16(m_file_name),
+                  std::ios::out | std::ios::binary | std::ios::trunc);
+#else
+    m_stream.open(m_file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+#endif
+    if (!m_stream.is_open())
+        throw Exceptions::FileNotIsOpenException("IntensityFileSink::open() -> Error. "
+                                                 "Can't open file '" + m_file_name
+                                                 + "' for writing.");
+    std::vector<const IAxis*> header_axes;
+    m_total_size = 1;
+    for (const auto& P_axis : axes) {
+        header_axes.push_back(P_axis.get());
+        m_total_size *= P_axis->size();
+    }
+    m_data_offset =
+        OutputDataWriteBinaryStrategy::writeHeader(header_axes, sizeof(double), m_stream);
+
+    // channels which are never written (e.g. masked ones) have to read as zero
+    const std::vector<double> zeros(std::min<size_t>(m_total_size, 65536), 0.0);
+    for (size_t written = 0; written < m_total_size; written += zeros.size())
+        m_stream.write(reinterpret_cast<const char*>(zeros.data()),
+                       static_cast<std::streamsize>(std::min(zeros.size(), m_total_size - written)
+                                                    * sizeof(double)));
+    if (!m_stream.good())
+        throw Exceptions::FileIsBadException("IntensityFileSink::open() -> Error. "
+                                             "Can't write to file '" + m_file_name + "'.");
+}
+
+void IntensityFileSink::writeBlock(size_t offset, const std::vector<double>& values)
+{
+    if (!m_stream.is_open())
+        throw std::runtime_error("IntensityFileSink::writeBlock() -> Error. Sink is not open.");
+    if (offset + values.size() > m_total_size)
+        throw Exceptions::OutOfBoundsException("IntensityFileSink::writeBlock() -> Error. "
+                                               "Block exceeds the size of the result.");
+    m_stream.seekp(static_cast<std::streamoff>(m_data_offset + offset * sizeof(double)));
+    if (DataFormatUtils::isLittleEndian()) {
+        m_stream.write(reinterpret_cast<const char*>(values.data()),
+                       static_cast<std::streamsize>(values.size() * sizeof(double)));
+    } else {
+        // the format is little-endian
+        for (double value : values) {
+            char bytes[sizeof(double)];
+            std::memcpy(bytes, &value, sizeof(double));
+            std::reverse(bytes, bytes + sizeof(double));
+            m_stream.write(bytes, sizeof(double));
+        }
+    }
+    if (!m_stream.good())
+        throw Exceptions::FileIsBadException("IntensityFileSink::writeBlock() -> Error. "
+                                             "Can't write to file '" + m_file_name + "'.");
+}
+
+void IntensityFileSink::close()
+{
+    if (m_stream.is_open())
+        m_stream.close();
+}
@@ -0,0 +1,68 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/InputOutput/IntensitySink.h
+//! @brief     Defines classes IIntensitySink and IntensityFileSink.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef INTENSITYSINK_H
+#define INTENSITYSINK_H
+
+#include "WinDllMacros.h"
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+class IAxis;
+
+//! Interface for receivers of simulated intensities that are delivered block by block.
+//! Offsets refer to the global (row-major) index of the simulation result.
+//! @ingroup input_output
+
+class BA_CORE_API_ IIntensitySink
+{
+public:
+    virtual ~IIntensitySink() {}
+
+    //! Prepares the sink for a result with the given axes (in default units), all values
+    //! set to zero
+    virtual void open(const std::vector<std::unique_ptr<IAxis>>& axes) = 0;
+
+    //! Stores the given values at positions offset, offset+1, ...
+    virtual void writeBlock(size_t offset, const std::vector<double>& values) = 0;
+
+    //! Is called after the last block has been written
+    virtual void close() {}
+};
+
+//! Sink that streams the intensities into a file in the BornAgain binary format (*.bab, see
+//! OutputDataWriteBinaryStrategy), without holding the full result in memory. The file can be
+//! read with IntensityDataIOFactory.
+//! @ingroup input_output
+
+class BA_CORE_API_ IntensityFileSink : public IIntensitySink
+{
+public:
+    IntensityFileSink(const std::string& file_name);
+    ~IntensityFileSink() override;
+
+    void open(const std::vector<std::unique_ptr<IAxis>>& axes) override;
+    void writeBlock(size_t offset, const std::vector<double>& values) override;
+    void close() override;
+
+private:
+    std::string m_file_name;
+    size_t m_total_size;
+    size_t m_data_offset; //!< position of the values in the file
+    std::ofstream m_stream;
+};
+
+#endif // INTENSITYSINK_H
@@ -35,6 +35,8 @@ IOutputDataReadStrategy* OutputDataReadFactory::getReadStrategy(const std::strin
     IOutputDataReadStrategy* result(nullptr);
     if(DataFormatUtils::isIntFile(file_name))
         result = new OutputDataReadINTStrategy();
+    else if(DataFormatUtils::isBinaryFile(file_name))
+        result = new OutputDataReadBinaryStrategy();
 #ifdef BORNAGAIN_TIFF_SUPPORT
     else if(DataFormatUtils::isTiffFile(file_name))
        result = new OutputDataReadTiffStrategy();
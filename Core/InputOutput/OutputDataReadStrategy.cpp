@@ -19,7 +19,12 @@
 #include "ArrayUtils.h"
 #include "TiffHandler.h"
 #include <stdexcept> // need overlooked by g++ 5.4
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <map>
+#include <sstream>
 
 namespace{
 inline std::string trim(const std::string& str,
@@ -35,6 +40,50 @@ inline std::string trim(const std::string& str,
 
     return str.substr(strBegin, strRange);
 }
+
+//! Sequential reader of the binary format, which checks all accesses against the buffer size.
+class BinaryParser
+{
+public:
+    BinaryParser(const char* buffer, size_t size) : m_buffer(buffer), m_size(size), m_pos(0) {}
+
+    const char* take(size_t n_bytes)
+    {
+        if (n_bytes > m_size - m_pos)
+            throw Exceptions::FormatErrorException(
+                "OutputDataReadBinaryStrategy::readOutputData() -> Error. Unexpected end of data.");
+        const char* result = m_buffer + m_pos;
+        m_pos += n_bytes;
+        return result;
+    }
+
+    uint32_t takeUInt32()
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(take(4));
+        uint32_t result = 0;
+        for (size_t i = 0; i < 4; ++i)
+            result |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+        return result;
+    }
+
+    size_t position() const { return m_pos; }
+
+private:
+    const char* m_buffer;
+    size_t m_size;
+    size_t m_pos;
+};
+
+template <class T> double DecodeValue(const char* bytes, bool swap)
+{
+    char copy[sizeof(T)];
+    std::memcpy(copy, bytes, sizeof(T));
+    if (swap)
+        std::reverse(copy, copy + sizeof(T));
+    T result;
+    std::memcpy(&result, copy, sizeof(T));
+    return static_cast<double>(result);
+}
 }
 
 
@@ -179,6 +228,74 @@ OutputData<double>* OutputDataReadNumpyTXTStrategy::readOutputData(std::istream&
 }
 
 
+OutputData<double>* OutputDataReadBinaryStrategy::readOutputData(std::istream& input_stream)
+{
+    const std::vector<char> buffer((std::istreambuf_iterator<char>(input_stream)),
+                                   std::istreambuf_iterator<char>());
+    return readOutputData(buffer.data(), buffer.size());
+}
+
+OutputData<double>* OutputDataReadBinaryStrategy::readOutputData(const char* buffer, size_t size)
+{
+    return readBuffer(buffer, size, std::shared_ptr<char>());
+}
+
+OutputData<double>* OutputDataReadBinaryStrategy::readOutputData(std::shared_ptr<char> buffer,
+                                                                 size_t size)
+{
+    return readBuffer(buffer.get(), size, buffer);
+}
+
+OutputData<double>* OutputDataReadBinaryStrategy::readBuffer(const char* buffer, size_t size,
+                                                             const std::shared_ptr<char>& owner)
+{
+    BinaryParser parser(buffer, size);
+    const std::string& signature = DataFormatUtils::BinarySignature;
+    if (std::string(parser.take(signature.size()), signature.size()) != signature)
+        throw Exceptions::FormatErrorException("OutputDataReadBinaryStrategy::readOutputData() "
+                                               "-> Error. Not a BornAgain binary file.");
+    const uint32_t version = parser.takeUInt32();
+    if (version != 1)
+        throw Exceptions::FormatErrorException("OutputDataReadBinaryStrategy::readOutputData() "
+                                               "-> Error. Unsupported format version "
+                                               + std::to_string(version) + ".");
+    const uint32_t value_size = parser.takeUInt32();
+    if (value_size != sizeof(double) && value_size != sizeof(float))
+        throw Exceptions::FormatErrorException("OutputDataReadBinaryStrategy::readOutputData() "
+                                               "-> Error. Unsupported value size.");
+
+    std::unique_ptr<OutputData<double>> P_result(new OutputData<double>);
+    const uint32_t rank = parser.takeUInt32();
+    for (uint32_t i = 0; i < rank; ++i) {
+        const uint32_t length = parser.takeUInt32();
+        std::istringstream axis_stream(std::string(parser.take(length), length));
+        P_result->addAxis(*DataFormatUtils::createAxis(axis_stream));
+    }
+    parser.take((8 - parser.position() % 8) % 8);
+
+    const size_t n_values = P_result->getAllocatedSize();
+    if (n_values > (size - parser.position()) / value_size)
+        throw Exceptions::FormatErrorException("OutputDataReadBinaryStrategy::readOutputData() "
+                                               "-> Error. Unexpected end of data.");
+    const char* values = parser.take(n_values * value_size);
+    const bool swap = !DataFormatUtils::isLittleEndian();
+    const bool native = value_size == sizeof(double) && !swap
+                        && reinterpret_cast<uintptr_t>(values) % alignof(double) == 0;
+    if (native && owner && n_values > 0) {
+        // the values share the ownership of the buffer
+        double* p_values = reinterpret_cast<double*>(owner.get() + (values - buffer));
+        P_result->setRawDataStorage(std::shared_ptr<double>(owner, p_values));
+    } else if (native) {
+        P_result->setRawDataArray(reinterpret_cast<const double*>(values));
+    } else {
+        for (size_t i = 0; i < n_values; ++i)
+            (*P_result)[i] = value_size == sizeof(double)
+                                 ? DecodeValue<double>(values + i * value_size, swap)
+                                 : DecodeValue<float>(values + i * value_size, swap);
+    }
+    return P_result.release();
+}
+
 #ifdef BORNAGAIN_TIFF_SUPPORT
 
 OutputDataReadTiffStrategy::OutputDataReadTiffStrategy()
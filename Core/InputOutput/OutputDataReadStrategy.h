@@ -17,6 +17,7 @@
 
 #include "WinDllMacros.h"
 #include <istream>
+#include <memory>
 
 template <class T> class OutputData;
 
@@ -59,6 +60,29 @@ public:
 };
 
 
+//! Strategy to read OutputData from the BornAgain binary format
+//! (see OutputDataWriteBinaryStrategy).
+//! @ingroup input_output_internal
+
+class BA_CORE_API_ OutputDataReadBinaryStrategy : public IOutputDataReadStrategy
+{
+public:
+    OutputData<double>* readOutputData(std::istream& input_stream);
+
+    //! Reads from a buffer holding the complete file.
+    //! Double precision values in native byte order are copied without conversion.
+    OutputData<double>* readOutputData(const char* buffer, size_t size);
+
+    //! Reads from a writable buffer holding the complete file, e.g. a privately mapped file.
+    //! Double precision values in native byte order are used in place; the result then
+    //! shares the ownership of the buffer.
+    OutputData<double>* readOutputData(std::shared_ptr<char> buffer, size_t size);
+
+private:
+    OutputData<double>* readBuffer(const char* buffer, size_t size,
+                                   const std::shared_ptr<char>& owner);
+};
+
 #ifdef BORNAGAIN_TIFF_SUPPORT
 
 class TiffHandler;
@@ -23,6 +23,7 @@
 #else
 #include "boost_streams.h"
 #endif
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <fstream>
 #include "FileSystemUtils.h"
 
@@ -37,9 +38,16 @@ OutputData<double>* OutputDataReader::getOutputData()
         throw Exceptions::NullPointerException(
             "OutputDataReader::getOutputData() -> Error! No read strategy defined");
 
+#ifndef _WIN32
+    // uncompressed binary files are parsed in place, without intermediate copies
+    if (auto p_binary_strategy = dynamic_cast<OutputDataReadBinaryStrategy*>(m_read_strategy.get()))
+        if (!isCompressed(m_file_name))
+            return getFromMappedFile(*p_binary_strategy);
+#endif
+
     std::ifstream fin;
     std::ios_base::openmode openmode = std::ios::in;
-    if(isTiffFile(m_file_name) || isCompressed(m_file_name))
+    if(isTiffFile(m_file_name) || isBinaryFile(m_file_name) || isCompressed(m_file_name))
         openmode = std::ios::in | std::ios_base::binary;
 
 #ifdef _WIN32
@@ -66,6 +74,25 @@ void OutputDataReader::setStrategy(IOutputDataReadStrategy* read_strategy)
     m_read_strategy.reset(read_strategy);
 }
 
+//! The file is mapped privately, such that the values can be modified in place without
+//! changing the file; the mapping is released with the last user of the returned data.
+OutputData<double>* OutputDataReader::getFromMappedFile(OutputDataReadBinaryStrategy& strategy)
+{
+    auto P_mapped_file = std::make_shared<boost::iostreams::mapped_file>();
+    try {
+        boost::iostreams::mapped_file_params params(m_file_name);
+        params.flags = boost::iostreams::mapped_file::priv;
+        P_mapped_file->open(params);
+    } catch (const std::exception& ex) {
+        throw Exceptions::FileNotIsOpenException(
+            "OutputDataReader::getOutputData() -> Error. Can't map file '"
+            + m_file_name + "' for reading: " + ex.what());
+    }
+    const size_t size = P_mapped_file->size();
+    return strategy.readOutputData(std::shared_ptr<char>(P_mapped_file, P_mapped_file->data()),
+                                   size);
+}
+
 OutputData<double>* OutputDataReader::getFromFilteredStream(std::istream& input_stream)
 {
     boost::iostreams::filtering_streambuf<boost::iostreams::input> input_filtered;
@@ -30,6 +30,11 @@ IOutputDataWriteStrategy *OutputDataWriteFactory::getWriteStrategy(const std::st
         result = new OutputDataWriteINTStrategy();
     }
 
+    else if(DataFormatUtils::isBinaryFile(file_name)) {
+        result = new OutputDataWriteBinaryStrategy(
+            DataFormatUtils::isSinglePrecisionBinaryFile(file_name));
+    }
+
 
 #ifdef BORNAGAIN_TIFF_SUPPORT
     else if(DataFormatUtils::isTiffFile(file_name)) {
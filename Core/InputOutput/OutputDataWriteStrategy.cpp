@@ -15,10 +15,15 @@
 #include "OutputDataWriteStrategy.h"
 #include "ArrayUtils.h"
 #include "BornAgainNamespace.h"
+#include "DataFormatUtils.h"
 #include "OutputData.h" // needed by some compilers
 #include "TiffHandler.h"
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
+#include <sstream>
 
 namespace
 {
@@ -82,6 +87,27 @@ void Write1DRepresentation(const OutputData<double>& data, std::ostream& output_
     for (size_t i = 0, nrows = axis_values.size(); i < nrows; ++i)
         output_stream << axis_values[i] << "    " << IgnoreDenormalized(data[i]) << std::endl;
 }
+
+const uint32_t binary_format_version = 1;
+const size_t binary_block_size = 65536; // number of values converted at once
+
+void WriteUInt32(uint32_t value, std::ostream& output_stream)
+{
+    char bytes[4];
+    for (size_t i = 0; i < 4; ++i)
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    output_stream.write(bytes, 4);
+}
+
+//! Appends the little-endian bytes of value to the buffer.
+template <class T> void AppendValue(T value, std::vector<char>& buffer, bool swap)
+{
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (swap)
+        std::reverse(bytes, bytes + sizeof(T));
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
 } // namespace
 
 // ----------------------------------------------------------------------------
@@ -132,6 +158,65 @@ void OutputDataWriteNumpyTXTStrategy::writeOutputData(const OutputData<double>&
     }
 }
 
+// ----------------------------------------------------------------------------
+// class OutputDataWriteBinaryStrategy
+// ----------------------------------------------------------------------------
+
+OutputDataWriteBinaryStrategy::OutputDataWriteBinaryStrategy(bool single_precision)
+    : m_single_precision(single_precision)
+{}
+
+void OutputDataWriteBinaryStrategy::writeOutputData(const OutputData<double>& data,
+                                                    std::ostream& output_stream)
+{
+    const size_t value_size = m_single_precision ? sizeof(float) : sizeof(double);
+    std::vector<const IAxis*> axes;
+    for (size_t i = 0; i < data.getRank(); ++i)
+        axes.push_back(&data.getAxis(i));
+    writeHeader(axes, value_size, output_stream);
+
+    const bool swap = !DataFormatUtils::isLittleEndian();
+    std::vector<char> buffer;
+    buffer.reserve(binary_block_size * value_size);
+    for (size_t i = 0, size = data.getAllocatedSize(); i < size; ++i) {
+        if (m_single_precision)
+            AppendValue(static_cast<float>(data[i]), buffer, swap);
+        else
+            AppendValue(data[i], buffer, swap);
+        if (buffer.size() == buffer.capacity() || i + 1 == size) {
+            output_stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+}
+
+size_t OutputDataWriteBinaryStrategy::writeHeader(const std::vector<const IAxis*>& axes,
+                                                  size_t value_size, std::ostream& output_stream)
+{
+    output_stream.write(DataFormatUtils::BinarySignature.data(),
+                        static_cast<std::streamsize>(DataFormatUtils::BinarySignature.size()));
+    WriteUInt32(binary_format_version, output_stream);
+    WriteUInt32(static_cast<uint32_t>(value_size), output_stream);
+    WriteUInt32(static_cast<uint32_t>(axes.size()), output_stream);
+    size_t header_size = DataFormatUtils::BinarySignature.size() + 12;
+
+    for (size_t i = 0; i < axes.size(); ++i) {
+        std::unique_ptr<IAxis> P_axis(axes[i]->clone());
+        P_axis->setName(std::string("axis") + std::to_string(i));
+        std::ostringstream axis_stream;
+        axis_stream.imbue(std::locale::classic());
+        axis_stream << (*P_axis);
+        const std::string axis = axis_stream.str();
+        WriteUInt32(static_cast<uint32_t>(axis.size()), output_stream);
+        output_stream.write(axis.data(), static_cast<std::streamsize>(axis.size()));
+        header_size += 4 + axis.size();
+    }
+    // values start at an aligned offset, such that a mapped file can be used in place
+    const std::vector<char> padding((8 - header_size % 8) % 8, 0);
+    output_stream.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    return header_size + padding.size();
+}
+
 // ----------------------------------------------------------------------------
 // class OutputDataWriteTiffStrategy
 // ----------------------------------------------------------------------------
@@ -17,7 +17,9 @@
 
 #include "WinDllMacros.h"
 #include <istream>
+#include <vector>
 
+class IAxis;
 template <class T> class OutputData;
 
 //! Strategy interface to write OututData in file
@@ -50,6 +52,27 @@ public:
     virtual void writeOutputData(const OutputData<double>& data, std::ostream& output_stream);
 };
 
+//! Strategy to write OutputData to the BornAgain binary format.
+//!
+//! Layout (all numbers little-endian): the signature "BABINARY", uint32 format version,
+//! uint32 size of a value in bytes (8 or 4), uint32 number of axes, for each axis a uint32
+//! length followed by the axis in the text representation of the *.int format, zero padding
+//! to a multiple of 8 bytes, and finally the raw values in row-major order.
+//! @ingroup input_output_internal
+
+class BA_CORE_API_ OutputDataWriteBinaryStrategy : public IOutputDataWriteStrategy
+{
+public:
+    OutputDataWriteBinaryStrategy(bool single_precision = false);
+    virtual void writeOutputData(const OutputData<double>& data, std::ostream& output_stream);
+
+    //! Writes everything up to the values, which are then expected at the returned offset
+    static size_t writeHeader(const std::vector<const IAxis*>& axes, size_t value_size,
+                              std::ostream& output_stream);
+private:
+    bool m_single_precision;
+};
+
 #ifdef BORNAGAIN_TIFF_SUPPORT
 
 class TiffHandler;
@@ -40,7 +40,7 @@ void OutputDataWriter::writeOutputData(const OutputData<double>& data)
 
     std::ofstream fout;
     std::ios_base::openmode openmode = std::ios::out;
-    if(isTiffFile(m_file_name) || isCompressed(m_file_name))
+    if(isTiffFile(m_file_name) || isBinaryFile(m_file_name) || isCompressed(m_file_name))
         openmode = std::ios::out | std::ios_base::binary;
 
 #ifdef _WIN32
@@ -55,6 +55,14 @@ void OutputDataWriter::writeOutputData(const OutputData<double>& data)
     if (!fout.good())
         throw Exceptions::FileIsBadException("OutputDataReader::writeOutputData() -> Error! "
                                              "File is not good, probably it is a directory.");
+
+    // without compression, the data is written directly to the file
+    if (!isCompressed(m_file_name)) {
+        m_write_strategy->writeOutputData(data, fout);
+        fout.close();
+        return;
+    }
+
     std::stringstream ss;
     m_write_strategy->writeOutputData(data, ss);
 
@@ -14,6 +14,7 @@
 
 #include "ConvolutionDetectorResolution.h"
 #include "Convolve.h"
+#include "Instrumentation.h"
 
 
 ConvolutionDetectorResolution::ConvolutionDetectorResolution(
@@ -61,6 +62,7 @@ std::vector<const INode*> ConvolutionDetectorResolution::getChildren() const
 void ConvolutionDetectorResolution::applyDetectorResolution(
     OutputData<double>* p_intensity_map) const
 {
+    BA_INSTRUMENT_SCOPE(DetectorResolution);
     if (p_intensity_map->getRank() != m_dimension) {
         throw Exceptions::RuntimeErrorException(
             "ConvolutionDetectorResolution::applyDetectorResolution() -> Error! "
@@ -91,6 +91,12 @@ const DetectorMask* IDetector2D::detectorMask() const
 }
 
 std::vector<DetectorElement> IDetector2D::createDetectorElements(const Beam& beam)
+{
+    return createDetectorElements(beam, 0, numberOfSimulationElements());
+}
+
+std::vector<DetectorElement> IDetector2D::createDetectorElements(const Beam& beam, size_t start,
+                                                                 size_t n_elements)
 {
     std::vector<DetectorElement> result;
     const Eigen::Matrix2cd& analyzer_operator = detectionProperties().analyzerOperator();
@@ -99,8 +105,10 @@ std::vector<DetectorElement> IDetector2D::createDetectorElements(const Beam& bea
         m_detector_mask.initMaskData(*this);
     size_t spec_index = getIndexOfSpecular(beam);
 
-    result.reserve(numberOfSimulationElements());
+    result.reserve(n_elements);
     iterate([&](const_iterator it){
+        if (it.elementIndex() < start || it.elementIndex() >= start + n_elements)
+            return;
         result.emplace_back(createPixel(it.detectorIndex()), analyzer_operator);
         if (it.detectorIndex()==spec_index) {
             auto& detector_element = result.back();
@@ -62,6 +62,11 @@ public:
 #ifndef SWIG
     //! Create a vector of DetectorElement objects according to the detector and its mask
     std::vector<DetectorElement> createDetectorElements(const Beam& beam) override;
+
+    //! Create the DetectorElement objects with element indices in the range
+    //! [start, start + n_elements)
+    std::vector<DetectorElement> createDetectorElements(const Beam& beam, size_t start,
+                                                        size_t n_elements);
 #endif
 
     //! Returns region of  interest if exists.
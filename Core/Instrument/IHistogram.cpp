@@ -219,7 +219,7 @@ double IHistogram::integral() const
 PyObject* IHistogram::array(DataType dataType) const
 {
     const std::unique_ptr<OutputData<double>> data(createOutputData(dataType));
-    return data->getArray();
+    return data->getArrayView();
 }
 
 PyObject* IHistogram::getArray(DataType dataType) const
@@ -19,6 +19,7 @@
 #include "Exceptions.h"
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <numeric>
 
 //! Template class to store data of any type in multi-dimensional space (low-level).
@@ -29,6 +30,8 @@ template <class T> class LLData
 public:
     // construction, destruction and assignment
     LLData(size_t rank, const int* dimensions);
+    //! Constructs data on top of external storage of matching size, which is shared, not copied
+    LLData(size_t rank, const int* dimensions, std::shared_ptr<T> storage);
     LLData(const LLData<T>& right);
     LLData<T>& operator=(const LLData<T>& right);
     ~LLData();
@@ -57,8 +60,12 @@ public:
     const int* getDimensions() const { return m_dims; }
     T getTotalSum() const;
 
+    //! Returns the reference-counted storage of the values
+    std::shared_ptr<T> storage() const { return m_storage; }
+
 private:
     void allocate(size_t rank, const int* dimensions);
+    void setDimensions(size_t rank, const int* dimensions);
     void clear();
     bool checkDimensions(size_t rank, const int* dimensions) const;
     size_t convertCoordinate(int* coordinate) const;
@@ -67,6 +74,7 @@ private:
 
     size_t m_rank;
     int* m_dims;
+    std::shared_ptr<T> m_storage; //!< owns the values, possibly shared with views
     T* m_data_array;
 };
 
@@ -94,6 +102,19 @@ inline LLData<T>::LLData(size_t rank, const int* dimensions)
     allocate(rank, dimensions);
 }
 
+template<class T>
+inline LLData<T>::LLData(size_t rank, const int* dimensions, std::shared_ptr<T> storage)
+    : m_rank(0)
+    , m_dims(0)
+    , m_data_array(0)
+{
+    if (!storage)
+        throw std::runtime_error("LLData<T>::LLData error: storage is not defined");
+    setDimensions(rank, dimensions);
+    m_storage = std::move(storage);
+    m_data_array = m_storage.get();
+}
+
 template<class T>
 LLData<T>::LLData(const LLData<T>& right)
     : m_rank(0)
@@ -221,6 +242,13 @@ template<class T> T LLData<T>::getTotalSum() const
 }
 
 template<class T> void LLData<T>::allocate(size_t rank, const int* dimensions)
+{
+    setDimensions(rank, dimensions);
+    m_storage.reset(new T[getTotalSize()], std::default_delete<T[]>());
+    m_data_array = m_storage.get();
+}
+
+template<class T> void LLData<T>::setDimensions(size_t rank, const int* dimensions)
 {
     clear();
     if (!checkDimensions(rank, dimensions)) {
@@ -230,10 +258,6 @@ template<class T> void LLData<T>::allocate(size_t rank, const int* dimensions)
     if (m_rank) {
         m_dims = new int[m_rank];
         std::copy(dimensions, dimensions + rank, m_dims);
-        m_data_array = new T[getTotalSize()];
-    }
-    else {
-        m_data_array = new T[1];
     }
 }
 
@@ -241,13 +265,11 @@ template<class T> void LLData<T>::clear()
 {
     if (m_rank>0) {
         m_rank = 0;
-        delete[] m_data_array;
         delete[] m_dims;
-        m_data_array = nullptr;
         m_dims = nullptr;
-    } else {
-        delete[] m_data_array;
     }
+    m_storage.reset();
+    m_data_array = nullptr;
 }
 
 template<class T> inline
@@ -272,6 +294,7 @@ template<class T> void LLData<T>::swapContents(LLData<T>& other)
 {
     std::swap(this->m_rank, other.m_rank);
     std::swap(this->m_dims, other.m_dims);
+    std::swap(this->m_storage, other.m_storage);
     std::swap(this->m_data_array, other.m_data_array);
 }
 
@@ -18,6 +18,17 @@
 #include "OutputData.h"
 #include "PythonCore.h"
 
+namespace
+{
+const char* const storage_capsule_name = "BornAgain.OutputDataStorage";
+
+void DeleteStorage(PyObject* capsule)
+{
+    delete static_cast<std::shared_ptr<double>*>(
+        PyCapsule_GetPointer(capsule, storage_capsule_name));
+}
+}
+
 template<>
 PyObject* OutputData<double>::getArray() const
 {
@@ -61,6 +72,54 @@ PyObject* OutputData<double>::getArray() const
     return pyarray;
 }
 
+template<>
+PyObject* OutputData<double>::getArrayView() const
+{
+    const size_t rank = getRank();
+    std::vector<npy_intp> dimensions(rank);
+    std::vector<npy_intp> strides(rank);
+    npy_intp stride = sizeof(double);
+    for (size_t i = rank; i > 0; --i) {
+        dimensions[i-1] = static_cast<npy_intp>(getAxis(i-1).size());
+        strides[i-1] = stride;
+        stride *= dimensions[i-1];
+    }
+
+    // the numpy array keeps a reference to the storage
+    std::unique_ptr<std::shared_ptr<double>> P_storage(
+        new std::shared_ptr<double>(getRawDataStorage()));
+    char* p_data = reinterpret_cast<char*>(P_storage->get());
+
+    // rot90 of 2-dim arrays, as in getArray(), by reversed rows and swapped strides
+    if (rank == 2) {
+        const npy_intp ny = dimensions[1];
+        dimensions = {ny, dimensions[0]};
+        strides = {-static_cast<npy_intp>(sizeof(double)), ny * strides[1]};
+        p_data += (ny - 1) * sizeof(double);
+    }
+
+    PyObject* pyarray = PyArray_New(&PyArray_Type, static_cast<int>(rank), dimensions.data(),
+                                    NPY_DOUBLE, strides.data(), p_data, 0, NPY_ARRAY_WRITEABLE,
+                                    nullptr);
+    if (pyarray == nullptr)
+        throw Exceptions::RuntimeErrorException(
+            "OutputData::getArrayView() -> Panic in PyArray_New");
+    PyObject* capsule = PyCapsule_New(P_storage.get(), storage_capsule_name, DeleteStorage);
+    if (capsule == nullptr) {
+        Py_DECREF(pyarray);
+        throw Exceptions::RuntimeErrorException(
+            "OutputData::getArrayView() -> Panic in PyCapsule_New");
+    }
+    P_storage.release();
+    // the reference to the capsule is stolen, even on failure
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(pyarray), capsule) < 0) {
+        Py_DECREF(pyarray);
+        throw Exceptions::RuntimeErrorException(
+            "OutputData::getArrayView() -> Panic in PyArray_SetBaseObject");
+    }
+    return pyarray;
+}
+
 template<>
 double OutputData<double>::getValue(size_t index) const
 {
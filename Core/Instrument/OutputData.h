@@ -72,6 +72,12 @@ public:
     //! Returns copy of raw data vector
     std::vector<T> getRawDataVector() const;
 
+#ifndef SWIG
+    //! Returns the reference-counted raw data array. It shares the values with this object,
+    //! and stays valid after reallocation or destruction of this object.
+    std::shared_ptr<T> getRawDataStorage() const;
+#endif
+
     //! Returns sum of all values in the data structure
     T totalSum() const;
 
@@ -178,6 +184,11 @@ public:
     //! Sets new values to raw data array
     void setRawDataArray(const T* source);
 
+#ifndef SWIG
+    //! Uses the given array of getAllocatedSize() values as raw data, without copying
+    void setRawDataStorage(std::shared_ptr<T> storage);
+#endif
+
     //! addition-assignment operator for two output data
     const OutputData<T>& operator+=(const OutputData<T>& right);
 
@@ -216,6 +227,10 @@ public:
     //! returns data as Python numpy array
 #ifdef BORNAGAIN_PYTHON
     PyObject* getArray() const;
+
+    //! returns Python numpy array of the same layout as getArray(), which shares the values
+    //! with this object instead of copying them
+    PyObject* getArrayView() const;
 #endif
 
     //! returns true if object is correctly initialized
@@ -598,6 +613,27 @@ inline void OutputData<T>::setRawDataArray(const T* source)
         (*mp_ll_data)[i] = source[i];
 }
 
+template<class T>
+inline std::shared_ptr<T> OutputData<T>::getRawDataStorage() const
+{
+    if (!mp_ll_data)
+        throw Exceptions::ClassInitializationException(
+            "OutputData<T>::getRawDataStorage() -> Error! Data is not initialized.");
+    return mp_ll_data->storage();
+}
+
+template<class T>
+inline void OutputData<T>::setRawDataStorage(std::shared_ptr<T> storage)
+{
+    if (!mp_ll_data)
+        throw Exceptions::ClassInitializationException(
+            "OutputData<T>::setRawDataStorage() -> Error! Data is not initialized.");
+    LLData<T>* p_ll_data = new LLData<T>(mp_ll_data->getRank(), mp_ll_data->getDimensions(),
+                                         std::move(storage));
+    delete mp_ll_data;
+    mp_ll_data = p_ll_data;
+}
+
 //! Returns true if object have same dimensions
 template<class T>
 template<class U>
@@ -627,6 +663,9 @@ bool OutputData<T>::hasSameShape(const OutputData<U>& right) const
 #ifdef BORNAGAIN_PYTHON
 template<>
 PyObject* OutputData<double>::getArray() const;
+
+template<>
+PyObject* OutputData<double>::getArrayView() const;
 #endif
 
 // return index of axis
@@ -14,6 +14,27 @@
 
 #include "PyArrayImportUtils.h"
 #include "ArrayUtils.h"
+#ifdef BORNAGAIN_PYTHON
+#include "PythonCore.h"
+
+namespace
+{
+//! Releases the numpy array whose memory is used as OutputData storage.
+class ArrayReleaser
+{
+public:
+    ArrayReleaser(PyObject* array) : m_array(array) {}
+    void operator()(double*) const
+    {
+        PyGILState_STATE gil_state = PyGILState_Ensure();
+        Py_DECREF(m_array);
+        PyGILState_Release(gil_state);
+    }
+private:
+    PyObject* m_array;
+};
+}
+#endif // BORNAGAIN_PYTHON
 
 OutputData<double>* PyArrayImport::importArrayToOutputData(const std::vector<double>& vec)
 {
@@ -25,3 +46,58 @@ PyArrayImport::importArrayToOutputData(const std::vector<std::vector<double>>& v
 {
     return ArrayUtils::createData(vec).release();
 }
+
+#ifdef BORNAGAIN_PYTHON
+OutputData<double>* PyArrayImport::importNumpyArray(PyObject* obj)
+{
+    PyObject* array = PyArray_FROMANY(obj, NPY_DOUBLE, 1, 2,
+                                      NPY_ARRAY_ALIGNED | NPY_ARRAY_NOTSWAPPED);
+    if (array == nullptr)
+        throw std::runtime_error("Error in PyArrayImport::importNumpyArray: can't convert "
+                                 "argument to 1D or 2D array of doubles");
+    PyArrayObject* p_array = reinterpret_cast<PyArrayObject*>(array);
+    const npy_intp* dims = PyArray_DIMS(p_array);
+    const npy_intp* strides = PyArray_STRIDES(p_array);
+    const bool is_2d = PyArray_NDIM(p_array) == 2;
+    const size_t nrows = is_2d ? static_cast<size_t>(dims[0]) : 1;
+    const size_t ncols = static_cast<size_t>(dims[is_2d ? 1 : 0]);
+    if (nrows == 0 || ncols == 0) {
+        Py_DECREF(array);
+        throw std::runtime_error(
+            "Error in PyArrayImport::importNumpyArray: input argument contains empty dimensions");
+    }
+
+    std::unique_ptr<OutputData<double>> P_result(new OutputData<double>);
+    P_result->addAxis(FixedBinAxis("axis0", ncols, 0.0, static_cast<double>(ncols)));
+    if (is_2d)
+        P_result->addAxis(FixedBinAxis("axis1", nrows, 0.0, static_cast<double>(nrows)));
+
+    // memory layout of OutputData: columns outside, rows inside in reversed order
+    const npy_intp value_size = sizeof(double);
+    const bool is_shareable =
+        PyArray_ISWRITEABLE(p_array)
+        && (is_2d ? strides[0] == -value_size
+                        && strides[1] == static_cast<npy_intp>(nrows) * value_size
+                  : strides[0] == value_size);
+    if (is_shareable) {
+        char* p_begin = static_cast<char*>(PyArray_DATA(p_array));
+        if (is_2d)
+            p_begin -= (nrows - 1) * sizeof(double);
+        P_result->setRawDataStorage(
+            std::shared_ptr<double>(reinterpret_cast<double*>(p_begin), ArrayReleaser(array)));
+        return P_result.release();
+    }
+
+    if (is_2d) {
+        for (size_t row = 0; row < nrows; ++row)
+            for (size_t col = 0; col < ncols; ++col)
+                (*P_result)[nrows - row - 1 + col * nrows] =
+                    *static_cast<const double*>(PyArray_GETPTR2(p_array, row, col));
+    } else {
+        for (size_t col = 0; col < ncols; ++col)
+            (*P_result)[col] = *static_cast<const double*>(PyArray_GETPTR1(p_array, col));
+    }
+    Py_DECREF(array);
+    return P_result.release();
+}
+#endif // BORNAGAIN_PYTHON
@@ -16,6 +16,7 @@
 #define PYARRAYIMPORTUTILS_H
 
 #include "WinDllMacros.h"
+#include "PyObject.h"
 #include <vector>
 
 template<class T> class OutputData;
@@ -30,6 +31,14 @@ namespace PyArrayImport {
     //! for importing 2D array of doubles from python into OutputData
     BA_CORE_API_ OutputData<double>* importArrayToOutputData(const std::vector<std::vector<double>>& vec);
 
+#ifdef BORNAGAIN_PYTHON
+    //! for importing 1D or 2D numpy array (layout as in OutputData::getArray()) into OutputData.
+    //! Writeable arrays of doubles, whose memory layout coincides with the one of OutputData
+    //! (1D contiguous arrays, or arrays returned by OutputData::getArrayView()), are shared
+    //! without copying. Other arrays are copied once.
+    BA_CORE_API_ OutputData<double>* importNumpyArray(PyObject* obj);
+#endif
+
 } // namespace PyArrayImport
 
 #endif // PYARRAYIMPORTUTILS_H
@@ -122,7 +122,8 @@ PyObject* SimulationResult::array(AxesUnits units) const
     if (!mP_data || !mP_unit_converter)
         throw std::runtime_error(
             "Error in SimulationResult::array: attempt to access non-initialized data");
-    return mP_unit_converter->createConvertedData(*mP_data, units)->getArray();
+    // the converted data is a temporary copy, which can be handed over without copying again
+    return mP_unit_converter->createConvertedData(*mP_data, units)->getArrayView();
 }
 
 std::vector<double> SimulationResult::axis(AxesUnits units) const
@@ -25,7 +25,6 @@ Lattice::Lattice()
     , m_a( {1.0, 0.0, 0.0} )
     , m_b( {0.0, 1.0, 0.0} )
     , m_c( {0.0, 0.0, 1.0} )
-    , m_cache_ok(false)
 {
     setName(BornAgain::LatticeType);
     initialize();
@@ -37,7 +36,6 @@ Lattice::Lattice(const kvector_t a1, const kvector_t a2, const kvector_t a3)
     , m_a(a1)
     , m_b(a2)
     , m_c(a3)
-    , m_cache_ok(false)
 {
     setName(BornAgain::LatticeType);
     initialize();
@@ -49,7 +47,6 @@ Lattice::Lattice(const Lattice& lattice)
     , m_a(lattice.m_a)
     , m_b(lattice.m_b)
     , m_c(lattice.m_c)
-    , m_cache_ok(false)
 {
     setName(BornAgain::LatticeType);
     initialize();
@@ -75,7 +72,6 @@ Lattice Lattice::createTransformedLattice(const Transform3D& transform) const
 void Lattice::initialize() const
 {
     computeReciprocalVectors();
-    m_cache_ok = true;
 }
 
 void Lattice::resetBasis(const kvector_t a1, const kvector_t a2, const kvector_t a3)
@@ -102,9 +98,6 @@ double Lattice::volume() const
 void Lattice::getReciprocalLatticeBasis(kvector_t &b1, kvector_t &b2,
         kvector_t &b3) const
 {
-    if (!m_cache_ok) {
-        initialize();
-    }
     b1 = m_ra;
     b2 = m_rb;
     b3 = m_rc;
@@ -136,8 +129,6 @@ ivector_t Lattice::getNearestReciprocalLatticeVectorCoordinates(const kvector_t
 std::vector<kvector_t> Lattice::reciprocalLatticeVectorsWithinRadius(
         const kvector_t input_vector, double radius) const
 {
-    if (!m_cache_ok)
-        initialize();
     ivector_t nearest_coords = getNearestReciprocalLatticeVectorCoordinates(input_vector);
     return vectorsWithinRadius(
         input_vector, nearest_coords, radius, m_ra, m_rb, m_rc, m_a, m_b, m_c);
@@ -192,9 +183,11 @@ Lattice Lattice::createBCTLattice(double a, double c)
     return Lattice(a1, a2, a3);
 }
 
+//! Recomputes the reciprocal vectors right away, so that const methods never write to the
+//! cache and a lattice can be shared between threads.
 void Lattice::onChange()
 {
-    m_cache_ok = false;
+    initialize();
 }
 
 void Lattice::registerBasisVectors()
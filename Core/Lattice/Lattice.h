@@ -106,8 +106,6 @@ private:
     ISelectionRule* mp_selection_rule;
     kvector_t m_a, m_b, m_c; //!< Basis vectors in real space
     mutable kvector_t m_ra, m_rb, m_rc; //!< Cache of basis vectors in reciprocal space
-    //! Boolean indicating if the reciprocal vectors are already initialized in the cache
-    mutable bool m_cache_ok;
 };
 
 #endif // LATTICE_H
@@ -16,13 +16,14 @@
 #include "Exceptions.h"
 #include "FormFactorCoherentSum.h"
 #include "IInterferenceFunction.h"
+#include "Instrumentation.h"
 #include "InterferenceFunctionUtils.h"
 #include "MathFunctions.h"
 #include "RealParameter.h"
 #include "SimulationElement.h"
 
-using InterferenceFunctionUtils::PrecomputeScalarFormFactors;
 using InterferenceFunctionUtils::PrecomputePolarizedFormFactors;
+using InterferenceFunctionUtils::SpinChannelWeights;
 
 DecouplingApproximationStrategy::DecouplingApproximationStrategy(
         SimulationOptions sim_params, bool polarized)
@@ -37,45 +38,65 @@ double DecouplingApproximationStrategy::scalarCalculation(
 {
     double intensity = 0.0;
     complex_t amplitude = complex_t(0.0, 0.0);
-    auto precomputed_ff = PrecomputeScalarFormFactors(sim_element, m_formfactor_wrappers);
-    for (size_t i = 0; i < m_formfactor_wrappers.size(); ++i) {
+    auto precomputed_ff = scalarFormFactors(sim_element);
+    for (size_t i = 0; i < formFactors().size(); ++i) {
         complex_t ff = precomputed_ff[i];
         if (std::isnan(ff.real()))
             throw Exceptions::RuntimeErrorException(
                 "DecouplingApproximationStrategy::scalarCalculation() -> Error! Amplitude is NaN");
-        double fraction = m_formfactor_wrappers[i].relativeAbundance();
+        double fraction = formFactors()[i].relativeAbundance();
         amplitude += fraction * ff;
         intensity += fraction * std::norm(ff);
     }
     double amplitude_norm = std::norm(amplitude);
-    double itf_function = mP_iff->evaluate(sim_element.getMeanQ());
+    double itf_function;
+    {
+        BA_INSTRUMENT_SCOPE(InterferenceFunctions);
+        itf_function = mp_iff->evaluate(sim_element.getMeanQ());
+    }
     return intensity + amplitude_norm * (itf_function - 1.0);
 }
 
-//! This is the polarized version
+//! This is the polarized version. If polarization and analyzer are diagonal in the spin basis
+//! along z, the traces reduce to weighted sums over the spin channels.
 double DecouplingApproximationStrategy::polarizedCalculation(
         const SimulationElement& sim_element) const
 {
     Eigen::Matrix2cd mean_intensity = Eigen::Matrix2cd::Zero();
     Eigen::Matrix2cd mean_amplitude = Eigen::Matrix2cd::Zero();
+    double channel_intensity = 0.0;
 
-    auto precomputed_ff = PrecomputePolarizedFormFactors(sim_element, m_formfactor_wrappers);
+    auto precomputed_ff = PrecomputePolarizedFormFactors(sim_element, formFactors());
     const auto& polarization_handler = sim_element.polarizationHandler();
-    for (size_t i = 0; i < m_formfactor_wrappers.size(); ++i) {
+    Eigen::Matrix2d channel_weights;
+    const bool spin_channels = SpinChannelWeights(polarization_handler, channel_weights);
+    for (size_t i = 0; i < formFactors().size(); ++i) {
         Eigen::Matrix2cd ff = precomputed_ff[i];
         if (!ff.allFinite())
             throw Exceptions::RuntimeErrorException(
                 "DecouplingApproximationStrategy::polarizedCalculation() -> "
                 "Error! Form factor contains NaN or infinite");
-        double fraction = m_formfactor_wrappers[i].relativeAbundance();
+        double fraction = formFactors()[i].relativeAbundance();
         mean_amplitude += fraction * ff;
-        mean_intensity += fraction * (ff * polarization_handler.getPolarization() * ff.adjoint());
+        if (spin_channels)
+            channel_intensity += fraction * (channel_weights.array() * ff.array().abs2()).sum();
+        else
+            mean_intensity +=
+                fraction * (ff * polarization_handler.getPolarization() * ff.adjoint());
+    }
+    double itf_function;
+    {
+        BA_INSTRUMENT_SCOPE(InterferenceFunctions);
+        itf_function = mp_iff->evaluate(sim_element.getMeanQ());
+    }
+    if (spin_channels) {
+        double amplitude_trace = (channel_weights.array() * mean_amplitude.array().abs2()).sum();
+        return std::abs(channel_intensity) + std::abs(amplitude_trace) * (itf_function - 1.0);
     }
     Eigen::Matrix2cd amplitude_matrix = polarization_handler.getAnalyzerOperator() * mean_amplitude
             * polarization_handler.getPolarization() * mean_amplitude.adjoint();
     Eigen::Matrix2cd intensity_matrix = polarization_handler.getAnalyzerOperator() * mean_intensity;
     double amplitude_trace = std::abs(amplitude_matrix.trace());
     double intensity_trace = std::abs(intensity_matrix.trace());
-    double itf_function = mP_iff->evaluate(sim_element.getMeanQ());
     return intensity_trace + amplitude_trace * (itf_function - 1.0);
 }
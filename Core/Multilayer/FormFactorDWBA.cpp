@@ -14,11 +14,14 @@
 
 #include "FormFactorDWBA.h"
 #include "BornAgainNamespace.h"
+#include "FormFactorDecoratorMaterial.h"
 #include "ILayerRTCoefficients.h"
 #include "WavevectorInfo.h"
 
 FormFactorDWBA::FormFactorDWBA(const IFormFactor& form_factor)
     : mP_form_factor(form_factor.clone())
+    , mp_material_ff(dynamic_cast<const FormFactorDecoratorMaterial*>(mP_form_factor.get()))
+    , mp_scattering_ff(mp_material_ff ? mp_material_ff->getFormFactor() : mP_form_factor.get())
 {
     setName(BornAgain::FormFactorDWBAType);
 }
@@ -40,16 +43,23 @@ FormFactorDWBA* FormFactorDWBA::clone() const
 }
 
 complex_t FormFactorDWBA::evaluate(const WavevectorInfo& wavevectors) const
+{
+    return evaluateInLayer(wavevectors, *mp_in_coeffs, *mp_out_coeffs);
+}
+
+complex_t FormFactorDWBA::evaluateInLayer(const WavevectorInfo& wavevectors,
+                                          const ILayerRTCoefficients& in_coeffs,
+                                          const ILayerRTCoefficients& out_coeffs) const
 {
     // Retrieve the two different incoming wavevectors in the layer
     cvector_t k_i_T = wavevectors.getKi();
-    k_i_T.setZ(-mp_in_coeffs->getScalarKz());
+    k_i_T.setZ(-in_coeffs.getScalarKz());
     cvector_t k_i_R = k_i_T;
     k_i_R.setZ(-k_i_T.z());
 
     // Retrieve the two different outgoing wavevector bins in the layer
     cvector_t k_f_T = wavevectors.getKf();
-    k_f_T.setZ(mp_out_coeffs->getScalarKz());
+    k_f_T.setZ(out_coeffs.getScalarKz());
     cvector_t k_f_R = k_f_T;
     k_f_R.setZ(-k_f_T.z());
 
@@ -61,19 +71,20 @@ complex_t FormFactorDWBA::evaluate(const WavevectorInfo& wavevectors) const
     WavevectorInfo k_RR(k_i_R, k_f_R, wavelength);
 
     // Get the four R,T coefficients
-    complex_t T_in = mp_in_coeffs->getScalarT();
-    complex_t R_in = mp_in_coeffs->getScalarR();
-    complex_t T_out = mp_out_coeffs->getScalarT();
-    complex_t R_out = mp_out_coeffs->getScalarR();
+    complex_t T_in = in_coeffs.getScalarT();
+    complex_t R_in = in_coeffs.getScalarR();
+    complex_t T_out = out_coeffs.getScalarT();
+    complex_t R_out = out_coeffs.getScalarR();
 
     // The four different scattering contributions; S stands for scattering
     // off the particle, R for reflection off the layer interface
-    complex_t term_S   = T_in * mP_form_factor->evaluate(k_TT) * T_out;
-    complex_t term_RS  = R_in * mP_form_factor->evaluate(k_RT) * T_out;
-    complex_t term_SR  = T_in * mP_form_factor->evaluate(k_TR) * R_out;
-    complex_t term_RSR = R_in * mP_form_factor->evaluate(k_RR) * R_out;
+    complex_t term_S   = T_in * mp_scattering_ff->evaluate(k_TT) * T_out;
+    complex_t term_RS  = R_in * mp_scattering_ff->evaluate(k_RT) * T_out;
+    complex_t term_SR  = T_in * mp_scattering_ff->evaluate(k_TR) * R_out;
+    complex_t term_RSR = R_in * mp_scattering_ff->evaluate(k_RR) * R_out;
 
-    return term_S + term_RS + term_SR + term_RSR;
+    complex_t result = term_S + term_RS + term_SR + term_RSR;
+    return mp_material_ff ? mp_material_ff->getRefractiveIndexFactor(k_TT) * result : result;
 }
 
 double FormFactorDWBA::bottomZ(const IRotation& rotation) const
@@ -18,9 +18,13 @@
 #include "IFormFactor.h"
 #include <memory>
 
+class FormFactorDecoratorMaterial;
 class ILayerRTCoefficients;
 
 //! Evaluates the coherent sum of the four DWBA terms in a scalar IFormFactor.
+//!
+//! If the form factor is decorated with its material, the wavelength-dependent contrast
+//! factor is applied once to the sum, instead of once per term.
 //! @ingroup formfactors_internal
 
 class FormFactorDWBA final : public IFormFactor
@@ -51,12 +55,20 @@ public:
     void setSpecularInfo(std::unique_ptr<const ILayerRTCoefficients> p_in_coeffs,
                          std::unique_ptr<const ILayerRTCoefficients> p_out_coeffs) override;
 
+    complex_t evaluateInLayer(const WavevectorInfo& wavevectors,
+                              const ILayerRTCoefficients& in_coeffs,
+                              const ILayerRTCoefficients& out_coeffs) const override;
+
     friend class TestPolarizedDWBATerms;
 
 private:
     //! The form factor for BA
     std::unique_ptr<IFormFactor> mP_form_factor;
 
+    //! The material decorator of mP_form_factor, if any, and the form factor it decorates
+    const FormFactorDecoratorMaterial* mp_material_ff;
+    const IFormFactor* mp_scattering_ff;
+
     std::unique_ptr<const ILayerRTCoefficients> mp_in_coeffs;
     std::unique_ptr<const ILayerRTCoefficients> mp_out_coeffs;
 };
@@ -23,6 +23,39 @@ namespace {
                                 const Eigen::Vector2cd& vec2){
         return vec1.transpose() * ff * vec2;
     }
+
+    //! Wavevector z-components and amplitudes of the eigenmodes in a layer. Since the DWBA
+    //! terms are linear in the amplitudes of each eigenmode, eigenmodes with identical
+    //! wavevectors (e.g. in non-magnetic layers) are merged into one.
+    struct LayerEigenmodes {
+        size_t size;
+        complex_t kz[2];
+        Eigen::Vector2cd T_plus[2], R_plus[2], T_min[2], R_min[2];
+    };
+
+    LayerEigenmodes GetEigenmodes(const ILayerRTCoefficients& coeffs) {
+        LayerEigenmodes result;
+        const Eigen::Vector2cd kz = coeffs.getKz();
+        result.size = 2;
+        result.kz[0] = kz(0);
+        result.kz[1] = kz(1);
+        result.T_plus[0] = coeffs.T1plus();
+        result.T_plus[1] = coeffs.T2plus();
+        result.R_plus[0] = coeffs.R1plus();
+        result.R_plus[1] = coeffs.R2plus();
+        result.T_min[0] = coeffs.T1min();
+        result.T_min[1] = coeffs.T2min();
+        result.R_min[0] = coeffs.R1min();
+        result.R_min[1] = coeffs.R2min();
+        if (kz(0) == kz(1)) {
+            result.size = 1;
+            result.T_plus[0] += result.T_plus[1];
+            result.R_plus[0] += result.R_plus[1];
+            result.T_min[0] += result.T_min[1];
+            result.R_min[0] += result.R_min[1];
+        }
+        return result;
+    }
 }
 
 FormFactorDWBAPol::FormFactorDWBAPol(const IFormFactor& form_factor)
@@ -55,24 +88,15 @@ complex_t FormFactorDWBAPol::evaluate(const WavevectorInfo&) const
 
 Eigen::Matrix2cd FormFactorDWBAPol::evaluatePol(const WavevectorInfo& wavevectors) const
 {
-    // the required wavevectors inside the layer for
-    // different eigenmodes and in- and outgoing wavevector;
-    complex_t kix = wavevectors.getKi().x();
-    complex_t kiy = wavevectors.getKi().y();
-    cvector_t ki_1R(kix, kiy, mp_in_coeffs->getKz()(0));
-    cvector_t ki_1T(kix, kiy, -mp_in_coeffs->getKz()(0));
-    cvector_t ki_2R(kix, kiy, mp_in_coeffs->getKz()(1));
-    cvector_t ki_2T(kix, kiy, -mp_in_coeffs->getKz()(1));
+    return evaluatePolInLayer(wavevectors, *mp_in_coeffs, *mp_out_coeffs);
+}
 
-    cvector_t kf_1R = wavevectors.getKf();
-    kf_1R.setZ(-(complex_t)mp_out_coeffs->getKz()(0));
-    cvector_t kf_1T = kf_1R;
-    kf_1T.setZ((complex_t)mp_out_coeffs->getKz()(0));
-    cvector_t kf_2R = kf_1R;
-    kf_2R.setZ(-(complex_t)mp_out_coeffs->getKz()(1));
-    cvector_t kf_2T = kf_1R;
-    kf_2T.setZ((complex_t)mp_out_coeffs->getKz()(1));
-    // now each of the 16 matrix terms of the polarized DWBA is calculated:
+Eigen::Matrix2cd FormFactorDWBAPol::evaluatePolInLayer(const WavevectorInfo& wavevectors,
+                                                      const ILayerRTCoefficients& in_coeffs,
+                                                      const ILayerRTCoefficients& out_coeffs) const
+{
+    // each of the 16 matrix terms of the polarized DWBA is calculated below, where the terms of
+    // merged eigenmodes are evaluated together:
     // NOTE: when the underlying reflection/transmission coefficients are
     // scalar, the eigenmodes have identical eigenvalues and spin polarization
     // is used as a basis; in this case however the matrices get mixed:
@@ -81,127 +105,45 @@ Eigen::Matrix2cd FormFactorDWBAPol::evaluatePol(const WavevectorInfo& wavevector
     //     real m_M21 = calculated m_M22
     //     real m_M22 = calculated m_M21
     // since both eigenvalues are identical, this does not influence the result.
-    Eigen::Matrix2cd ff_BA;
-
-    double wavelength = wavevectors.getWavelength();
-
-    // The following matrices each contain the four polarization conditions
-    // (p->p, p->m, m->p, m->m)
-    // The first two indices indicate a scattering from the 1/2 eigenstate into
-    // the 1/2 eigenstate, while the capital indices indicate a reflection
-    // before and/or after the scattering event (first index is in-state,
-    // second is out-state; this also applies to the internal matrix indices)
-    Eigen::Matrix2cd
-        M11_S, M11_RS, M11_SR, M11_RSR,
-        M12_S, M12_RS, M12_SR, M12_RSR,
-        M21_S, M21_RS, M21_SR, M21_RSR,
-        M22_S, M22_RS, M22_SR, M22_RSR;
-
-    // eigenmode 1 -> eigenmode 1: direct scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1T, kf_1T, wavelength));
-    M11_S(0,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA, mp_in_coeffs->T1plus());
-    M11_S(0,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->T1plus());
-    M11_S(1,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA,  mp_in_coeffs->T1min());
-    M11_S(1,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->T1min());
-    // eigenmode 1 -> eigenmode 1: reflection and then scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1R, kf_1T, wavelength));
-    M11_RS(0,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA, mp_in_coeffs->R1plus());
-    M11_RS(0,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->R1plus());
-    M11_RS(1,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA, mp_in_coeffs->R1min());
-    M11_RS(1,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->R1min());
-    // eigenmode 1 -> eigenmode 1: scattering and then reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1T, kf_1R, wavelength));
-    M11_SR(0,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->T1plus());
-    M11_SR(0,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->T1plus());
-    M11_SR(1,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->T1min());
-    M11_SR(1,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->T1min());
-    // eigenmode 1 -> eigenmode 1: reflection, scattering and again reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1R, kf_1R, wavelength));
-    M11_RSR(0,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->R1plus());
-    M11_RSR(0,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->R1plus());
-    M11_RSR(1,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->R1min());
-    M11_RSR(1,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->R1min());
-
-    // eigenmode 1 -> eigenmode 2: direct scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1T, kf_2T, wavelength));
-    M12_S(0,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->T1plus());
-    M12_S(0,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->T1plus());
-    M12_S(1,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->T1min());
-    M12_S(1,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->T1min());
-    // eigenmode 1 -> eigenmode 2: reflection and then scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1R, kf_2T, wavelength));
-    M12_RS(0,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->R1plus());
-    M12_RS(0,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->R1plus());
-    M12_RS(1,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->R1min());
-    M12_RS(1,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->R1min());
-    // eigenmode 1 -> eigenmode 2: scattering and then reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1T, kf_2R, wavelength));
-    M12_SR(0,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->T1plus());
-    M12_SR(0,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->T1plus());
-    M12_SR(1,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->T1min());
-    M12_SR(1,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->T1min());
-    // eigenmode 1 -> eigenmode 2: reflection, scattering and again reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_1R, kf_2R, wavelength));
-    M12_RSR(0,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->R1plus());
-    M12_RSR(0,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->R1plus());
-    M12_RSR(1,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->R1min());
-    M12_RSR(1,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->R1min());
-
-    // eigenmode 2 -> eigenmode 1: direct scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2T, kf_1T, wavelength));
-    M21_S(0,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA, mp_in_coeffs->T2plus());
-    M21_S(0,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->T2plus());
-    M21_S(1,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA, mp_in_coeffs->T2min());
-    M21_S(1,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->T2min());
-    // eigenmode 2 -> eigenmode 1: reflection and then scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2R, kf_1T, wavelength));
-    M21_RS(0,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA, mp_in_coeffs->R2plus());
-    M21_RS(0,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->R2plus());
-    M21_RS(1,0) = - VecMatVecProduct(mp_out_coeffs->T1min(), ff_BA, mp_in_coeffs->R2min());
-    M21_RS(1,1) =  VecMatVecProduct(mp_out_coeffs->T1plus(), ff_BA, mp_in_coeffs->R2min());
-    // eigenmode 2 -> eigenmode 1: scattering and then reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2T, kf_1R, wavelength));
-    M21_SR(0,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->T2plus());
-    M21_SR(0,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->T2plus());
-    M21_SR(1,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->T2min());
-    M21_SR(1,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->T2min());
-    // eigenmode 2 -> eigenmode 1: reflection, scattering and again reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2R, kf_1R, wavelength));
-    M21_RSR(0,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->R2plus());
-    M21_RSR(0,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->R2plus());
-    M21_RSR(1,0) = - VecMatVecProduct(mp_out_coeffs->R1min(), ff_BA, mp_in_coeffs->R2min());
-    M21_RSR(1,1) =  VecMatVecProduct(mp_out_coeffs->R1plus(), ff_BA, mp_in_coeffs->R2min());
-
-    // eigenmode 2 -> eigenmode 2: direct scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2T, kf_2T, wavelength));
-    M22_S(0,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->T2plus());
-    M22_S(0,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->T2plus());
-    M22_S(1,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->T2min());
-    M22_S(1,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->T2min());
-    // eigenmode 2 -> eigenmode 2: reflection and then scattering
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2R, kf_2T, wavelength));
-    M22_RS(0,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->R2plus());
-    M22_RS(0,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->R2plus());
-    M22_RS(1,0) = - VecMatVecProduct(mp_out_coeffs->T2min(), ff_BA, mp_in_coeffs->R2min());
-    M22_RS(1,1) =  VecMatVecProduct(mp_out_coeffs->T2plus(), ff_BA, mp_in_coeffs->R2min());
-    // eigenmode 2 -> eigenmode 2: scattering and then reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2T, kf_2R, wavelength));
-    M22_SR(0,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->T2plus());
-    M22_SR(0,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->T2plus());
-    M22_SR(1,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->T2min());
-    M22_SR(1,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->T2min());
-    // eigenmode 2 -> eigenmode 2: reflection, scattering and again reflection
-    ff_BA = mP_form_factor->evaluatePol(WavevectorInfo(ki_2R, kf_2R, wavelength));
-    M22_RSR(0,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->R2plus());
-    M22_RSR(0,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->R2plus());
-    M22_RSR(1,0) = - VecMatVecProduct(mp_out_coeffs->R2min(), ff_BA, mp_in_coeffs->R2min());
-    M22_RSR(1,1) =  VecMatVecProduct(mp_out_coeffs->R2plus(), ff_BA, mp_in_coeffs->R2min());
-
-    return
-        M11_S + M11_RS + M11_SR + M11_RSR +
-        M12_S + M12_RS + M12_SR + M12_RSR +
-        M21_S + M21_RS + M21_SR + M21_RSR +
-            M22_S + M22_RS + M22_SR + M22_RSR;
+    const LayerEigenmodes in_modes = GetEigenmodes(in_coeffs);
+    const LayerEigenmodes out_modes = GetEigenmodes(out_coeffs);
+    const cvector_t ki = wavevectors.getKi();
+    const cvector_t kf = wavevectors.getKf();
+    const double wavelength = wavevectors.getWavelength();
+
+    // Each term contains the four polarization conditions (p->p, p->m, m->p, m->m).
+    // The terms are labelled by the in- and outgoing eigenmode and by whether the wave is
+    // reflected before and/or after the scattering event: direct scattering (S), reflection and
+    // then scattering (RS), scattering and then reflection (SR), and reflection, scattering and
+    // again reflection (RSR).
+    Eigen::Matrix2cd result = Eigen::Matrix2cd::Zero();
+    for (size_t i = 0; i < in_modes.size; ++i) {
+        for (size_t j = 0; j < out_modes.size; ++j) {
+            for (bool out_reflected : {false, true}) {
+                const cvector_t k_out(kf.x(), kf.y(),
+                                      out_reflected ? -out_modes.kz[j] : out_modes.kz[j]);
+                const Eigen::Vector2cd& out_plus =
+                    out_reflected ? out_modes.R_plus[j] : out_modes.T_plus[j];
+                const Eigen::Vector2cd& out_min =
+                    out_reflected ? out_modes.R_min[j] : out_modes.T_min[j];
+                for (bool in_reflected : {false, true}) {
+                    const cvector_t k_in(ki.x(), ki.y(),
+                                         in_reflected ? in_modes.kz[i] : -in_modes.kz[i]);
+                    const Eigen::Vector2cd& in_plus =
+                        in_reflected ? in_modes.R_plus[i] : in_modes.T_plus[i];
+                    const Eigen::Vector2cd& in_min =
+                        in_reflected ? in_modes.R_min[i] : in_modes.T_min[i];
+                    const Eigen::Matrix2cd ff_BA =
+                        mP_form_factor->evaluatePol(WavevectorInfo(k_in, k_out, wavelength));
+                    result(0, 0) -= VecMatVecProduct(out_min, ff_BA, in_plus);
+                    result(0, 1) += VecMatVecProduct(out_plus, ff_BA, in_plus);
+                    result(1, 0) -= VecMatVecProduct(out_min, ff_BA, in_min);
+                    result(1, 1) += VecMatVecProduct(out_plus, ff_BA, in_min);
+                }
+            }
+        }
+    }
+    return result;
 }
 
 double FormFactorDWBAPol::bottomZ(const IRotation& rotation) const
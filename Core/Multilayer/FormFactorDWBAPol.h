@@ -21,6 +21,7 @@
 class ILayerRTCoefficients;
 
 //! Evaluates the coherent sum of the 16 matrix DWBA terms in a polarized IFormFactor.
+//! Terms of eigenmodes with identical wavevectors are evaluated together.
 
 //! @ingroup formfactors_internal
 
@@ -55,6 +56,10 @@ public:
     void setSpecularInfo(std::unique_ptr<const ILayerRTCoefficients> p_in_coeffs,
                          std::unique_ptr<const ILayerRTCoefficients> p_out_coeffs) override;
 
+    Eigen::Matrix2cd evaluatePolInLayer(const WavevectorInfo& wavevectors,
+                                        const ILayerRTCoefficients& in_coeffs,
+                                        const ILayerRTCoefficients& out_coeffs) const override;
+
     friend class TestPolarizedDWBATerms;
 
 private:
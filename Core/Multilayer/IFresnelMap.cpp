@@ -13,6 +13,7 @@
 // ************************************************************************** //
 
 #include "IFresnelMap.h"
+#include "SimulationElement.h"
 #include "Slice.h"
 
 IFresnelMap::IFresnelMap() : m_use_cache(true) {}
@@ -29,6 +30,11 @@ const std::vector<Slice>& IFresnelMap::slices() const
 
 IFresnelMap::~IFresnelMap() = default;
 
+void IFresnelMap::precomputeCoefficients(std::vector<SimulationElement>::const_iterator,
+                                         std::vector<SimulationElement>::const_iterator) const
+{
+}
+
 void IFresnelMap::disableCaching()
 {
     m_use_cache = false;
@@ -50,9 +50,17 @@ public:
     virtual void setSlices(const std::vector<Slice>& slices);
     const std::vector<Slice>& slices() const;
 
+    //! Computes the coefficients of the given simulation elements in advance, where the
+    //! implementation can do so more efficiently than one wavevector at a time.
+    virtual void precomputeCoefficients(std::vector<SimulationElement>::const_iterator begin,
+                                        std::vector<SimulationElement>::const_iterator end) const;
+
     //! Disables caching of previously computed Fresnel coefficients
     void disableCaching();
 
+    //! Discards all cached Fresnel coefficients
+    virtual void clearCache() = 0;
+
 protected:
     virtual std::unique_ptr<const ILayerRTCoefficients>
     getCoefficients(const kvector_t& kvec, size_t layer_index) const = 0;
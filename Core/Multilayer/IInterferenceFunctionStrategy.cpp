@@ -15,13 +15,16 @@
 #include "IInterferenceFunctionStrategy.h"
 #include "Exceptions.h"
 #include "FormFactorCoherentSum.h"
+#include "Instrumentation.h"
 #include "InterferenceFunctionNone.h"
 #include "IntegratorMCMiser.h"
+#include "InterferenceFunctionUtils.h"
 #include "SimulationElement.h"
 
 IInterferenceFunctionStrategy::IInterferenceFunctionStrategy(const SimulationOptions& sim_params,
                                                              bool polarized)
-    : mP_iff(nullptr)
+    : mp_formfactors(nullptr)
+    , mp_iff(nullptr)
     , m_options(sim_params)
     , m_polarized(polarized)
     , mP_integrator(make_integrator_miser(
@@ -32,16 +35,18 @@ IInterferenceFunctionStrategy::~IInterferenceFunctionStrategy() =default;
 
 void IInterferenceFunctionStrategy::init(
     const std::vector<FormFactorCoherentSum>& weighted_formfactors,
-    const IInterferenceFunction* p_iff)
+    const IInterferenceFunction* p_iff, const std::vector<size_t>& ff_group_sizes)
 {
     if (weighted_formfactors.size()==0)
         throw Exceptions::ClassInitializationException(
                 "IInterferenceFunctionStrategy::init: strategy gets no formfactors.");
-    m_formfactor_wrappers = weighted_formfactors;
-    if (p_iff)
-        mP_iff.reset(p_iff->clone());
-    else
-        mP_iff.reset(new InterferenceFunctionNone());
+    mp_formfactors = &weighted_formfactors;
+    m_ff_group_sizes = ff_group_sizes;
+    if (!p_iff) {
+        mP_iff_none.reset(new InterferenceFunctionNone());
+        p_iff = mP_iff_none.get();
+    }
+    mp_iff = p_iff;
 
     strategy_specific_post_init();
 }
@@ -62,10 +67,21 @@ double IInterferenceFunctionStrategy::evaluateSinglePoint(
         return polarizedCalculation(sim_element);
 }
 
+std::vector<complex_t> IInterferenceFunctionStrategy::scalarFormFactors(
+    const SimulationElement& sim_element) const
+{
+    if (m_options.useParticleDistributionInterpolation())
+        return InterferenceFunctionUtils::InterpolateScalarFormFactors(
+            sim_element, formFactors(), m_ff_group_sizes,
+            m_options.particleDistributionThreshold());
+    return InterferenceFunctionUtils::PrecomputeScalarFormFactors(sim_element, formFactors());
+}
+
 //! Performs a Monte Carlo integration over the bin for the evaluation of the intensity.
 double IInterferenceFunctionStrategy::MCIntegratedEvaluate(
     const SimulationElement& sim_element) const
 {
+    BA_INSTRUMENT_SCOPE(MonteCarloIntegration);
     double min_array[] = {0.0, 0.0};
     double max_array[] = {1.0, 1.0};
     return mP_integrator->integrate(
@@ -75,6 +91,7 @@ double IInterferenceFunctionStrategy::MCIntegratedEvaluate(
 double IInterferenceFunctionStrategy::evaluate_for_fixed_angles(
     double* fractions, size_t, void* params) const
 {
+    BA_INSTRUMENT_COUNT(MonteCarloEvaluations, 1);
     double par0 = fractions[0];
     double par1 = fractions[1];
 
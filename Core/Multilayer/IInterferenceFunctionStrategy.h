@@ -44,16 +44,25 @@ public:
     IInterferenceFunctionStrategy(const SimulationOptions& sim_params, bool polarized);
     virtual ~IInterferenceFunctionStrategy();
 
-    //! Initializes the object with form factors and an interference function
+    //! Initializes the object with form factors and an interference function, which are
+    //! referenced, not copied; they must outlive the strategy (they are owned by ProcessedLayout).
+    //! The form factors come in consecutive groups of the given sizes, one for each particle
+    //! type, see ProcessedLayout::formFactorGroupSizes
     void init(const std::vector<FormFactorCoherentSum>& weighted_formfactors,
-              const IInterferenceFunction* p_iff);
+              const IInterferenceFunction* p_iff, const std::vector<size_t>& ff_group_sizes);
 
     //! Calculates the intensity for scalar particles/interactions
     double evaluate(const SimulationElement& sim_element) const;
 
 protected:
-    std::vector<FormFactorCoherentSum> m_formfactor_wrappers;
-    std::unique_ptr<IInterferenceFunction> mP_iff;
+    const std::vector<FormFactorCoherentSum>& formFactors() const { return *mp_formfactors; }
+
+    //! Returns the scalar form factors for the given element, interpolated across particle
+    //! distributions if the options ask for it
+    std::vector<complex_t> scalarFormFactors(const SimulationElement& sim_element) const;
+
+    const std::vector<FormFactorCoherentSum>* mp_formfactors;
+    const IInterferenceFunction* mp_iff;
     SimulationOptions m_options;
 
 private:
@@ -67,6 +76,9 @@ private:
     virtual double polarizedCalculation(const SimulationElement& sim_element) const =0;
 
     bool m_polarized;
+    std::vector<size_t> m_ff_group_sizes;
+    //! Replaces a missing interference function
+    std::unique_ptr<IInterferenceFunction> mP_iff_none;
 
 #ifndef SWIG
     std::unique_ptr<IntegratorMCMiser<IInterferenceFunctionStrategy>> mP_integrator;
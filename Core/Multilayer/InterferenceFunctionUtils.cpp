@@ -14,6 +14,62 @@
 
 #include "InterferenceFunctionUtils.h"
 #include "FormFactorCoherentSum.h"
+#include "Instrumentation.h"
+#include "PolarizationHandler.h"
+#include <algorithm>
+
+namespace
+{
+//! Maximal distance of the initial nodes within a group
+const size_t max_node_distance = 16;
+
+//! Returns the quadratic through the form factors at a, b, c, evaluated at x
+complex_t quadratic(const std::vector<complex_t>& ff, size_t a, size_t b, size_t c, size_t x)
+{
+    const double xa = double(x) - a, xb = double(x) - b, xc = double(x) - c;
+    const double ab = double(a) - b, ac = double(a) - c, bc = double(b) - c;
+    return ff[a] * (xb * xc / (ab * ac)) - ff[b] * (xa * xc / (ab * bc))
+           + ff[c] * (xa * xb / (ac * bc));
+}
+
+void interpolate(std::vector<complex_t>& ff, size_t a, size_t b, size_t c)
+{
+    for (size_t i = a + 1; i < c; ++i)
+        if (i != b)
+            ff[i] = quadratic(ff, a, b, c, i);
+}
+
+//! Fills ff[lo+1..hi-1], given ff[lo], ff[mid] and ff[hi], where mid = (lo + hi) / 2.
+//! The quadratic through these three is checked at the two quarter points. If it matches
+//! there, the interior is interpolated piecewise by the quadratics through the five points;
+//! otherwise both halves are refined.
+void refine(const SimulationElement& sim_element,
+            const std::vector<FormFactorCoherentSum>& ff_wrappers, double threshold,
+            std::vector<complex_t>& amplitudes, std::vector<complex_t>& ff, size_t lo,
+            size_t mid, size_t hi)
+{
+    if (hi - lo <= 4) {
+        for (size_t i = lo + 1; i < hi; ++i)
+            if (i != mid)
+                ff[i] = ff_wrappers[i].evaluate(sim_element, amplitudes);
+        return;
+    }
+    const size_t q1 = (lo + mid) / 2;
+    const size_t q3 = (mid + hi) / 2;
+    ff[q1] = ff_wrappers[q1].evaluate(sim_element, amplitudes);
+    ff[q3] = ff_wrappers[q3].evaluate(sim_element, amplitudes);
+    const double scale = std::max({std::abs(ff[lo]), std::abs(ff[q1]), std::abs(ff[mid]),
+                                   std::abs(ff[q3]), std::abs(ff[hi])});
+    if (std::abs(ff[q1] - quadratic(ff, lo, mid, hi, q1)) <= threshold * scale
+        && std::abs(ff[q3] - quadratic(ff, lo, mid, hi, q3)) <= threshold * scale) {
+        interpolate(ff, lo, q1, mid);
+        interpolate(ff, mid, q3, hi);
+        return;
+    }
+    refine(sim_element, ff_wrappers, threshold, amplitudes, ff, lo, q1, mid);
+    refine(sim_element, ff_wrappers, threshold, amplitudes, ff, mid, q3, hi);
+}
+} // namespace
 
 namespace InterferenceFunctionUtils
 {
@@ -21,9 +77,44 @@ std::vector<complex_t> PrecomputeScalarFormFactors(
         const SimulationElement& sim_element,
         const std::vector<FormFactorCoherentSum>& ff_wrappers)
 {
+    BA_INSTRUMENT_SCOPE(FormFactors);
     std::vector<complex_t> result;
+    std::vector<complex_t> amplitudes;
     for (auto& ffw: ff_wrappers) {
-        result.push_back(ffw.evaluate(sim_element));
+        result.push_back(ffw.evaluate(sim_element, amplitudes));
+    }
+    return result;
+}
+
+std::vector<complex_t> InterpolateScalarFormFactors(
+        const SimulationElement& sim_element,
+        const std::vector<FormFactorCoherentSum>& ff_wrappers,
+        const std::vector<size_t>& group_sizes, double threshold)
+{
+    BA_INSTRUMENT_SCOPE(FormFactors);
+    std::vector<complex_t> result(ff_wrappers.size());
+    std::vector<complex_t> amplitudes;
+    size_t begin = 0;
+    for (size_t group_size : group_sizes) {
+        const size_t end = begin + group_size;
+        if (group_size < 3) {
+            for (size_t i = begin; i < end; ++i)
+                result[i] = ff_wrappers[i].evaluate(sim_element, amplitudes);
+        } else {
+            const size_t last = end - 1;
+            const size_t n_intervals = (last - begin + max_node_distance - 1) / max_node_distance;
+            size_t lo = begin;
+            result[lo] = ff_wrappers[lo].evaluate(sim_element, amplitudes);
+            for (size_t k = 1; k <= n_intervals; ++k) {
+                const size_t hi = begin + k * (last - begin) / n_intervals;
+                const size_t mid = (lo + hi) / 2;
+                result[hi] = ff_wrappers[hi].evaluate(sim_element, amplitudes);
+                result[mid] = ff_wrappers[mid].evaluate(sim_element, amplitudes);
+                refine(sim_element, ff_wrappers, threshold, amplitudes, result, lo, mid, hi);
+                lo = hi;
+            }
+        }
+        begin = end;
     }
     return result;
 }
@@ -32,10 +123,25 @@ matrixFFVector_t PrecomputePolarizedFormFactors(
         const SimulationElement& sim_element,
         const std::vector<FormFactorCoherentSum>& ff_wrappers)
 {
+    BA_INSTRUMENT_SCOPE(FormFactors);
     matrixFFVector_t result;
     for (auto& ffw: ff_wrappers) {
         result.push_back(ffw.evaluatePol(sim_element));
     }
     return result;
 }
+
+bool SpinChannelWeights(const PolarizationHandler& polarization_handler,
+                        Eigen::Matrix2d& weights)
+{
+    const Eigen::Matrix2cd polarization = polarization_handler.getPolarization();
+    const Eigen::Matrix2cd analyzer = polarization_handler.getAnalyzerOperator();
+    if (polarization(0, 1) != 0.0 || polarization(1, 0) != 0.0 || analyzer(0, 1) != 0.0
+        || analyzer(1, 0) != 0.0)
+        return false;
+    for (Eigen::Index i = 0; i < 2; ++i)
+        for (Eigen::Index j = 0; j < 2; ++j)
+            weights(i, j) = analyzer(i, i).real() * polarization(j, j).real();
+    return true;
+}
 }  // namespace InterferenceFunctionUtils
@@ -20,6 +20,7 @@
 #include <vector>
 
 class FormFactorCoherentSum;
+class PolarizationHandler;
 class SimulationElement;
 
 namespace InterferenceFunctionUtils
@@ -29,11 +30,27 @@ using matrixFFVector_t = std::vector<Eigen::Matrix2cd, Eigen::aligned_allocator<
 std::vector<complex_t> PrecomputeScalarFormFactors(
         const SimulationElement& sim_element,
         const std::vector<FormFactorCoherentSum>& ff_wrappers);
+
+//! Returns the same form factors as PrecomputeScalarFormFactors, but within each group of
+//! consecutive form factors from one particle distribution (of the given sizes), only some
+//! are evaluated; the others are interpolated by piecewise quadratics. Intervals are bisected
+//! until the form factors at their quarter points deviate from the quadratic through the end
+//! points and the midpoint by at most threshold, relative to the largest of these moduli.
+std::vector<complex_t> InterpolateScalarFormFactors(
+        const SimulationElement& sim_element,
+        const std::vector<FormFactorCoherentSum>& ff_wrappers,
+        const std::vector<size_t>& group_sizes, double threshold);
+
 matrixFFVector_t PrecomputePolarizedFormFactors(
         const SimulationElement& sim_element,
         const std::vector<FormFactorCoherentSum>& ff_wrappers);
 
-
+//! Returns true if both the polarization and the analyzer operator are diagonal in the spin
+//! basis along z, as for unpolarized beams or beams polarized along z, analyzed along z or
+//! not at all. Then tr(A*L*P*R) = sum_ij weights(i,j)*L(i,j)*R(j,i), and the weights are
+//! written to the given matrix.
+bool SpinChannelWeights(const PolarizationHandler& polarization_handler,
+                        Eigen::Matrix2d& weights);
 }  // namespace InterferenceFunctionUtils
 
 #endif // INTERFERENCEFUNCTIONUTILS_H
@@ -53,7 +53,7 @@ void LayoutStrategyBuilder::createStrategy()
     }
     if (!mP_strategy)
         throw Exceptions::ClassInitializationException("Could not create appropriate strategy");
-    mP_strategy->init(mp_layout->formFactorList(), p_iff);
+    mP_strategy->init(mp_layout->formFactorList(), p_iff, mp_layout->formFactorGroupSizes());
     return;
 }
 
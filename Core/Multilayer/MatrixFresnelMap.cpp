@@ -14,18 +14,21 @@
 
 #include "MatrixFresnelMap.h"
 #include "ILayerRTCoefficients.h"
+#include "Instrumentation.h"
 #include "MatrixRTCoefficients.h"
 #include "SimulationElement.h"
 #include "Slice.h"
 #include "SpecularMagnetic.h"
+#include <algorithm>
 
 namespace {
-std::vector<MatrixRTCoefficients> calculateCoefficients(const std::vector<Slice>& slices,
-                                                        kvector_t kvec);
+//! Number of wavevectors passed at once to the batched transfer-matrix computation
+const size_t batch_size = 256;
+}
 
-const std::vector<MatrixRTCoefficients>&
-getCoefficientsFromCache(kvector_t kvec, const std::vector<Slice>& slices,
-                         MatrixFresnelMap::CoefficientHash& hash_table);
+size_t MatrixFresnelMap::HashCoefficientKey::operator()(const CoefficientKey& key) const noexcept
+{
+    return m_kvector_hash(key.first) ^ static_cast<size_t>(key.second);
 }
 
 MatrixFresnelMap::MatrixFresnelMap() = default;
@@ -35,8 +38,22 @@ MatrixFresnelMap::~MatrixFresnelMap() = default;
 std::unique_ptr<const ILayerRTCoefficients>
 MatrixFresnelMap::getOutCoefficients(const SimulationElement& sim_element, size_t layer_index) const
 {
-    return getCoefficients(-sim_element.getMeanKf(), layer_index, m_inverted_slices,
-                           m_hash_table_out);
+    return getCoefficients(-sim_element.getMeanKf(), layer_index, true);
+}
+
+void MatrixFresnelMap::precomputeCoefficients(std::vector<SimulationElement>::const_iterator begin,
+                                              std::vector<SimulationElement>::const_iterator end) const
+{
+    if (!m_use_cache)
+        return;
+    std::vector<kvector_t> kvecs_in;
+    std::vector<kvector_t> kvecs_out;
+    for (auto it = begin; it != end; ++it) {
+        kvecs_in.push_back(it->getKi());
+        kvecs_out.push_back(-it->getMeanKf());
+    }
+    computeMissingCoefficients(kvecs_in, false);
+    computeMissingCoefficients(kvecs_out, true);
 }
 
 void MatrixFresnelMap::setSlices(const std::vector<Slice> &slices)
@@ -49,41 +66,74 @@ void MatrixFresnelMap::setSlices(const std::vector<Slice> &slices)
     }
 }
 
+void MatrixFresnelMap::clearCache()
+{
+    m_hash_table.clear();
+}
+
 std::unique_ptr<const ILayerRTCoefficients>
 MatrixFresnelMap::getCoefficients(const kvector_t& kvec, size_t layer_index) const
 {
-    return getCoefficients(kvec, layer_index, m_slices, m_hash_table_in);
+    return getCoefficients(kvec, layer_index, false);
 }
 
 std::unique_ptr<const ILayerRTCoefficients>
-MatrixFresnelMap::getCoefficients(const kvector_t& kvec, size_t layer_index,
-                                  const std::vector<Slice>& slices, CoefficientHash& hash_table) const
+MatrixFresnelMap::getCoefficients(const kvector_t& kvec, size_t layer_index, bool outgoing) const
 {
+    std::vector<MatrixRTCoefficients> coeffs;
     if (!m_use_cache) {
-        auto coeffs = calculateCoefficients(slices, kvec);
+        BA_INSTRUMENT_SCOPE(FresnelCoefficients);
+        SpecularMagnetic::Execute(slicesFor(outgoing), kvec, coeffs);
         return std::make_unique<MatrixRTCoefficients>(coeffs[layer_index]);
     }
-    const auto& coef_vector = getCoefficientsFromCache(kvec, slices, hash_table);
-    return std::make_unique<MatrixRTCoefficients>(coef_vector[layer_index]);
+    // look up under the lock of the cache shard, but compute missing coefficients outside of it
+    BA_INSTRUMENT_COUNT(FresnelLookups, 1);
+    std::unique_ptr<MatrixRTCoefficients> result;
+    auto pick = [&result, layer_index](const std::vector<MatrixRTCoefficients>& cached) {
+        result = std::make_unique<MatrixRTCoefficients>(cached[layer_index]);
+    };
+    const CoefficientKey key(kvec, outgoing);
+    if (m_hash_table.find(key, pick))
+        return std::move(result);
+    BA_INSTRUMENT_COUNT(FresnelCacheMisses, 1);
+    {
+        BA_INSTRUMENT_SCOPE(FresnelCoefficients);
+        SpecularMagnetic::Execute(slicesFor(outgoing), kvec, coeffs);
+    }
+    m_hash_table.insert(key, std::move(coeffs), pick);
+    return std::move(result);
 }
 
-namespace {
-std::vector<MatrixRTCoefficients> calculateCoefficients(const std::vector<Slice>& slices,
-                                                        kvector_t kvec)
+//! Computes the coefficients of all wavevectors that are not cached yet, in batches.
+void MatrixFresnelMap::computeMissingCoefficients(const std::vector<kvector_t>& kvecs,
+                                                  bool outgoing) const
 {
+    auto ignore = [](const std::vector<MatrixRTCoefficients>&) {};
+    std::vector<kvector_t> missing;
+    for (const auto& kvec : kvecs)
+        if ((missing.empty() || kvec != missing.back())
+            && !m_hash_table.find(CoefficientKey(kvec, outgoing), ignore))
+            missing.push_back(kvec);
+
+    const std::vector<Slice>& slices = slicesFor(outgoing);
+    const size_t n_slices = slices.size();
     std::vector<MatrixRTCoefficients> coeffs;
-    SpecularMagnetic::Execute(slices, kvec, coeffs);
-    return coeffs;
+    for (size_t start = 0; start < missing.size(); start += batch_size) {
+        const std::vector<kvector_t> batch(
+            missing.begin() + start, missing.begin() + std::min(start + batch_size, missing.size()));
+        {
+            BA_INSTRUMENT_SCOPE(FresnelCoefficients);
+            SpecularMagnetic::Execute(slices, batch, coeffs);
+        }
+        for (size_t j = 0; j < batch.size(); ++j) {
+            auto first = coeffs.begin() + j * n_slices;
+            m_hash_table.insert(CoefficientKey(batch[j], outgoing),
+                                std::vector<MatrixRTCoefficients>(first, first + n_slices), ignore);
+        }
+    }
 }
 
-const std::vector<MatrixRTCoefficients>&
-getCoefficientsFromCache(kvector_t kvec, const std::vector<Slice>& slices,
-                         MatrixFresnelMap::CoefficientHash& hash_table)
+const std::vector<Slice>& MatrixFresnelMap::slicesFor(bool outgoing) const
 {
-    auto it = hash_table.find(kvec);
-    if (it == hash_table.end())
-        it = hash_table.insert({kvec, calculateCoefficients(slices, kvec)}).first;
-    return it->second;
+    return outgoing ? m_inverted_slices : m_slices;
 }
-}
-
@@ -18,8 +18,9 @@
 #include "HashKVector.h"
 #include "IFresnelMap.h"
 #include "MatrixRTCoefficients.h"
+#include "ShardedCache.h"
 #include <memory>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 class ILayerRTCoefficients;
@@ -39,21 +40,37 @@ public:
     getOutCoefficients(const SimulationElement& sim_element,
                        size_t layer_index) const final override;
 
+    void precomputeCoefficients(std::vector<SimulationElement>::const_iterator begin,
+                                std::vector<SimulationElement>::const_iterator end) const
+        final override;
+
     void setSlices(const std::vector<Slice>& slices) final override;
 
-    typedef std::unordered_map<kvector_t, std::vector<MatrixRTCoefficients>, HashKVector>
+    void clearCache() final override;
+
+    //! Wavevector and whether it is a time-reversed outgoing one, for which the coefficients
+    //! are computed with inverted magnetic field
+    typedef std::pair<kvector_t, bool> CoefficientKey;
+
+    struct HashCoefficientKey {
+        size_t operator()(const CoefficientKey& key) const noexcept;
+        HashKVector m_kvector_hash;
+    };
+
+    typedef ShardedCache<CoefficientKey, std::vector<MatrixRTCoefficients>, HashCoefficientKey>
         CoefficientHash;
 
 private:
     std::unique_ptr<const ILayerRTCoefficients> getCoefficients(const kvector_t& kvec,
                                                                 size_t layer_index) const override;
-    std::unique_ptr<const ILayerRTCoefficients> getCoefficients(const kvector_t& kvec,
-                                                                size_t layer_index,
-                                                                const std::vector<Slice>& slices,
-                                                                CoefficientHash& hash_table) const;
+    std::unique_ptr<const ILayerRTCoefficients>
+    getCoefficients(const kvector_t& kvec, size_t layer_index, bool outgoing) const;
+    void computeMissingCoefficients(const std::vector<kvector_t>& kvecs, bool outgoing) const;
+    const std::vector<Slice>& slicesFor(bool outgoing) const;
+
     std::vector<Slice> m_inverted_slices;
-    mutable CoefficientHash m_hash_table_out;
-    mutable CoefficientHash m_hash_table_in;
+    //! Coefficients of all slices, for incoming and outgoing wavevectors
+    mutable CoefficientHash m_hash_table;
 };
 
 #endif // MATRIXFRESNELMAP_H
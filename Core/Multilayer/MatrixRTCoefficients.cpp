@@ -21,10 +21,7 @@ MatrixRTCoefficients *MatrixRTCoefficients::clone() const
 
 Eigen::Vector2cd MatrixRTCoefficients::T1plus() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = T1m*phi_psi_plus;
-    result(0) = m(2);
-    result(1) = m(3);
+    Eigen::Vector2cd result = T1m.bottomRows<2>()*phi_psi_plus;
     if (lambda(0)==0.0 && result==Eigen::Vector2cd::Zero())
         result(0) = 0.5;
     return result;
@@ -32,22 +29,18 @@ Eigen::Vector2cd MatrixRTCoefficients::T1plus() const
 
 Eigen::Vector2cd MatrixRTCoefficients::R1plus() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = R1m*phi_psi_plus;
-    result(0) = m(2);
-    result(1) = m(3);
-    Eigen::Matrix<complex_t, 4, 1> mT = T1m*phi_psi_plus;
-    if (lambda(0)==0.0 && mT(2)==0.0 && mT(3)==0.0)
-        result(0) = -0.5;
+    Eigen::Vector2cd result = R1m.bottomRows<2>()*phi_psi_plus;
+    if (lambda(0)==0.0) {
+        Eigen::Vector2cd mT = T1m.bottomRows<2>()*phi_psi_plus;
+        if (mT==Eigen::Vector2cd::Zero())
+            result(0) = -0.5;
+    }
     return result;
 }
 
 Eigen::Vector2cd MatrixRTCoefficients::T2plus() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = T2m*phi_psi_plus;
-    result(0) = m(2);
-    result(1) = m(3);
+    Eigen::Vector2cd result = T2m.bottomRows<2>()*phi_psi_plus;
     if (lambda(1)==0.0 && result==Eigen::Vector2cd::Zero())
         result(0) = 0.5;
     return result;
@@ -55,22 +48,18 @@ Eigen::Vector2cd MatrixRTCoefficients::T2plus() const
 
 Eigen::Vector2cd MatrixRTCoefficients::R2plus() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = R2m*phi_psi_plus;
-    result(0) = m(2);
-    result(1) = m(3);
-    Eigen::Matrix<complex_t, 4, 1> mT = T2m*phi_psi_plus;
-    if (lambda(1)==0.0 && mT(2)==0.0 && mT(3)==0.0)
-        result(0) = -0.5;
+    Eigen::Vector2cd result = R2m.bottomRows<2>()*phi_psi_plus;
+    if (lambda(1)==0.0) {
+        Eigen::Vector2cd mT = T2m.bottomRows<2>()*phi_psi_plus;
+        if (mT==Eigen::Vector2cd::Zero())
+            result(0) = -0.5;
+    }
     return result;
 }
 
 Eigen::Vector2cd MatrixRTCoefficients::T1min() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = T1m*phi_psi_min;
-    result(0) = m(2);
-    result(1) = m(3);
+    Eigen::Vector2cd result = T1m.bottomRows<2>()*phi_psi_min;
     if (lambda(0)==0.0 && result==Eigen::Vector2cd::Zero())
         result(1) = 0.5;
     return result;
@@ -78,22 +67,18 @@ Eigen::Vector2cd MatrixRTCoefficients::T1min() const
 
 Eigen::Vector2cd MatrixRTCoefficients::R1min() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = R1m*phi_psi_min;
-    result(0) = m(2);
-    result(1) = m(3);
-    Eigen::Matrix<complex_t, 4, 1> mT = T1m*phi_psi_min;
-    if (lambda(0)==0.0 && mT(2)==0.0 && mT(3)==0.0)
-        result(1) = -0.5;
+    Eigen::Vector2cd result = R1m.bottomRows<2>()*phi_psi_min;
+    if (lambda(0)==0.0) {
+        Eigen::Vector2cd mT = T1m.bottomRows<2>()*phi_psi_min;
+        if (mT==Eigen::Vector2cd::Zero())
+            result(1) = -0.5;
+    }
     return result;
 }
 
 Eigen::Vector2cd MatrixRTCoefficients::T2min() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = T2m*phi_psi_min;
-    result(0) = m(2);
-    result(1) = m(3);
+    Eigen::Vector2cd result = T2m.bottomRows<2>()*phi_psi_min;
     if (lambda(1)==0.0 && result==Eigen::Vector2cd::Zero())
         result(1) = 0.5;
     return result;
@@ -101,13 +86,12 @@ Eigen::Vector2cd MatrixRTCoefficients::T2min() const
 
 Eigen::Vector2cd MatrixRTCoefficients::R2min() const
 {
-    Eigen::Vector2cd result;
-    Eigen::Matrix<complex_t, 4, 1> m = R2m*phi_psi_min;
-    result(0) = m(2);
-    result(1) = m(3);
-    Eigen::Matrix<complex_t, 4, 1> mT = T2m*phi_psi_min;
-    if (lambda(1)==0.0 && mT(2)==0.0 && mT(3)==0.0)
-        result(1) = -0.5;
+    Eigen::Vector2cd result = R2m.bottomRows<2>()*phi_psi_min;
+    if (lambda(1)==0.0) {
+        Eigen::Vector2cd mT = T2m.bottomRows<2>()*phi_psi_min;
+        if (mT==Eigen::Vector2cd::Zero())
+            result(1) = -0.5;
+    }
     return result;
 }
 
@@ -121,6 +105,8 @@ void MatrixRTCoefficients::calculateTRMatrices()
     if (lambda(0)==0.0) {
         complex_t ikt = mul_I( m_kt );
         // Lambda1 component contained only in T1m (R1m=0)
+        T1m.setZero();
+        R1m.setZero();
         // row 0:
         T1m(0,0) = (1.0 - m_bz/m_b_mag)/2.0;
         T1m(0,1) = - m_scatt_matrix(0,1)/2.0/m_b_mag;
@@ -187,6 +173,8 @@ void MatrixRTCoefficients::calculateTRMatrices()
     if (lambda(1)==0.0) {
         complex_t ikt = mul_I(m_kt);
         // Lambda2 component contained only in T2m (R2m=0)
+        T2m.setZero();
+        R2m.setZero();
         // row 0:
         T2m(0,0) = (1.0 + m_bz/m_b_mag)/2.0;
         T2m(0,1) = m_scatt_matrix(0,1)/2.0/m_b_mag;
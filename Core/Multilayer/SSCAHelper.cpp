@@ -17,69 +17,62 @@
 #include "FormFactorCoherentSum.h"
 #include "InterferenceFunctionRadialParaCrystal.h"
 
-SSCAHelper::SSCAHelper(double kappa) : m_kappa(kappa), m_mean_radius{} {}
+SSCAHelper::SSCAHelper(double kappa) : m_kappa(kappa), mp_iff_radial(nullptr) {}
 
-void SSCAHelper::init(const std::vector<FormFactorCoherentSum>& ff_wrappers)
+void SSCAHelper::init(const std::vector<FormFactorCoherentSum>& ff_wrappers,
+                      const IInterferenceFunction* p_iff)
 {
-    m_mean_radius = 0.0;
-    for (auto& ffw : ff_wrappers)
-        m_mean_radius += ffw.relativeAbundance() * ffw.radialExtension();
-}
+    mp_iff_radial = dynamic_cast<const InterferenceFunctionRadialParaCrystal*>(p_iff);
+    if (!mp_iff_radial)
+        throw Exceptions::ClassInitializationException("Wrong interference function for SSCA");
 
-complex_t SSCAHelper::getCharacteristicSizeCoupling(
-    double qp, const std::vector<FormFactorCoherentSum>& ff_wrappers) const
-{
-    complex_t result{};
+    m_abundances.clear();
+    m_radial_offsets.clear();
+    double mean_radius = 0.0;
     for (auto& ffw : ff_wrappers) {
-        double radial_extension = ffw.radialExtension();
-        result +=
-            ffw.relativeAbundance() * calculatePositionOffsetPhase(2.0 * qp, radial_extension);
+        m_abundances.push_back(ffw.relativeAbundance());
+        m_radial_offsets.push_back(ffw.radialExtension());
+        mean_radius += m_abundances.back() * m_radial_offsets.back();
     }
-    return result;
-}
-
-complex_t SSCAHelper::getCharacteristicDistribution(double qp,
-                                                    const IInterferenceFunction* p_iff) const
-{
-    const InterferenceFunctionRadialParaCrystal* p_iff_radial =
-        dynamic_cast<const InterferenceFunctionRadialParaCrystal*>(p_iff);
-    if (!p_iff_radial)
-        throw Exceptions::ClassInitializationException("Wrong interference function for SSCA");
-    return p_iff_radial->FTPDF(qp);
+    for (auto& offset : m_radial_offsets)
+        offset -= mean_radius;
 }
 
-complex_t SSCAHelper::calculatePositionOffsetPhase(double qp, double radial_extension) const
+complex_t SSCAHelper::getCharacteristicDistribution(double qp) const
 {
-    return exp_I(m_kappa * qp * (radial_extension - m_mean_radius));
+    return mp_iff_radial->FTPDF(qp);
 }
 
+//! The characteristic size coupling is the mean of the squared phase factors, i.e. of the phase
+//! factors for 2*qp.
 complex_t
 SSCAHelper::getMeanFormfactorNorm(double qp, const std::vector<complex_t>& precomputed_ff,
-                                  const std::vector<FormFactorCoherentSum>& ff_wrappers) const
+                                  complex_t& p2kappa) const
 {
     complex_t ff_orig = 0., ff_conj = 0.; // original and conjugated mean formfactor
-    for (size_t i = 0; i < ff_wrappers.size(); ++i) {
-        double radial_extension = ff_wrappers[i].radialExtension();
-        complex_t prefac =
-            ff_wrappers[i].relativeAbundance() * calculatePositionOffsetPhase(qp, radial_extension);
+    p2kappa = 0.;
+    for (size_t i = 0; i < m_abundances.size(); ++i) {
+        complex_t phase = exp_I(m_kappa * qp * m_radial_offsets[i]);
+        complex_t prefac = m_abundances[i] * phase;
         ff_orig += prefac * precomputed_ff[i];
         ff_conj += prefac * std::conj(precomputed_ff[i]);
+        p2kappa += prefac * phase;
     }
     return ff_orig * ff_conj;
 }
 
 void SSCAHelper::getMeanFormfactors(
     double qp, Eigen::Matrix2cd& ff_orig, Eigen::Matrix2cd& ff_conj,
-    const InterferenceFunctionUtils::matrixFFVector_t& precomputed_ff,
-    const std::vector<FormFactorCoherentSum>& ff_wrappers) const
+    const InterferenceFunctionUtils::matrixFFVector_t& precomputed_ff, complex_t& p2kappa) const
 {
     ff_orig = Eigen::Matrix2cd::Zero();
     ff_conj = Eigen::Matrix2cd::Zero();
-    for (size_t i = 0; i < ff_wrappers.size(); ++i) {
-        double radial_extension = ff_wrappers[i].radialExtension();
-        complex_t prefac =
-            ff_wrappers[i].relativeAbundance() * calculatePositionOffsetPhase(qp, radial_extension);
+    p2kappa = 0.;
+    for (size_t i = 0; i < m_abundances.size(); ++i) {
+        complex_t phase = exp_I(m_kappa * qp * m_radial_offsets[i]);
+        complex_t prefac = m_abundances[i] * phase;
         ff_orig += prefac * precomputed_ff[i];
         ff_conj += prefac * precomputed_ff[i].adjoint();
+        p2kappa += prefac * phase;
     }
 }
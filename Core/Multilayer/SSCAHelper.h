@@ -22,9 +22,13 @@
 
 class FormFactorCoherentSum;
 class IInterferenceFunction;
+class InterferenceFunctionRadialParaCrystal;
 
 //! Helper class for SSCApproximationStrategy, offering some methods, shared between
-//! the scalar and polarized scattering calculations
+//! the scalar and polarized scattering calculations.
+//!
+//! The radial extensions and abundances of the particle species are tabulated at init, such
+//! that each pixel needs one phase factor exp(i*kappa*qp*(R_i-R_mean)) per species.
 //! @ingroup algorithms_internal
 
 class SSCAHelper
@@ -32,21 +36,28 @@ class SSCAHelper
 public:
     SSCAHelper(double kappa);
 
-    void init(const std::vector<FormFactorCoherentSum>& ff_wrappers);
+    void init(const std::vector<FormFactorCoherentSum>& ff_wrappers,
+              const IInterferenceFunction* p_iff);
+
+    complex_t getCharacteristicDistribution(double qp) const;
 
-    complex_t getCharacteristicSizeCoupling(double qp,
-            const std::vector<FormFactorCoherentSum>& ff_wrappers) const;
-    complex_t getCharacteristicDistribution(double qp, const IInterferenceFunction* p_iff) const;
-    complex_t calculatePositionOffsetPhase(double qp, double radial_extension) const;
+    //! Returns the norm of the mean form factor, and sets p2kappa to the characteristic
+    //! size coupling
     complex_t getMeanFormfactorNorm(double qp, const std::vector<complex_t>& precomputed_ff,
-            const std::vector<FormFactorCoherentSum>& ff_wrappers) const;
+                                    complex_t& p2kappa) const;
+
+    //! Sets the original and conjugated mean form factors, and p2kappa to the characteristic
+    //! size coupling
     void getMeanFormfactors(double qp, Eigen::Matrix2cd& ff_orig, Eigen::Matrix2cd& ff_conj,
                             const InterferenceFunctionUtils::matrixFFVector_t& precomputed_ff,
-                            const std::vector<FormFactorCoherentSum>& ff_wrappers) const;
+                            complex_t& p2kappa) const;
 
 private:
     double m_kappa;
-    double m_mean_radius;
+    const InterferenceFunctionRadialParaCrystal* mp_iff_radial;
+    std::vector<double> m_abundances;
+    //! Radial extensions of the species, relative to their mean
+    std::vector<double> m_radial_offsets;
 };
 
 #endif // SSCAHELPER_H
@@ -15,11 +15,12 @@
 #include "SSCApproximationStrategy.h"
 #include "FormFactorCoherentSum.h"
 #include "IInterferenceFunction.h"
+#include "Instrumentation.h"
 #include "InterferenceFunctionUtils.h"
 #include "SimulationElement.h"
 
-using InterferenceFunctionUtils::PrecomputeScalarFormFactors;
 using InterferenceFunctionUtils::PrecomputePolarizedFormFactors;
+using InterferenceFunctionUtils::SpinChannelWeights;
 
 SSCApproximationStrategy::SSCApproximationStrategy(SimulationOptions sim_params, double kappa,
                                                      bool polarized)
@@ -29,7 +30,7 @@ SSCApproximationStrategy::SSCApproximationStrategy(SimulationOptions sim_params,
 
 void SSCApproximationStrategy::strategy_specific_post_init()
 {
-    m_helper.init(m_formfactor_wrappers);
+    m_helper.init(formFactors(), mp_iff);
 }
 
 //! Returns the total scattering intensity for given kf and
@@ -39,37 +40,61 @@ double SSCApproximationStrategy::scalarCalculation(const SimulationElement& sim_
 {
     double qp = sim_element.getMeanQ().magxy();
     double diffuse_intensity = 0.0;
-    auto precomputed_ff = PrecomputeScalarFormFactors(sim_element, m_formfactor_wrappers);
-    for (size_t i = 0; i < m_formfactor_wrappers.size(); ++i) {
+    auto precomputed_ff = scalarFormFactors(sim_element);
+    for (size_t i = 0; i < formFactors().size(); ++i) {
         complex_t ff = precomputed_ff[i];
-        double fraction = m_formfactor_wrappers[i].relativeAbundance();
+        double fraction = formFactors()[i].relativeAbundance();
         diffuse_intensity += fraction * std::norm(ff);
     }
-    complex_t mean_ff_norm  = m_helper.getMeanFormfactorNorm(qp, precomputed_ff,
-                                                             m_formfactor_wrappers);
-    complex_t p2kappa = m_helper.getCharacteristicSizeCoupling(qp, m_formfactor_wrappers);
-    complex_t omega = m_helper.getCharacteristicDistribution(qp, mP_iff.get());
+    complex_t p2kappa;
+    complex_t mean_ff_norm = m_helper.getMeanFormfactorNorm(qp, precomputed_ff, p2kappa);
+    complex_t omega;
+    {
+        BA_INSTRUMENT_SCOPE(InterferenceFunctions);
+        omega = m_helper.getCharacteristicDistribution(qp);
+    }
     double iff = 2.0 * (mean_ff_norm * omega / (1.0 - p2kappa * omega)).real();
-    double dw_factor = mP_iff->DWfactor(sim_element.getMeanQ());
+    double dw_factor = mp_iff->DWfactor(sim_element.getMeanQ());
     return diffuse_intensity + dw_factor * iff;
 }
 
-//! This is the polarized version
+//! This is the polarized version. If polarization and analyzer are diagonal in the spin basis
+//! along z, the traces reduce to weighted sums over the spin channels.
 double SSCApproximationStrategy::polarizedCalculation(const SimulationElement& sim_element) const
 {
     double qp = sim_element.getMeanQ().magxy();
     Eigen::Matrix2cd diffuse_matrix = Eigen::Matrix2cd::Zero();
-    auto precomputed_ff = PrecomputePolarizedFormFactors(sim_element, m_formfactor_wrappers);
+    double channel_diffuse = 0.0;
+    auto precomputed_ff = PrecomputePolarizedFormFactors(sim_element, formFactors());
     const auto& polarization_handler = sim_element.polarizationHandler();
-    for (size_t i = 0; i < m_formfactor_wrappers.size(); ++i) {
+    Eigen::Matrix2d channel_weights;
+    const bool spin_channels = SpinChannelWeights(polarization_handler, channel_weights);
+    for (size_t i = 0; i < formFactors().size(); ++i) {
         Eigen::Matrix2cd ff = precomputed_ff[i];
-        double fraction = m_formfactor_wrappers[i].relativeAbundance();
-        diffuse_matrix += fraction * (ff * polarization_handler.getPolarization() * ff.adjoint());
+        double fraction = formFactors()[i].relativeAbundance();
+        if (spin_channels)
+            channel_diffuse += fraction * (channel_weights.array() * ff.array().abs2()).sum();
+        else
+            diffuse_matrix +=
+                fraction * (ff * polarization_handler.getPolarization() * ff.adjoint());
     }
     Eigen::Matrix2cd mff_orig, mff_conj; // original and conjugated mean formfactor
-    m_helper.getMeanFormfactors(qp, mff_orig, mff_conj, precomputed_ff, m_formfactor_wrappers);
-    complex_t p2kappa = m_helper.getCharacteristicSizeCoupling(qp, m_formfactor_wrappers);
-    complex_t omega = m_helper.getCharacteristicDistribution(qp, mP_iff.get());
+    complex_t p2kappa;
+    m_helper.getMeanFormfactors(qp, mff_orig, mff_conj, precomputed_ff, p2kappa);
+    complex_t omega;
+    {
+        BA_INSTRUMENT_SCOPE(InterferenceFunctions);
+        omega = m_helper.getCharacteristicDistribution(qp);
+    }
+    double dw_factor = mp_iff->DWfactor(sim_element.getMeanQ());
+    if (spin_channels) {
+        complex_t channel_interference =
+            (channel_weights.cast<complex_t>().array() * mff_orig.array()
+             * mff_conj.transpose().array()).sum();
+        double interference_trace =
+            std::abs(2.0 * omega / (1.0 - p2kappa * omega) * channel_interference);
+        return std::abs(channel_diffuse) + dw_factor * interference_trace;
+    }
     Eigen::Matrix2cd interference_matrix
         = (2.0 * omega / (1.0 - p2kappa * omega))
         * polarization_handler.getAnalyzerOperator() * mff_orig
@@ -77,6 +102,5 @@ double SSCApproximationStrategy::polarizedCalculation(const SimulationElement& s
     Eigen::Matrix2cd diffuse_matrix2 = polarization_handler.getAnalyzerOperator() * diffuse_matrix;
     double interference_trace = std::abs(interference_matrix.trace());
     double diffuse_trace = std::abs(diffuse_matrix2.trace());
-    double dw_factor = mP_iff->DWfactor(sim_element.getMeanQ());
     return diffuse_trace + dw_factor * interference_trace;
 }
@@ -13,6 +13,7 @@
 // ************************************************************************** //
 
 #include "ScalarFresnelMap.h"
+#include "Instrumentation.h"
 #include "ScalarRTCoefficients.h"
 #include "SimulationElement.h"
 #include "Slice.h"
@@ -29,24 +30,42 @@ ScalarFresnelMap::getOutCoefficients(const SimulationElement& sim_element, size_
     return getCoefficients(-sim_element.getMeanKf(), layer_index);
 }
 
+void ScalarFresnelMap::clearCache()
+{
+    m_cache.clear();
+}
+
 std::unique_ptr<const ILayerRTCoefficients>
 ScalarFresnelMap::getCoefficients(const kvector_t& kvec, size_t layer_index) const
 {
     if (!m_use_cache) {
+        BA_INSTRUMENT_SCOPE(FresnelCoefficients);
         auto coeffs = SpecularMatrix::Execute(m_slices, kvec);
         return std::make_unique<const ScalarRTCoefficients>(coeffs[layer_index]);
     }
-    const auto& coef_vector = getCoefficientsFromCache(kvec);
-    return std::make_unique<const ScalarRTCoefficients>(coef_vector[layer_index]);
+    return std::make_unique<const ScalarRTCoefficients>(
+        getCoefficientsFromCache(kvec, layer_index));
 }
 
-const std::vector<ScalarRTCoefficients>&
-ScalarFresnelMap::getCoefficientsFromCache(kvector_t kvec) const
+//! Looks up the coefficients under the lock of their cache shard, but computes missing ones
+//! outside of it.
+ScalarRTCoefficients ScalarFresnelMap::getCoefficientsFromCache(kvector_t kvec,
+                                                                size_t layer_index) const
 {
+    BA_INSTRUMENT_COUNT(FresnelLookups, 1);
     std::pair<double, double> k2_theta(kvec.mag2(), kvec.theta());
-    auto it = m_cache.find(k2_theta);
-    if (it == m_cache.end()) {
-        it = m_cache.insert({k2_theta, SpecularMatrix::Execute(m_slices, kvec)}).first;
+    ScalarRTCoefficients result;
+    auto pick = [&result, layer_index](const std::vector<ScalarRTCoefficients>& coeffs) {
+        result = coeffs[layer_index];
+    };
+    if (m_cache.find(k2_theta, pick))
+        return result;
+    BA_INSTRUMENT_COUNT(FresnelCacheMisses, 1);
+    std::vector<ScalarRTCoefficients> coeffs;
+    {
+        BA_INSTRUMENT_SCOPE(FresnelCoefficients);
+        coeffs = SpecularMatrix::Execute(m_slices, kvec);
     }
-    return it->second;
+    m_cache.insert(k2_theta, std::move(coeffs), pick);
+    return result;
 }
@@ -18,7 +18,7 @@
 #include "Hash2Doubles.h"
 #include "IFresnelMap.h"
 #include "ScalarRTCoefficients.h"
-#include <unordered_map>
+#include "ShardedCache.h"
 #include <utility>
 #include <vector>
 
@@ -38,12 +38,14 @@ public:
     std::unique_ptr<const ILayerRTCoefficients>
     getOutCoefficients(const SimulationElement& sim_element, size_t layer_index) const override;
 
+    void clearCache() override;
+
 private:
     std::unique_ptr<const ILayerRTCoefficients> getCoefficients(const kvector_t& kvec,
                                                                 size_t layer_index) const override;
-    const std::vector<ScalarRTCoefficients>& getCoefficientsFromCache(kvector_t kvec) const;
-    mutable std::unordered_map<std::pair<double, double>, std::vector<ScalarRTCoefficients>,
-                               Hash2Doubles> m_cache;
+    ScalarRTCoefficients getCoefficientsFromCache(kvector_t kvec, size_t layer_index) const;
+    mutable ShardedCache<std::pair<double, double>, std::vector<ScalarRTCoefficients>,
+                         Hash2Doubles> m_cache;
 };
 
 #endif // SCALARFRESNELMAP_H
@@ -13,141 +13,464 @@
 // ************************************************************************** //
 
 #include "SpecularMagnetic.h"
-#include "Layer.h"
-#include "LayerInterface.h"
-#include "MultiLayer.h"
+#include "MaterialUtils.h"
 #include "Slice.h"
-#include "WavevectorInfo.h"
-#include <Eigen/LU>
+#include <algorithm>
+#include <cmath>
 
 namespace
 {
-void CalculateEigenvalues(const std::vector<Slice> &slices, const kvector_t k,
-                          std::vector<MatrixRTCoefficients>& coeff);
-void CalculateTransferAndBoundary(const std::vector<Slice> &slices, const kvector_t k,
-                                  std::vector<MatrixRTCoefficients>& coeff);
-void SetForNoTransmission(std::vector<MatrixRTCoefficients>& coeff);
-complex_t GetImExponential(complex_t exponent);
+// Eigenvalues and boundary values of all slices for a batch of wavevectors, stored as a
+// structure of arrays. The entries of slice i and wavevector j are at index i * n_k + j.
+struct Batch {
+    Batch(size_t slice_count, size_t k_count);
+    size_t index(size_t i, size_t j) const { return i * n_k + j; }
+
+    size_t n_slices;
+    size_t n_k;
+    std::vector<double> mag_k;      //!< length of the wavevectors
+    std::vector<double> sign_kz;    //!< sign convention for kz of the wavevectors
+    std::vector<double> thickness;  //!< thickness of the slices
+    std::vector<complex_t> a;       //!< polarization independent part of the potential
+    std::vector<complex_t> b_mag;   //!< magnitude of the magnetic part
+    std::vector<complex_t> bz;      //!< z-part of the magnetic part
+    std::vector<complex_t> m01;     //!< off-diagonal elements of the magnetic part
+    std::vector<complex_t> m10;
+    std::vector<complex_t> lambda0; //!< eigenvalues of the transfer matrix
+    std::vector<complex_t> lambda1;
+    std::vector<complex_t> projection[4]; //!< projection onto the first mode, row major
+    std::vector<complex_t> mu[2];         //!< eigenvalues entering the transfer matrices
+    std::vector<complex_t> inverse_mu[2];
+    std::vector<complex_t> plus[4]; //!< boundary values phi_psi_plus
+    std::vector<complex_t> min[4];  //!< boundary values phi_psi_min
+    std::vector<double> log_scale;  //!< logarithm of the rescaling relative to the slice below
+};
+
+// The two eigenmodes of a slice for one wavevector. The transfer matrix of mode m,
+// R_m * exp(ikz t) + T_m * exp(-ikz t), has the 2x2 blocks
+//   (diagonal * P_m, upper * P_m; lower * P_m, diagonal * P_m)
+// with the projection P_m onto the mode (see MatrixRTCoefficients::calculateTRMatrices).
+// The projections add up to the unit matrix.
+struct Modes {
+    complex_t projection[2][4]; //!< P_m in row major order
+    complex_t mu[2];
+    complex_t inverse_mu[2];
+    bool degenerate[2];         //!< vanishing eigenvalue, the mode has no reflected part
+    complex_t ikt;              //!< i times length of wavevector times thickness
+};
+
+struct BlockFactors {
+    complex_t diagonal;
+    complex_t upper;
+    complex_t lower;
+};
+
+void CalculateEigenvalues(const std::vector<Slice>& slices, const std::vector<kvector_t>& ks,
+                          Batch& batch);
+void SetProjection(Batch& batch, size_t index);
+void CalculateTransferAndBoundary(Batch& batch);
+void InitializeBottomLayer(Batch& batch);
+void Propagate(Batch& batch, size_t i);
+void Normalize(Batch& batch);
+void StoreCoefficients(const Batch& batch, std::vector<MatrixRTCoefficients>& coeff);
+Modes GetModes(const Batch& batch, size_t i, size_t j);
+BlockFactors GetBlockFactors(const Modes& modes, size_t m, complex_t exp_T, complex_t exp_R);
+void AddMode(const complex_t* p, const BlockFactors& f, const complex_t* phi_psi,
+             complex_t* result);
+void ShiftedExponentials(complex_t z, double shift, complex_t& exp_plus, complex_t& exp_minus);
+void Transmitted(const Batch& batch, size_t j, const complex_t* phi_psi, size_t component,
+                 complex_t* result);
 const complex_t I(0, 1);
+const double wavelength_tolerance = 1e-12;
+}
+
+void SpecularMagnetic::Execute(const std::vector<Slice>& slices, const kvector_t k,
+                               std::vector<MatrixRTCoefficients>& coeff)
+{
+    Execute(slices, std::vector<kvector_t>{k}, coeff);
+}
+
+void SpecularMagnetic::Execute(const std::vector<Slice>& slices, const std::vector<kvector_t>& ks,
+                               std::vector<MatrixRTCoefficients>& coeff)
+{
+    if (slices.empty() || ks.empty()) {
+        coeff.clear();
+        return;
+    }
+    Batch batch(slices.size(), ks.size());
+    CalculateEigenvalues(slices, ks, batch);
+    CalculateTransferAndBoundary(batch);
+    StoreCoefficients(batch, coeff);
+}
+
+namespace
+{
+Batch::Batch(size_t slice_count, size_t k_count)
+    : n_slices(slice_count), n_k(k_count), mag_k(k_count), sign_kz(k_count),
+      thickness(slice_count)
+{
+    const size_t size = n_slices * n_k;
+    for (auto* values : {&a, &b_mag, &bz, &m01, &m10, &lambda0, &lambda1, &mu[0], &mu[1],
+                         &inverse_mu[0], &inverse_mu[1]})
+        values->resize(size);
+    for (size_t c = 0; c < 4; ++c) {
+        projection[c].resize(size);
+        plus[c].resize(size);
+        min[c].resize(size);
+    }
+    log_scale.resize(size, 0.0);
 }
 
-void SpecularMagnetic::Execute(const std::vector<Slice> &slices, const kvector_t k, std::vector<MatrixRTCoefficients> &coeff)
-{
-    coeff.clear();
-    coeff.resize(slices.size());
-    CalculateEigenvalues(slices, k, coeff);
-    CalculateTransferAndBoundary(slices, k, coeff);
-}
-
-namespace {
-void CalculateEigenvalues(const std::vector<Slice> &slices, const kvector_t k,
-                          std::vector<MatrixRTCoefficients>& coeff)
-{
-    double mag_k = k.mag();
-    double n_ref = slices[0].material().refractiveIndex(2 * M_PI / mag_k).real();
-    double sign_kz = k.z() > 0.0 ? -1.0 : 1.0;
-    for (size_t i = 0; i < coeff.size(); ++i) {
-        coeff[i].m_scatt_matrix = slices[i].polarizedReducedPotential(k, n_ref);
-        coeff[i].m_kt = mag_k * slices[i].thickness();
-        coeff[i].m_a = coeff[i].m_scatt_matrix.trace() / 2.0;
-        coeff[i].m_b_mag =
-            sqrt(coeff[i].m_a * coeff[i].m_a - coeff[i].m_scatt_matrix.determinant());
-        coeff[i].m_bz = (coeff[i].m_scatt_matrix(0, 0) - coeff[i].m_scatt_matrix(1, 1)) / 2.0;
-        complex_t rad0 = coeff[i].m_a - coeff[i].m_b_mag;
-        complex_t rad1 = coeff[i].m_a + coeff[i].m_b_mag;
-        // use small absorptive component for layers with i>0 if radicand becomes very small:
-        if (i > 0) {
-            if (std::abs(rad0) < 1e-40)
-                rad0 = I * 1e-40;
-            if (std::abs(rad1) < 1e-40)
-                rad1 = I * 1e-40;
+// The refractive indices and the magnetic part of the potential only depend on the length of
+// the wavevector. They are only recomputed where it changes within the batch, beyond the
+// rounding errors of wavevectors of the same wavelength.
+void CalculateEigenvalues(const std::vector<Slice>& slices, const std::vector<kvector_t>& ks,
+                          Batch& batch)
+{
+    std::vector<char> new_wavelength(batch.n_k);
+    std::vector<double> n_ref(batch.n_k);
+    size_t first = 0;
+    for (size_t j = 0; j < batch.n_k; ++j) {
+        batch.mag_k[j] = ks[j].mag();
+        batch.sign_kz[j] = ks[j].z() > 0.0 ? -1.0 : 1.0;
+        new_wavelength[j] = j == 0
+                            || std::abs(batch.mag_k[j] - batch.mag_k[first])
+                                   > wavelength_tolerance * batch.mag_k[first];
+        if (new_wavelength[j]) {
+            first = j;
+            n_ref[j] = slices[0].material().refractiveIndex(2 * M_PI / batch.mag_k[j]).real();
+        } else {
+            n_ref[j] = n_ref[first];
+        }
+    }
+    for (size_t i = 0; i < batch.n_slices; ++i) {
+        batch.thickness[i] = slices[i].thickness();
+        complex_t n = 0.0;
+        for (size_t j = 0; j < batch.n_k; ++j) {
+            const size_t index = batch.index(i, j);
+            if (new_wavelength[j]) {
+                n = slices[i].material().refractiveIndex(2 * M_PI / batch.mag_k[j]);
+                const Eigen::Matrix2cd potential =
+                    slices[i].polarizedReducedPotential(ks[j], n_ref[j]);
+                batch.bz[index] = (potential(0, 0) - potential(1, 1)) / 2.0;
+                batch.m01[index] = potential(0, 1);
+                batch.m10[index] = potential(1, 0);
+                // a^2 - det(potential), without the cancellation of the polarization
+                // independent part
+                batch.b_mag[index] = std::sqrt(batch.bz[index] * batch.bz[index]
+                                               + batch.m01[index] * batch.m10[index]);
+                SetProjection(batch, index);
+            } else {
+                batch.bz[index] = batch.bz[index - 1];
+                batch.m01[index] = batch.m01[index - 1];
+                batch.m10[index] = batch.m10[index - 1];
+                batch.b_mag[index] = batch.b_mag[index - 1];
+                for (size_t c = 0; c < 4; ++c)
+                    batch.projection[c][index] = batch.projection[c][index - 1];
+            }
+            batch.a[index] = MaterialUtils::ScalarReducedPotential(n, ks[j], n_ref[j]);
+            complex_t rad0 = batch.a[index] - batch.b_mag[index];
+            complex_t rad1 = batch.a[index] + batch.b_mag[index];
+            // use small absorptive component for layers with i>0 if radicand becomes very small:
+            if (i > 0) {
+                if (std::abs(rad0) < 1e-40)
+                    rad0 = I * 1e-40;
+                if (std::abs(rad1) < 1e-40)
+                    rad1 = I * 1e-40;
+            }
+            batch.lambda0[index] = std::sqrt(rad0);
+            batch.lambda1[index] = std::sqrt(rad1);
+            if (batch.b_mag[index] == 0.0) {
+                batch.mu[0][index] = batch.mu[1][index] = std::sqrt(batch.a[index]);
+            } else {
+                batch.mu[0][index] = batch.lambda0[index];
+                batch.mu[1][index] = batch.lambda1[index];
+            }
+            for (size_t m = 0; m < 2; ++m)
+                batch.inverse_mu[m][index] =
+                    batch.mu[m][index] == 0.0 ? 0.0 : 1.0 / batch.mu[m][index];
         }
-        coeff[i].lambda(0) = sqrt(rad0);
-        coeff[i].lambda(1) = sqrt(rad1);
-        coeff[i].kz = mag_k * coeff[i].lambda * sign_kz;
     }
 }
 
-// todo: avoid overflows (see SpecularMatrix.cpp)
-void CalculateTransferAndBoundary(const std::vector<Slice> &slices, const kvector_t k,
-                                  std::vector<MatrixRTCoefficients>& coeff)
+// Sets the projection onto the first mode, (1 - sigma.b / |b|) / 2 for the magnetic part
+// sigma.b of the potential. Without magnetization, the first mode is spin down.
+void SetProjection(Batch& batch, size_t index)
 {
-    (void)k;
-    size_t N = coeff.size();
-    if (coeff[0].lambda == Eigen::Vector2cd::Zero() && N > 1) {
-        SetForNoTransmission(coeff);
+    const complex_t b = batch.b_mag[index];
+    if (b == 0.0) {
+        batch.projection[0][index] = batch.projection[1][index] = 0.0;
+        batch.projection[2][index] = 0.0;
+        batch.projection[3][index] = 1.0;
         return;
     }
+    const complex_t inverse_b = 1.0 / b;
+    const complex_t bz = batch.bz[index] * inverse_b;
+    batch.projection[0][index] = (1.0 - bz) / 2.0;
+    batch.projection[1][index] = -batch.m01[index] * inverse_b / 2.0;
+    batch.projection[2][index] = -batch.m10[index] * inverse_b / 2.0;
+    batch.projection[3][index] = (1.0 + bz) / 2.0;
+}
+
+// The boundary values are propagated upwards from the bottom layer. To avoid overflows in
+// thick absorbing layers, they are rescaled in every layer; the common scale of the layers
+// above and including a given layer cancels in the final normalization, while the relative
+// scale of the layers below is restored in the normalization loop.
+void CalculateTransferAndBoundary(Batch& batch)
+{
+    InitializeBottomLayer(batch);
+    for (size_t i = batch.n_slices - 2; batch.n_slices > 2 && i > 0; --i)
+        Propagate(batch, i);
+    if (batch.n_slices > 1)
+        Normalize(batch);
+}
+
+// Boundary values of the bottom layer without upward going wave amplitudes
+// (see MatrixRTCoefficients::initializeBottomLayerPhiPsi)
+void InitializeBottomLayer(Batch& batch)
+{
+    const size_t i = batch.n_slices - 1;
+    for (size_t j = 0; j < batch.n_k; ++j) {
+        const size_t n = batch.index(i, j);
+        const complex_t l0 = batch.lambda0[n];
+        const complex_t l1 = batch.lambda1[n];
+        const complex_t b = batch.b_mag[n];
+        if (b == 0.0) {
+            const complex_t sqrt_a = std::sqrt(batch.a[n]);
+            batch.min[0][n] = 0.0;
+            batch.min[1][n] = -sqrt_a;
+            batch.plus[0][n] = -sqrt_a;
+            batch.plus[1][n] = 0.0;
+        } else {
+            batch.min[0][n] = batch.m01[n] * (l0 - l1) / 2.0 / b;
+            batch.min[1][n] = (batch.bz[n] * (l1 - l0) / b - l1 - l0) / 2.0;
+            batch.plus[0][n] = -(batch.a[n] + batch.bz[n] + l0 * l1) / (l0 + l1);
+            batch.plus[1][n] = batch.m10[n] * (l0 - l1) / 2.0 / b;
+        }
+        batch.min[2][n] = 0.0;
+        batch.min[3][n] = 1.0;
+        batch.plus[2][n] = 1.0;
+        batch.plus[3][n] = 0.0;
+    }
+}
+
+// Sets the boundary values at the top of slice i from those at the top of the slice below,
+// divided by the largest propagation factor and by the largest resulting component
+void Propagate(Batch& batch, size_t i)
+{
+    for (size_t j = 0; j < batch.n_k; ++j) {
+        const size_t n = batch.index(i, j);
+        const size_t below = batch.index(i + 1, j);
+        const Modes modes = GetModes(batch, i, j);
+        const double kt = batch.mag_k[j] * batch.sign_kz[j] * batch.thickness[i];
+        const complex_t ikz0t = I * batch.lambda0[n] * kt;
+        const complex_t ikz1t = I * batch.lambda1[n] * kt;
+        const double log_exp_max = std::max(std::abs(ikz0t.real()), std::abs(ikz1t.real()));
+        complex_t exp_T0, exp_R0, exp_T1, exp_R1;
+        ShiftedExponentials(ikz0t, log_exp_max, exp_R0, exp_T0);
+        ShiftedExponentials(ikz1t, log_exp_max, exp_R1, exp_T1);
+        const BlockFactors f0 = GetBlockFactors(modes, 0, exp_T0, exp_R0);
+        const BlockFactors f1 = GetBlockFactors(modes, 1, exp_T1, exp_R1);
 
-    // First, initialize bottom layer values to have no reflection
-    coeff[N - 1].initializeBottomLayerPhiPsi();
-    if (N > 1)
-        coeff[N - 1].calculateTRMatrices();
-
-    coeff[0].calculateTRMatrices();
-    for (int signed_index = static_cast<int>(N) - 2; signed_index > 0; --signed_index) {
-        size_t i = static_cast<size_t>(signed_index);
-        double t = slices[i].thickness();
-        coeff[i].calculateTRMatrices();
-        Eigen::Matrix4cd l = coeff[i].R1m * GetImExponential(coeff[i].kz(0) * t)
-                             + coeff[i].T1m * GetImExponential(-coeff[i].kz(0) * t)
-                             + coeff[i].R2m * GetImExponential(coeff[i].kz(1) * t)
-                             + coeff[i].T2m * GetImExponential(-coeff[i].kz(1) * t);
-        coeff[i].phi_psi_plus = l * coeff[i + 1].phi_psi_plus;
-        coeff[i].phi_psi_min = l * coeff[i + 1].phi_psi_min;
+        const complex_t plus_below[4] = {batch.plus[0][below], batch.plus[1][below],
+                                         batch.plus[2][below], batch.plus[3][below]};
+        const complex_t min_below[4] = {batch.min[0][below], batch.min[1][below],
+                                        batch.min[2][below], batch.min[3][below]};
+        complex_t plus[4] = {0.0, 0.0, 0.0, 0.0};
+        complex_t min[4] = {0.0, 0.0, 0.0, 0.0};
+        AddMode(modes.projection[0], f0, plus_below, plus);
+        AddMode(modes.projection[1], f1, plus_below, plus);
+        AddMode(modes.projection[0], f0, min_below, min);
+        AddMode(modes.projection[1], f1, min_below, min);
+
+        double norm = 0.0;
+        for (size_t c = 0; c < 4; ++c)
+            norm = std::max({norm, std::abs(plus[c].real()), std::abs(plus[c].imag()),
+                             std::abs(min[c].real()), std::abs(min[c].imag())});
+        batch.log_scale[n] = log_exp_max;
+        if (norm > 0.0)
+            batch.log_scale[n] += std::log(norm);
+        else
+            norm = 1.0;
+        for (size_t c = 0; c < 4; ++c) {
+            batch.plus[c][n] = plus[c] / norm;
+            batch.min[c][n] = min[c] / norm;
+        }
     }
-    // If more than one layer, impose normalization and correct correspondence
-    // for spin-z polarization in top layer
-    if (N > 1) {
+}
+
+// Imposes unit wave amplitude for both spin up and down in the top layer (without a
+// transmitted wave amplitude for the opposite polarization) and restores the scales of the
+// layers below
+void Normalize(Batch& batch)
+{
+    for (size_t j = 0; j < batch.n_k; ++j) {
         // First layer boundary is also top layer boundary:
-        coeff[0].phi_psi_plus = coeff[1].phi_psi_plus;
-        coeff[0].phi_psi_min = coeff[1].phi_psi_min;
-        // Normalize all boundary values such that top layer has unit wave
-        // amplitude for both spin up and down (and does not contain a
-        // transmitted wave amplitude for the opposite polarization)
-        Eigen::Vector2cd T0basisA = coeff[0].T1plus() + coeff[0].T2plus();
-        Eigen::Vector2cd T0basisB = coeff[0].T1min() + coeff[0].T2min();
-        complex_t cpA, cpB, cmA, cmB;
-        cpA = T0basisB(1);
-        cpB = -T0basisA(1);
-        cmA = T0basisB(0);
-        cmB = -T0basisA(0);
-        Eigen::Vector4cd phipsitemp = cpA * coeff[0].phi_psi_plus + cpB * coeff[0].phi_psi_min;
-        coeff[0].phi_psi_min = cmA * coeff[0].phi_psi_plus + cmB * coeff[0].phi_psi_min;
-        coeff[0].phi_psi_plus = phipsitemp;
-        Eigen::Vector2cd T0plusV = coeff[0].T1plus() + coeff[0].T2plus();
-        Eigen::Vector2cd T0minV = coeff[0].T1min() + coeff[0].T2min();
-        complex_t T0plus = T0plusV(0);
-        complex_t T0min = T0minV(1);
-        coeff[0].phi_psi_min = coeff[0].phi_psi_min / T0min;
-        coeff[0].phi_psi_plus = coeff[0].phi_psi_plus / T0plus;
-        for (size_t i = 1; i < N; ++i) {
-            phipsitemp = (cpA * coeff[i].phi_psi_plus + cpB * coeff[i].phi_psi_min) / T0plus;
-            coeff[i].phi_psi_min =
-                (cmA * coeff[i].phi_psi_plus + cmB * coeff[i].phi_psi_min) / T0min;
-            coeff[i].phi_psi_plus = phipsitemp;
+        const size_t top = batch.index(0, j);
+        for (size_t c = 0; c < 4; ++c) {
+            batch.plus[c][top] = batch.plus[c][batch.index(1, j)];
+            batch.min[c][top] = batch.min[c][batch.index(1, j)];
+        }
+        complex_t plus[4] = {batch.plus[0][top], batch.plus[1][top], batch.plus[2][top],
+                             batch.plus[3][top]};
+        complex_t min[4] = {batch.min[0][top], batch.min[1][top], batch.min[2][top],
+                            batch.min[3][top]};
+        complex_t basis_A[2], basis_B[2];
+        Transmitted(batch, j, plus, 0, basis_A);
+        Transmitted(batch, j, min, 1, basis_B);
+        const complex_t cpA = basis_B[1];
+        const complex_t cpB = -basis_A[1];
+        const complex_t cmA = basis_B[0];
+        const complex_t cmB = -basis_A[0];
+        for (size_t c = 0; c < 4; ++c) {
+            const complex_t plus_c = plus[c];
+            plus[c] = cpA * plus_c + cpB * min[c];
+            min[c] = cmA * plus_c + cmB * min[c];
+        }
+        complex_t transmitted_plus[2], transmitted_min[2];
+        Transmitted(batch, j, plus, 0, transmitted_plus);
+        Transmitted(batch, j, min, 1, transmitted_min);
+        const complex_t T0plus = transmitted_plus[0];
+        const complex_t T0min = transmitted_min[1];
+        for (size_t c = 0; c < 4; ++c) {
+            batch.plus[c][top] = plus[c] / T0plus;
+            batch.min[c][top] = min[c] / T0min;
+        }
+
+        double log_scale = 0.0;
+        for (size_t i = 1; i < batch.n_slices; ++i) {
+            const size_t n = batch.index(i, j);
+            if (i > 1)
+                log_scale -= batch.log_scale[batch.index(i - 1, j)];
+            const double scale = std::exp(log_scale);
+            const complex_t factor_plus = scale / T0plus;
+            const complex_t factor_min = scale / T0min;
+            for (size_t c = 0; c < 4; ++c) {
+                const complex_t plus_c = batch.plus[c][n];
+                batch.plus[c][n] = (cpA * plus_c + cpB * batch.min[c][n]) * factor_plus;
+                batch.min[c][n] = (cmA * plus_c + cmB * batch.min[c][n]) * factor_min;
+            }
+        }
+    }
+}
+
+// All members of the coefficients are overwritten, such that their storage can be reused
+void StoreCoefficients(const Batch& batch, std::vector<MatrixRTCoefficients>& coeff)
+{
+    const size_t N = batch.n_slices;
+    coeff.resize(batch.n_k * N);
+    for (size_t j = 0; j < batch.n_k; ++j) {
+        const size_t top = batch.index(0, j);
+        const bool transmission =
+            N == 1 || batch.lambda0[top] != 0.0 || batch.lambda1[top] != 0.0;
+        for (size_t i = 0; i < N; ++i) {
+            const size_t n = batch.index(i, j);
+            MatrixRTCoefficients& result = coeff[j * N + i];
+            result.lambda << batch.lambda0[n], batch.lambda1[n];
+            result.kz = batch.mag_k[j] * result.lambda * batch.sign_kz[j];
+            result.m_a = batch.a[n];
+            result.m_b_mag = batch.b_mag[n];
+            result.m_bz = batch.bz[n];
+            result.m_scatt_matrix << batch.a[n] + batch.bz[n], batch.m01[n], batch.m10[n],
+                batch.a[n] - batch.bz[n];
+            result.m_kt = batch.mag_k[j] * batch.thickness[i];
+            if (!transmission) {
+                result.phi_psi_plus.setZero();
+                result.phi_psi_min.setZero();
+                result.T1m = Eigen::Matrix4cd::Identity() / 4.0;
+                result.R1m = result.T1m;
+                result.T2m = result.T1m;
+                result.R2m = result.T1m;
+                continue;
+            }
+            result.phi_psi_plus << batch.plus[0][n], batch.plus[1][n], batch.plus[2][n],
+                batch.plus[3][n];
+            result.phi_psi_min << batch.min[0][n], batch.min[1][n], batch.min[2][n],
+                batch.min[3][n];
+            result.calculateTRMatrices();
         }
     }
 }
 
-void SetForNoTransmission(std::vector<MatrixRTCoefficients>& coeff)
+Modes GetModes(const Batch& batch, size_t i, size_t j)
+{
+    const size_t n = batch.index(i, j);
+    Modes result;
+    for (size_t c = 0; c < 4; ++c)
+        result.projection[0][c] = batch.projection[c][n];
+    result.projection[1][0] = result.projection[0][3];
+    result.projection[1][1] = -result.projection[0][1];
+    result.projection[1][2] = -result.projection[0][2];
+    result.projection[1][3] = result.projection[0][0];
+    const bool magnetic = batch.b_mag[n] != 0.0;
+    result.degenerate[0] = magnetic ? batch.lambda0[n] == 0.0 : batch.a[n] == 0.0;
+    result.degenerate[1] = magnetic ? batch.lambda1[n] == 0.0 : batch.a[n] == 0.0;
+    for (size_t m = 0; m < 2; ++m) {
+        result.mu[m] = batch.mu[m][n];
+        result.inverse_mu[m] = batch.inverse_mu[m][n];
+    }
+    result.ikt = I * (batch.mag_k[j] * batch.thickness[i]);
+    return result;
+}
+
+// Returns the block factors of T_m * exp_T + R_m * exp_R for mode m
+BlockFactors GetBlockFactors(const Modes& modes, size_t m, complex_t exp_T, complex_t exp_R)
 {
-    size_t N = coeff.size();
-    for (size_t i = 0; i < N; ++i) {
-        coeff[i].phi_psi_plus.setZero();
-        coeff[i].phi_psi_min.setZero();
-        coeff[i].T1m = Eigen::Matrix4cd::Identity() / 4.0;
-        coeff[i].R1m = coeff[i].T1m;
-        coeff[i].T2m = coeff[i].T1m;
-        coeff[i].R2m = coeff[i].T1m;
+    BlockFactors result;
+    if (modes.degenerate[m]) {
+        result.diagonal = exp_T;
+        result.upper = 0.0;
+        result.lower = modes.ikt * exp_T;
+        return result;
     }
+    const complex_t difference = (exp_T - exp_R) / 2.0;
+    result.diagonal = (exp_T + exp_R) / 2.0;
+    result.upper = -modes.mu[m] * difference;
+    result.lower = -difference * modes.inverse_mu[m];
+    return result;
+}
+
+// Adds the transfer matrix of one mode with projection p, applied to phi_psi, to result
+void AddMode(const complex_t* p, const BlockFactors& f, const complex_t* phi_psi,
+             complex_t* result)
+{
+    const complex_t u0 = p[0] * phi_psi[0] + p[1] * phi_psi[1];
+    const complex_t u1 = p[2] * phi_psi[0] + p[3] * phi_psi[1];
+    const complex_t w0 = p[0] * phi_psi[2] + p[1] * phi_psi[3];
+    const complex_t w1 = p[2] * phi_psi[2] + p[3] * phi_psi[3];
+    result[0] += f.diagonal * u0 + f.upper * w0;
+    result[1] += f.diagonal * u1 + f.upper * w1;
+    result[2] += f.lower * u0 + f.diagonal * w0;
+    result[3] += f.lower * u1 + f.diagonal * w1;
 }
 
-complex_t GetImExponential(complex_t exponent)
+// Computes exp(z - shift) and exp(-z - shift) with one evaluation of sine and cosine
+void ShiftedExponentials(complex_t z, double shift, complex_t& exp_plus, complex_t& exp_minus)
 {
-    if (exponent.imag() > -std::log(std::numeric_limits<double>::min()))
-        return 0.0;
-    return std::exp(I * exponent);
+    const double cos_y = std::cos(z.imag());
+    const double sin_y = std::sin(z.imag());
+    const double modulus_plus = std::exp(z.real() - shift);
+    const double modulus_minus = std::exp(-z.real() - shift);
+    exp_plus = complex_t(modulus_plus * cos_y, modulus_plus * sin_y);
+    exp_minus = complex_t(modulus_minus * cos_y, -modulus_minus * sin_y);
 }
-}  // unnamed namespace
 
+// Computes the sum of the transmitted amplitudes of both modes in the top layer, following
+// MatrixRTCoefficients::T1plus() etc.; component is 0 for phi_psi_plus and 1 for phi_psi_min
+void Transmitted(const Batch& batch, size_t j, const complex_t* phi_psi, size_t component,
+                 complex_t* result)
+{
+    const size_t n = batch.index(0, j);
+    const Modes modes = GetModes(batch, 0, j);
+    const complex_t lambda[2] = {batch.lambda0[n], batch.lambda1[n]};
+    result[0] = result[1] = 0.0;
+    for (size_t m = 0; m < 2; ++m) {
+        complex_t amplitudes[4] = {0.0, 0.0, 0.0, 0.0};
+        AddMode(modes.projection[m], GetBlockFactors(modes, m, 1.0, 0.0), phi_psi, amplitudes);
+        if (lambda[m] == 0.0 && amplitudes[2] == 0.0 && amplitudes[3] == 0.0)
+            amplitudes[2 + component] = 0.5;
+        result[0] += amplitudes[2];
+        result[1] += amplitudes[3];
+    }
+}
+} // unnamed namespace
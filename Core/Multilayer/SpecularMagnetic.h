@@ -31,6 +31,11 @@ namespace SpecularMagnetic
 //! for given sliced multilayer and wavevector k
 BA_CORE_API_ void Execute(const std::vector<Slice>& slices, const kvector_t k,
                           std::vector<MatrixRTCoefficients>& coeff);
+
+//! Computes the coefficients for a batch of wavevectors. The coefficients of slice i for
+//! wavevector ks[j] are stored in coeff[j * slices.size() + i].
+BA_CORE_API_ void Execute(const std::vector<Slice>& slices, const std::vector<kvector_t>& ks,
+                          std::vector<MatrixRTCoefficients>& coeff);
 }; // namespace SpecularMagnetic
 
 #endif // SPECULARMAGNETIC_H
@@ -19,7 +19,9 @@
 #include "MathConstants.h"
 #include "MathFunctions.h"
 #include "Slice.h"
+#include "Units.h"
 #include <Eigen/Dense>
+#include <algorithm>
 #include <stdexcept>
 #include <valarray>
 
@@ -39,6 +41,19 @@ size_t bisectRTcomputation(std::vector<ScalarRTCoefficients>& coeff,
 const LayerRoughness* GetBottomRoughness(const std::vector<Slice>& slices,
                                          const size_t slice_index);
 
+//! Matrix of the linear map performed by transition(), and its derivatives
+struct TransitionMatrix {
+    Eigen::Matrix2cd M;
+    Eigen::Matrix2cd dM_dkzi;
+    Eigen::Matrix2cd dM_dkzi1;
+    Eigen::Matrix2cd dM_dsigma;
+    Eigen::Matrix2cd dM_dthickness;
+};
+TransitionMatrix transitionMatrix(complex_t kzi, complex_t kzi1, double sigma, double thickness);
+complex_t logTanhcDerivative(complex_t z);
+void addSLDDerivatives(SpecularMatrix::ReflectionDerivatives& result,
+                       const std::vector<Slice>& slices, const std::vector<complex_t>& kz);
+
 const double pi2_15 = std::pow(M_PI_2, 1.5);
 } // namespace
 
@@ -56,6 +71,51 @@ std::vector<ScalarRTCoefficients> SpecularMatrix::Execute(const std::vector<Slic
     return computeTR(slices, kz);
 }
 
+//! With c_i the coefficients t_r of slice i, and M_i the transition matrices, c_i = M_i c_{i+1}.
+//! The derivative of R = c_0(1)/c_0(0) (with c_0(0) = 1) by a parameter of M_j is then
+//! w_j dM_j c_{j+1}, with the row vectors w_0 = (-R, 1) and w_{j+1} = w_j M_j.
+SpecularMatrix::ReflectionDerivatives
+SpecularMatrix::ExecuteDerivatives(const std::vector<Slice>& slices,
+                                   const std::vector<complex_t>& kz)
+{
+    assert(slices.size() == kz.size());
+    const size_t N = slices.size();
+    const auto coeff = computeTR(slices, kz);
+
+    ReflectionDerivatives result;
+    result.R = coeff[0].getScalarR();
+    result.dR_dkz.resize(N, 0.0);
+    result.dR_dthickness.resize(N, 0.0);
+    result.dR_dsigma.resize(N, 0.0);
+
+    // slices below the deepest one with nonzero coefficients do not contribute
+    size_t n_transitions = N - 1;
+    while (n_transitions > 0 && coeff[n_transitions].t_r.isZero(0.0))
+        --n_transitions;
+    if (kz[0] == 0.0)
+        n_transitions = 0;
+
+    Eigen::RowVector2cd w(-result.R, 1.0);
+    for (size_t i = 0; i < n_transitions; ++i) {
+        double sigma = 0.0;
+        if (const auto roughness = GetBottomRoughness(slices, i))
+            sigma = roughness->getSigma();
+        const auto T = transitionMatrix(kz[i], kz[i + 1], sigma, slices[i].thickness());
+        const Eigen::Vector2cd& c = coeff[i + 1].t_r;
+        result.dR_dkz[i] += (w * T.dM_dkzi * c).value();
+        result.dR_dkz[i + 1] += (w * T.dM_dkzi1 * c).value();
+        result.dR_dthickness[i] = (w * T.dM_dthickness * c).value();
+        result.dR_dsigma[i + 1] = (w * T.dM_dsigma * c).value();
+        w = w * T.M;
+    }
+
+    if (std::all_of(slices.begin(), slices.end(), [](const Slice& slice) {
+            return slice.material().typeID() == MATERIAL_TYPES::MaterialBySLD;
+        }))
+        addSLDDerivatives(result, slices, kz);
+    return result;
+}
+
 namespace
 {
 Eigen::Vector2cd transition(complex_t kzi, complex_t kzi1, double sigma, double thickness,
@@ -187,4 +247,74 @@ const LayerRoughness* GetBottomRoughness(const std::vector<Slice>& slices, const
         return slices[slice_index + 1].topRoughness();
     return nullptr;
 }
+
+TransitionMatrix transitionMatrix(complex_t kzi, complex_t kzi1, double sigma, double thickness)
+{
+    // roughness factor rho and its derivatives
+    complex_t rho = 1.0;
+    complex_t drho_dkzi = 0.0, drho_dkzi1 = 0.0, drho_dsigma = 0.0;
+    if (sigma > 0.0) {
+        const double sigeff = pi2_15 * sigma;
+        rho = std::sqrt(MathFunctions::tanhc(sigeff * kzi1) / MathFunctions::tanhc(sigeff * kzi));
+        const complex_t dlog_i = 0.5 * logTanhcDerivative(sigeff * kzi);
+        const complex_t dlog_i1 = 0.5 * logTanhcDerivative(sigeff * kzi1);
+        drho_dkzi = -rho * sigeff * dlog_i;
+        drho_dkzi1 = rho * sigeff * dlog_i1;
+        drho_dsigma = rho * pi2_15 * (kzi1 * dlog_i1 - kzi * dlog_i);
+    }
+    const complex_t phase_shift = exp_I(kzi * thickness);
+    const complex_t kz_ratio = kzi1 / kzi;
+    const complex_t u = 1.0 / rho;
+    const complex_t v = kz_ratio * rho;
+    const complex_t a00 = 0.5 * (u + v);
+    const complex_t a01 = 0.5 * (u - v);
+
+    // derivative of M from the derivatives of u, v and of the logarithm of the phase shift
+    auto derivative = [&](complex_t du, complex_t dv, complex_t dlog_phase) {
+        const complex_t da00 = 0.5 * (du + dv);
+        const complex_t da01 = 0.5 * (du - dv);
+        Eigen::Matrix2cd result;
+        result << (da00 - a00 * dlog_phase) / phase_shift, (da01 - a01 * dlog_phase) / phase_shift,
+            (da01 + a01 * dlog_phase) * phase_shift, (da00 + a00 * dlog_phase) * phase_shift;
+        return result;
+    };
+
+    TransitionMatrix result;
+    result.M << a00 / phase_shift, a01 / phase_shift, a01 * phase_shift, a00 * phase_shift;
+    result.dM_dkzi = derivative(-u * drho_dkzi / rho, kz_ratio * (drho_dkzi - rho / kzi),
+                                complex_t(0.0, thickness));
+    result.dM_dkzi1 = derivative(-u * drho_dkzi1 / rho, rho / kzi + kz_ratio * drho_dkzi1, 0.0);
+    result.dM_dsigma = derivative(-u * drho_dsigma / rho, kz_ratio * drho_dsigma, 0.0);
+    result.dM_dthickness = derivative(0.0, 0.0, mul_I(kzi));
+    return result;
+}
+
+//! Returns d/dz log(tanhc(z)) = 2/sinh(2z) - 1/z
+complex_t logTanhcDerivative(complex_t z)
+{
+    if (std::abs(z) < 1e-3)
+        return z * (-2.0 / 3.0 + z * z * 14.0 / 45.0);
+    return 2.0 / std::sinh(2.0 * z) - 1.0 / z;
+}
+
+//! With SLDs rho_i, kz_i^2 = kz_0^2 + 4pi*conj(rho_0 - rho_i) for all slices below the top one,
+//! while kz_0 is fixed by the incident beam.
+void addSLDDerivatives(SpecularMatrix::ReflectionDerivatives& result,
+                       const std::vector<Slice>& slices, const std::vector<complex_t>& kz)
+{
+    const size_t N = slices.size();
+    // derivative of kz_i^2 by the real part of -rho_i, in the units of the material data
+    const double dkz2_dsld = 4.0 * M_PI / (Units::angstrom * Units::angstrom);
+    result.dR_dsld_real.resize(N, 0.0);
+    result.dR_dsld_imag.resize(N, 0.0);
+    for (size_t i = 1; i < N; ++i) {
+        if (kz[i] == 0.0)
+            continue;
+        const complex_t dR_dkz2 = result.dR_dkz[i] / (2.0 * kz[i]);
+        result.dR_dsld_real[i] = -dkz2_dsld * dR_dkz2;
+        result.dR_dsld_imag[i] = mul_I(dkz2_dsld * dR_dkz2);
+        result.dR_dsld_real[0] -= result.dR_dsld_real[i];
+        result.dR_dsld_imag[0] -= result.dR_dsld_imag[i];
+    }
+}
 } // unnamed namespace
@@ -38,6 +38,25 @@ BA_CORE_API_ std::vector<ScalarRTCoefficients> Execute(const std::vector<Slice>&
 //! Roughness is modelled by tanh profile [see e.g. Phys. Rev. B, vol. 47 (8), p. 4385 (1993)].
 BA_CORE_API_ std::vector<ScalarRTCoefficients> Execute(const std::vector<Slice>& slices,
                                                        const std::vector<complex_t>& kz);
+
+//! Reflection coefficient of the top slice, and its derivatives with respect to the parameters
+//! of all slices. Derivatives of the reflectivity follow as 2*Re(conj(R)*dR).
+struct BA_CORE_API_ ReflectionDerivatives {
+    complex_t R;
+    std::vector<complex_t> dR_dkz;        //!< by z-component of the wave-vector in the slice
+    std::vector<complex_t> dR_dthickness; //!< by thickness of the slice
+    std::vector<complex_t> dR_dsigma;     //!< by rms of the top roughness of the slice
+    std::vector<complex_t> dR_dsld_real;  //!< by real part of the SLD, in 1/angstrom^2
+    std::vector<complex_t> dR_dsld_imag;  //!< by imaginary part of the SLD, in 1/angstrom^2
+};
+
+//! Computes the reflection coefficient and its derivatives for given set of z-components of
+//! wave-vectors in a multilayer, by one adjoint pass through the transfer matrices, at about
+//! twice the cost of Execute. Derivatives by SLD are only computed (and otherwise left empty)
+//! if all materials are defined by SLD, such that kz follows from the SLDs as in
+//! KzComputation::computeKzFromSLDs.
+BA_CORE_API_ ReflectionDerivatives ExecuteDerivatives(const std::vector<Slice>& slices,
+                                                      const std::vector<complex_t>& kz);
 }; // namespace SpecularMatrix
 
 #endif // SPECULARMATRIX_H
@@ -17,6 +17,7 @@
 #include "Exceptions.h"
 #include "ParameterPool.h"
 #include "ParameterSample.h"
+#include "RealParameter.h"
 
 DistributionHandler::DistributionHandler()
 : m_nbr_combinations(1)
@@ -43,6 +44,28 @@ size_t DistributionHandler::getTotalNumberOfSamples() const
 }
 
 double DistributionHandler::setParameterValues(ParameterPool* p_parameter_pool, size_t index)
+{
+    return setParameterValues(boundParameters(*p_parameter_pool), index);
+}
+
+std::vector<RealParameter*>
+DistributionHandler::boundParameters(const ParameterPool& parameter_pool) const
+{
+    std::vector<RealParameter*> result;
+    for (auto& distribution : m_distributions) {
+        auto matches = parameter_pool.getMatchedParameters(distribution.getMainParameterName());
+        if (matches.size() != 1)
+            throw Exceptions::RuntimeErrorException(
+                    "DistributionHandler::boundParameters: "
+                    "parameter name matches nothing or more than "
+                    "one parameter");
+        result.push_back(matches[0]);
+    }
+    return result;
+}
+
+double DistributionHandler::setParameterValues(const std::vector<RealParameter*>& parameters,
+                                               size_t index)
 {
     if (index >= m_nbr_combinations)
         throw Exceptions::RuntimeErrorException(
@@ -54,15 +77,7 @@ double DistributionHandler::setParameterValues(ParameterPool* p_parameter_pool,
     for (size_t param_index=n_distr-1; ; --param_index) {
         size_t remainder = index % m_distributions[param_index].getNbrSamples();
         index /= m_distributions[param_index].getNbrSamples();
-        int changed = p_parameter_pool->setMatchedParametersValue(
-                m_distributions[param_index].getMainParameterName(),
-                m_cached_samples[param_index][remainder].value);
-        if (changed != 1) {
-            throw Exceptions::RuntimeErrorException(
-                    "DistributionWeighter::setParameterValues: "
-                    "parameter name matches nothing or more than "
-                    "one parameter");
-        }
+        parameters[param_index]->setValue(m_cached_samples[param_index][remainder].value);
         weight *= m_cached_samples[param_index][remainder].weight;
         if (param_index==0) break;
     }
@@ -18,6 +18,8 @@
 #include "ParameterDistribution.h"
 #include <vector>
 
+class RealParameter;
+
 //! Provides the functionality to average over parameter distributions with weights.
 
 //! @ingroup algorithms_internal
@@ -46,6 +48,16 @@ public:
     //! associated with this combination of parameter values
     double setParameterValues(ParameterPool *p_parameter_pool, size_t index);
 
+#ifndef SWIG
+    //! Returns the parameters of the pool that the distributions refer to, in the order of the
+    //! distributions, or throws if a name does not match exactly one parameter.
+    //! The result is valid as long as the pool.
+    std::vector<RealParameter*> boundParameters(const ParameterPool& parameter_pool) const;
+
+    //! As above, for the parameters returned by boundParameters
+    double setParameterValues(const std::vector<RealParameter*>& parameters, size_t index);
+#endif
+
     //! Sets mean distribution values to the parameter pool.
     void setParameterToMeans(ParameterPool* p_parameter_pool) const;
 
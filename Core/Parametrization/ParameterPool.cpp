@@ -51,6 +51,7 @@ void ParameterPool::clear()
     for(auto* par: m_params)
         delete par;
     m_params.clear();
+    m_index.clear();
 }
 
 //! Adds parameter to the pool, and returns reference to the input pointer.
@@ -60,10 +61,9 @@ void ParameterPool::clear()
 
 RealParameter& ParameterPool::addParameter(RealParameter* newPar)
 {
-    for (const auto* par: m_params )
-        if( par->getName()==newPar->getName() )
-            throw Exceptions::RuntimeErrorException("ParameterPool::addParameter() -> Error. "
-                "Parameter '"+newPar->getName()+"' is already registered");
+    if (!m_index.emplace(newPar->getName(), newPar).second)
+        throw Exceptions::RuntimeErrorException("ParameterPool::addParameter() -> Error. "
+            "Parameter '"+newPar->getName()+"' is already registered");
     m_params.push_back(newPar);
     return *newPar;
 }
@@ -82,11 +82,8 @@ void ParameterPool::copyToExternalPool(const std::string& prefix, ParameterPool*
 
 const RealParameter* ParameterPool::parameter(const std::string& name) const
 {
-    for (const auto* par: m_params )
-        if( par->getName()==name )
-            return par;
-
-    return nullptr;
+    auto it = m_index.find(name);
+    return it == m_index.end() ? nullptr : it->second;
 }
 
 //! Returns parameter with given _name_.
@@ -102,10 +99,16 @@ RealParameter* ParameterPool::parameter(const std::string& name)
 std::vector<RealParameter*> ParameterPool::getMatchedParameters(const std::string& pattern) const
 {
     std::vector<RealParameter*> result;
-    // loop over all parameters in the pool
-    for (auto* par : m_params)
-        if (StringUtils::matchesPattern(par->getName(), pattern))
-            result.push_back(par);
+    if (pattern.find_first_of("*?") == std::string::npos) {
+        // without wildcards, only the parameter of the same name matches
+        auto it = m_index.find(pattern);
+        if (it != m_index.end())
+            result.push_back(it->second);
+    } else {
+        for (auto* par : m_params)
+            if (StringUtils::matchesPattern(par->getName(), pattern))
+                result.push_back(par);
+    }
     if (result.empty())
         report_find_matched_parameters_error(pattern);
     return result;
@@ -184,6 +187,7 @@ void ParameterPool::removeParameter(const std::string& name)
 {
     if(RealParameter *par = parameter(name)) {
         m_params.erase(std::remove(m_params.begin(), m_params.end(), par), m_params.end());
+        m_index.erase(name);
         delete par;
     }
 }
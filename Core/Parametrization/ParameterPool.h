@@ -18,6 +18,7 @@
 #include "ICloneable.h"
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class RealLimits;
@@ -78,6 +79,8 @@ private:
     size_t check_index(size_t index) const;
 
     std::vector<RealParameter*> m_params;
+    //! Index of the parameters by name, for exact lookups
+    std::unordered_map<std::string, RealParameter*> m_index;
 };
 
 #endif // PARAMETERPOOL_H
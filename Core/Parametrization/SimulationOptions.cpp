@@ -21,6 +21,16 @@ SimulationOptions::SimulationOptions()
     , m_include_specular(false)
     , m_use_avg_materials(false)
     , m_mc_points(1)
+    , m_multi_resolution(false)
+    , m_mr_step(4)
+    , m_mr_threshold(0.01)
+    , m_use_mirror_symmetry(true)
+    , m_specular_kz_grid(false)
+    , m_kz_grid_threshold(1e-3)
+    , m_distribution_interpolation(false)
+    , m_distribution_threshold(1e-2)
+    , m_sample_caching(false)
+    , m_single_precision_data(false)
 {
     m_thread_info.n_threads = getHardwareConcurrency();
 }
@@ -78,6 +88,43 @@ unsigned SimulationOptions::getCurrentBatch() const
     return m_thread_info.current_batch;
 }
 
+void SimulationOptions::setMultiResolution(bool flag, size_t step, double threshold)
+{
+    if (flag && step < 2)
+        throw std::runtime_error("Error in SimulationOptions::setMultiResolution: step of the "
+                                 "coarse grid must be at least 2");
+    if (flag && threshold < 0.0)
+        throw std::runtime_error("Error in SimulationOptions::setMultiResolution: refinement "
+                                 "threshold must not be negative");
+    m_multi_resolution = flag;
+    m_mr_step = step;
+    m_mr_threshold = threshold;
+}
+
+bool SimulationOptions::isMultiResolution() const
+{
+    return m_multi_resolution;
+}
+
+void SimulationOptions::setSpecularKzGrid(bool flag, double threshold)
+{
+    if (flag && threshold <= 0.0)
+        throw std::runtime_error("Error in SimulationOptions::setSpecularKzGrid: refinement "
+                                 "threshold must be positive");
+    m_specular_kz_grid = flag;
+    m_kz_grid_threshold = threshold;
+}
+
+void SimulationOptions::setParticleDistributionInterpolation(bool flag, double threshold)
+{
+    if (flag && threshold <= 0.0)
+        throw std::runtime_error("Error in SimulationOptions::"
+                                 "setParticleDistributionInterpolation: refinement threshold "
+                                 "must be positive");
+    m_distribution_interpolation = flag;
+    m_distribution_threshold = threshold;
+}
+
 unsigned SimulationOptions::getHardwareConcurrency() const
 {
     return std::thread::hardware_concurrency();
@@ -63,11 +63,85 @@ public:
 
     bool useAvgMaterials() const { return m_use_avg_materials; }
 
+    //! @brief Enables/disables coarse-to-fine evaluation of 2D detectors
+    //! @param flag If true, detector channels are first computed on a coarse grid
+    //! @param step Distance (in channels) between exactly computed nodes of the coarse grid,
+    //! at least 2
+    //! @param threshold Relative interpolation error above which a coarse cell is refined
+    void setMultiResolution(bool flag = true, size_t step = 4, double threshold = 0.01);
+
+    bool isMultiResolution() const;
+
+    size_t multiResolutionStep() const { return m_mr_step; }
+
+    double multiResolutionThreshold() const { return m_mr_threshold; }
+
+    //! Enables/disables computing only one of two mirror-symmetric detector channels, if the
+    //! sample and the detector are invariant under y -> -y (enabled by default)
+    void setUseMirrorSymmetry(bool use_symmetry) { m_use_mirror_symmetry = use_symmetry; }
+
+    bool useMirrorSymmetry() const { return m_use_mirror_symmetry; }
+
+    //! @brief Enables/disables interpolation of specular intensities on an adaptive kz grid
+    //! @param flag If true, the reflectivity of samples with SLD-defined materials is computed
+    //! exactly only on a grid of kz values, refined where necessary, and interpolated in between
+    //! @param threshold Relative interpolation error above which a grid interval is refined
+    void setSpecularKzGrid(bool flag = true, double threshold = 1e-3);
+
+    bool useSpecularKzGrid() const { return m_specular_kz_grid; }
+
+    double specularKzGridThreshold() const { return m_kz_grid_threshold; }
+
+    //! @brief Enables/disables interpolation of form factors across particle distributions
+    //! @param flag If true, the scalar form factors of a particle distribution are computed
+    //! exactly only for a subset of its samples, refined where necessary, and interpolated
+    //! by piecewise quadratics in between
+    //! @param threshold Relative interpolation error above which a sample interval is refined
+    void setParticleDistributionInterpolation(bool flag = true, double threshold = 1e-2);
+
+    bool useParticleDistributionInterpolation() const { return m_distribution_interpolation; }
+
+    double particleDistributionThreshold() const { return m_distribution_threshold; }
+
+    //! Enables/disables sharing of processed samples between simulations. If enabled, the
+    //! slices and Fresnel coefficients of a layer stack, and the form factors of each particle,
+    //! are taken from a process-wide cache (see ProcessedSampleCache) if a stack or particle
+    //! with identical content was processed before, e.g. for samples that differ only in the
+    //! interference function. The cache holds a fixed number of stacks and particles regardless
+    //! of their size; the Fresnel coefficients of each stack are kept for a single wavelength
+    //! at a time.
+    void setSampleCaching(bool flag = true) { m_sample_caching = flag; }
+
+    bool useSampleCaching() const { return m_sample_caching; }
+
+    //! Enables/disables single-precision storage of the experimental data, uncertainties and
+    //! user weights that a fit compares with the results of this simulation (see SimDataPair).
+    //! Only these input arrays are stored in single precision: the simulated intensities and
+    //! their normalization, background and convolution stay in double precision. The data are
+    //! converted once to the fit area of the first simulation; the copies of the data passed by
+    //! the user are then released, so that later simulations must keep that fit area. The
+    //! objective metrics and the residuals read the single-precision values directly and
+    //! accumulate in double precision; the array accessors of the data return double-precision
+    //! copies.
+    void setSinglePrecisionData(bool flag = true) { m_single_precision_data = flag; }
+
+    bool useSinglePrecisionData() const { return m_single_precision_data; }
+
 private:
     bool m_mc_integration;
     bool m_include_specular;
     bool m_use_avg_materials;
     size_t m_mc_points;
+    bool m_multi_resolution;
+    size_t m_mr_step;
+    double m_mr_threshold;
+    bool m_use_mirror_symmetry;
+    bool m_specular_kz_grid;
+    double m_kz_grid_threshold;
+    bool m_distribution_interpolation;
+    double m_distribution_threshold;
+    bool m_sample_caching;
+    bool m_single_precision_data;
     ThreadInfo m_thread_info;
 };
 
@@ -42,6 +42,7 @@ public:
     Lattice transformedLattice(const IRotation* p_rotation=nullptr) const;
 
     void setDWFactor(double dw_factor) { m_dw_factor = dw_factor; }
+    double debyeWallerFactor() const { return m_dw_factor; }
 
     std::vector<const INode*> getChildren() const override final;
 
@@ -13,10 +13,16 @@
 // ************************************************************************** //
 
 #include "SlicedFormFactorList.h"
+#include "BornAgainNamespace.h"
 #include "IParticle.h"
+#include "Material.h"
 #include "MultiLayer.h"
+#include "ParameterPool.h"
+#include "RealParameter.h"
 #include "Rotations.h"
 #include "Slice.h"
+#include <sstream>
+#include <typeinfo>
 #include <utility>
 
 namespace
@@ -28,6 +34,7 @@ size_t BottomZToSliceIndex(double z, const std::vector<Slice>& slices);
 double SliceTopZ(size_t i, const std::vector<Slice>& slices);
 ZLimits SlicesZLimits(const std::vector<Slice>& slices, size_t slice_index);
 void ScaleRegions(std::vector<HomogeneousRegion>& regions, double factor);
+void WriteFingerprint(const INode& node, std::ostream& ostr);
 } // namespace
 
 SlicedFormFactorList SlicedFormFactorList::CreateSlicedFormFactors(const IParticle& particle,
@@ -45,6 +52,10 @@ SlicedFormFactorList SlicedFormFactorList::CreateSlicedFormFactors(const IPartic
 void SlicedFormFactorList::addParticle(IParticle& particle, const std::vector<Slice>& slices,
                                        double z_ref)
 {
+    kvector_t lateral_position(particle.position().x(), particle.position().y(), 0.0);
+    particle.translate(-lateral_position);
+    std::ostringstream fingerprint;
+    WriteFingerprint(particle, fingerprint);
     auto slice_indices = SliceIndexSpan(particle, slices, z_ref);
     bool single_layer = (slice_indices.first == slice_indices.second);
     for (size_t i = slice_indices.first; i < slice_indices.second + 1; ++i) {
@@ -55,6 +66,8 @@ void SlicedFormFactorList::addParticle(IParticle& particle, const std::vector<Sl
         ZLimits limits = single_layer ? ZLimits() : SlicesZLimits(slices, i);
         auto sliced_particle = particle.createSlicedParticle(limits);
         m_ff_list.emplace_back(std::move(sliced_particle.mP_slicedff), i);
+        m_lateral_positions.push_back(lateral_position);
+        m_amplitude_keys.push_back(fingerprint.str() + "@" + std::to_string(i));
         double thickness = slices[i].thickness();
         if (thickness > 0.0)
             ScaleRegions(sliced_particle.m_regions, 1 / thickness);
@@ -71,17 +84,33 @@ size_t SlicedFormFactorList::size() const
 
 std::pair<const IFormFactor*, size_t> SlicedFormFactorList::operator[](size_t index) const
 {
-    if (index >= size())
-        throw std::out_of_range("SlicedFormFactorList::operator[] error: "
-                                "index out of range");
+    checkIndex(index);
     return {m_ff_list[index].first.get(), m_ff_list[index].second};
 }
 
+kvector_t SlicedFormFactorList::lateralPosition(size_t index) const
+{
+    return m_lateral_positions[checkIndex(index)];
+}
+
+const std::string& SlicedFormFactorList::amplitudeKey(size_t index) const
+{
+    return m_amplitude_keys[checkIndex(index)];
+}
+
 std::map<size_t, std::vector<HomogeneousRegion>> SlicedFormFactorList::regionMap() const
 {
     return m_region_map;
 }
 
+size_t SlicedFormFactorList::checkIndex(size_t index) const
+{
+    if (index >= size())
+        throw std::out_of_range("SlicedFormFactorList::checkIndex error: "
+                                "index out of range");
+    return index;
+}
+
 namespace
 {
 std::pair<size_t, size_t> SliceIndexSpan(const IParticle& particle,
@@ -161,4 +190,27 @@ void ScaleRegions(std::vector<HomogeneousRegion>& regions, double factor)
     for (auto& region : regions)
         region.m_volume *= factor;
 }
+
+//! Writes the types, parameters and materials of the node tree, except for abundances, which
+//! do not affect the amplitude. Doubles are written exactly.
+void WriteFingerprint(const INode& node, std::ostream& ostr)
+{
+    ostr << typeid(node).name() << '{' << std::hexfloat;
+    for (auto p_par : node.parameterPool()->parameters())
+        if (p_par->getName() != BornAgain::Abundance)
+            ostr << p_par->getName() << '=' << p_par->value() << ';';
+    if (auto p_sample = dynamic_cast<const ISample*>(&node)) {
+        if (auto p_material = p_sample->material()) {
+            complex_t data = p_material->materialData();
+            kvector_t magnetization = p_material->magnetization();
+            ostr << "material=" << static_cast<int>(p_material->typeID()) << ',' << data.real()
+                 << ',' << data.imag() << ',' << magnetization.x() << ',' << magnetization.y()
+                 << ',' << magnetization.z() << ';';
+        }
+    }
+    for (auto p_child : node.getChildren())
+        if (p_child)
+            WriteFingerprint(*p_child, ostr);
+    ostr << '}';
+}
 } // namespace
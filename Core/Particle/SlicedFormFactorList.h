@@ -19,12 +19,15 @@
 #include "IFormFactor.h"
 #include <map>
 #include <memory>
+#include <string>
 
 class MultiLayer;
 class Slice;
 
 //! Class that contains and owns a list of form factors and the index of their containing layer.
 //! This class also handles the slicing of form factors if they cross layer interfaces.
+//! The lateral positions of the particles are kept apart from their form factors, such that
+//! particles which differ only in lateral position share the same amplitude key.
 //!
 //! @ingroup intern
 
@@ -44,11 +47,22 @@ public:
 
     std::pair<const IFormFactor*, size_t> operator[](size_t index) const;
 
+    //! Returns the lateral position of the particle of the form factor with the given index;
+    //! the form factor itself is centered at the origin in the xy plane
+    kvector_t lateralPosition(size_t index) const;
+
+    //! Returns a key that is the same for form factors with identical amplitudes: they stem
+    //! from particles that agree in shape, parameters, rotation, material and z position
+    const std::string& amplitudeKey(size_t index) const;
+
     std::map<size_t, std::vector<HomogeneousRegion>> regionMap() const;
 
 private:
     void addParticle(IParticle& particle, const std::vector<Slice>& slices, double z_ref);
+    size_t checkIndex(size_t index) const;
     std::vector<std::pair<std::unique_ptr<IFormFactor>, size_t>> m_ff_list;
+    std::vector<kvector_t> m_lateral_positions;
+    std::vector<std::string> m_amplitude_keys;
     std::map<size_t, std::vector<HomogeneousRegion>> m_region_map;
 };
 
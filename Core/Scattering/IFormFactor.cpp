@@ -61,6 +61,20 @@ void IFormFactor::setSpecularInfo(std::unique_ptr<const ILayerRTCoefficients>,
                                   std::unique_ptr<const ILayerRTCoefficients>)
 {}
 
+complex_t IFormFactor::evaluateInLayer(const WavevectorInfo& wavevectors,
+                                       const ILayerRTCoefficients&,
+                                       const ILayerRTCoefficients&) const
+{
+    return evaluate(wavevectors);
+}
+
+Eigen::Matrix2cd IFormFactor::evaluatePolInLayer(const WavevectorInfo& wavevectors,
+                                                 const ILayerRTCoefficients&,
+                                                 const ILayerRTCoefficients&) const
+{
+    return evaluatePol(wavevectors);
+}
+
 bool IFormFactor::canSliceAnalytically(const IRotation&) const
 {
     return false;
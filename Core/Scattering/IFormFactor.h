@@ -76,6 +76,19 @@ public:
     //! Sets reflection/transmission info
     virtual void setSpecularInfo(std::unique_ptr<const ILayerRTCoefficients>,
                                  std::unique_ptr<const ILayerRTCoefficients>);
+
+    //! Returns scattering amplitude for the given reflection/transmission coefficients of
+    //! the layer. Unlike setSpecularInfo, this leaves the form factor unchanged, such that
+    //! it can be evaluated concurrently.
+    virtual complex_t evaluateInLayer(const WavevectorInfo& wavevectors,
+                                      const ILayerRTCoefficients& in_coeffs,
+                                      const ILayerRTCoefficients& out_coeffs) const;
+
+    //! Returns scattering amplitude for matrix interactions and the given
+    //! reflection/transmission coefficients of the layer
+    virtual Eigen::Matrix2cd evaluatePolInLayer(const WavevectorInfo& wavevectors,
+                                                const ILayerRTCoefficients& in_coeffs,
+                                                const ILayerRTCoefficients& out_coeffs) const;
 #endif
 
 protected:
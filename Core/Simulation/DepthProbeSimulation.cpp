@@ -187,11 +187,12 @@ DepthProbeSimulation::generateSimulationElements(const Beam& beam)
 }
 
 std::unique_ptr<IComputation>
-DepthProbeSimulation::generateSingleThreadedComputation(size_t start, size_t n_elements)
+DepthProbeSimulation::generateSingleThreadedComputation(
+    size_t start, size_t n_elements, std::shared_ptr<const ProcessedSample> p_sample)
 {
     assert(start < m_sim_elements.size() && start + n_elements <= m_sim_elements.size());
     const auto& begin = m_sim_elements.begin() + static_cast<long>(start);
-    return std::make_unique<DepthProbeComputation>(*sample(), m_options, m_progress, begin,
+    return std::make_unique<DepthProbeComputation>(std::move(p_sample), m_options, m_progress, begin,
                                                    begin + static_cast<long>(n_elements));
 }
 
@@ -73,8 +73,9 @@ private:
     //! Generate a single threaded computation for a given range of simulation elements
     //! @param start Index of the first element to include into computation
     //! @param n_elements Number of elements to process
-    std::unique_ptr<IComputation> generateSingleThreadedComputation(size_t start,
-                                                                    size_t n_elements) override;
+    std::unique_ptr<IComputation>
+    generateSingleThreadedComputation(size_t start, size_t n_elements,
+                                      std::shared_ptr<const ProcessedSample> p_sample) override;
 
     //! Checks if simulation data is ready for retrieval.
     void validityCheck() const;
@@ -18,6 +18,7 @@
 #include "GISASSimulation.h"
 #include "Histogram2D.h"
 #include "IMultiLayerBuilder.h"
+#include "IntensitySink.h"
 #include "MultiLayer.h"
 #include "SimulationElement.h"
 #include "UnitConverterUtils.h"
@@ -62,6 +63,19 @@ SimulationResult GISASSimulation::result() const
     return SimulationResult(*data, *converter);
 }
 
+SimulationResult GISASSimulation::interpolationErrors() const
+{
+    const auto& instrument = getInstrument();
+    const auto converter = UnitConverterUtils::createConverterForGISAS(instrument);
+    const auto detector = instrument.getDetector();
+    std::unique_ptr<OutputData<double>> data(detector->createDetectorMap());
+    if (m_interpolation_errors.size() == m_sim_elements.size())
+        detector->iterate([&](IDetector::const_iterator it) {
+            (*data)[it.roiIndex()] = m_interpolation_errors[it.elementIndex()];
+        });
+    return SimulationResult(*data, *converter);
+}
+
 void GISASSimulation::setBeamParameters(double wavelength, double alpha_i, double phi_i)
 {
     if (wavelength<=0.0)
@@ -90,9 +104,43 @@ GISASSimulation::GISASSimulation(const GISASSimulation& other)
 void GISASSimulation::initSimulationElementVector()
 {
     auto beam = m_instrument.getBeam();
-    m_sim_elements = generateSimulationElements(beam);
-    if (m_cache.empty())
+    m_sim_elements = m_chunk_size > 0
+                         ? generateSimulationElements(beam, m_chunk_start, m_chunk_size)
+                         : generateSimulationElements(beam);
+    if (m_cache.empty()) {
         m_cache.resize(m_sim_elements.size(), 0.0);
+        m_interpolation_errors.assign(m_sim_elements.size(), 0.0);
+    }
+}
+
+size_t GISASSimulation::chunkSize(size_t max_elements) const
+{
+    if (getInstrument().getDetector()->detectorResolution())
+        throw std::runtime_error("Error in GISASSimulation::chunkSize: chunked simulation "
+                                 "does not support detector resolution");
+    return max_elements;
+}
+
+void GISASSimulation::transferChunk(IIntensitySink& sink)
+{
+    const size_t chunk_end = m_chunk_start + m_sim_elements.size();
+    std::vector<double> block;
+    size_t block_start = 0;
+    getInstrument().getDetector()->iterate([&](IDetector::const_iterator it) {
+        const size_t element_index = it.elementIndex();
+        if (element_index < m_chunk_start || element_index >= chunk_end)
+            return;
+        // masked channels interrupt the contiguous runs of the region of interest
+        if (!block.empty() && it.roiIndex() != block_start + block.size()) {
+            sink.writeBlock(block_start, block);
+            block.clear();
+        }
+        if (block.empty())
+            block_start = it.roiIndex();
+        block.push_back(m_sim_elements[element_index - m_chunk_start].getIntensity());
+    });
+    if (!block.empty())
+        sink.writeBlock(block_start, block);
 }
 
 void GISASSimulation::initialize()
@@ -44,6 +44,11 @@ public:
     //! to numpy arrays
     SimulationResult result() const override;
 
+    //! Returns the estimated relative interpolation error of each detector channel, as obtained
+    //! in a multi-resolution run (see SimulationOptions::setMultiResolution). Zero for channels
+    //! that were computed exactly.
+    SimulationResult interpolationErrors() const;
+
     //! Sets beam parameters from here (forwarded to Instrument)
     void setBeamParameters(double wavelength, double alpha_i, double phi_i);
 
@@ -59,6 +64,11 @@ private:
     //! Gets the number of elements this simulation needs to calculate
     size_t numberOfSimulationElements() const override;
 
+    //! Detector resolution mixes neighbouring channels and requires the full detector image
+    size_t chunkSize(size_t max_elements) const override;
+
+    void transferChunk(IIntensitySink& sink) override;
+
     void initialize();
 };
 
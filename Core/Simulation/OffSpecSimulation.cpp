@@ -18,6 +18,7 @@
 #include "DWBAComputation.h"
 #include "Histogram2D.h"
 #include "IMultiLayerBuilder.h"
+#include "IntensitySink.h"
 #include "MultiLayer.h"
 #include "ParameterPool.h"
 #include "RealParameter.h"
@@ -115,7 +116,12 @@ void OffSpecSimulation::initSimulationElementVector()
     const double wavelength = beam.getWavelength();
     const double phi_i = beam.getPhi();
 
-    for (size_t i = 0; i < mP_alpha_i_axis->size(); ++i) {
+    // in a chunked simulation, chunks consist of whole detector images
+    const size_t detector_size = getInstrument().getDetector()->numberOfSimulationElements();
+    const size_t first_image = m_chunk_start / detector_size;
+    const size_t end_image = m_chunk_size > 0 ? first_image + m_chunk_size / detector_size
+                                              : mP_alpha_i_axis->size();
+    for (size_t i = first_image; i < end_image; ++i) {
         // Incoming angle by convention defined as positive:
         double alpha_i = mP_alpha_i_axis->getBin(i).getMidPoint();
         double total_alpha = alpha_i;
@@ -128,6 +134,26 @@ void OffSpecSimulation::initSimulationElementVector()
         m_cache.resize(m_sim_elements.size(), 0.0);
 }
 
+size_t OffSpecSimulation::chunkSize(size_t max_elements) const
+{
+    const size_t detector_size = getInstrument().getDetector()->numberOfSimulationElements();
+    return (max_elements + detector_size - 1) / detector_size * detector_size;
+}
+
+void OffSpecSimulation::transferChunk(IIntensitySink& sink)
+{
+    const size_t detector_size = getInstrument().getDetector()->numberOfSimulationElements();
+    const size_t y_axis_size = m_instrument.getDetectorAxis(1).size();
+    const size_t first_image = m_chunk_start / detector_size;
+    const size_t end_image = first_image + m_sim_elements.size() / detector_size;
+    for (size_t index = first_image; index < end_image; ++index) {
+        transferDetectorImage(index);
+        const size_t offset = index * y_axis_size;
+        sink.writeBlock(offset, std::vector<double>(&m_intensity_map[offset],
+                                                    &m_intensity_map[offset] + y_axis_size));
+    }
+}
+
 void OffSpecSimulation::validateParametrization(const ParameterDistribution& par_distr) const
 {
     const bool zero_mean = par_distr.getDistribution()->getMean() == 0.0;
@@ -174,10 +200,14 @@ void OffSpecSimulation::transferDetectorImage(size_t index)
     for (size_t dim=0; dim<detector_dimension; ++dim)
         detector_image.addAxis(m_instrument.getDetectorAxis(dim));
     size_t detector_size = detector_image.getAllocatedSize();
+    // in a chunked simulation, m_sim_elements starts with the image of the first chunk element
+    size_t first_element = index*detector_size - m_chunk_start;
     for (size_t i=0; i<detector_size; ++i)
-        detector_image[i] = m_sim_elements[index*detector_size + i].getIntensity();
+        detector_image[i] = m_sim_elements[first_element + i].getIntensity();
     m_instrument.applyDetectorResolution(&detector_image);
     size_t y_axis_size = m_instrument.getDetectorAxis(1).size();
+    for (size_t i=0; i<y_axis_size; ++i)
+        m_intensity_map[index*y_axis_size + i] = 0.0;
     for (size_t i=0; i<detector_size; ++i)
         m_intensity_map[index*y_axis_size + i%y_axis_size] += detector_image[i];
 }
@@ -75,6 +75,11 @@ private:
     //! Gets the number of elements this simulation needs to calculate
     size_t numberOfSimulationElements() const final;
 
+    //! Rounds up to whole detector images, which are needed for the detector resolution
+    size_t chunkSize(size_t max_elements) const override;
+
+    void transferChunk(IIntensitySink& sink) override;
+
     //! Normalize, apply detector resolution and transfer detector image corresponding to
     //! alpha_i = mp_alpha_i_axis->getBin(index)
     void transferDetectorImage(size_t index);
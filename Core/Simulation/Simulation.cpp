@@ -21,6 +21,9 @@
 #include "MultiLayerUtils.h"
 #include "ParameterPool.h"
 #include "ParameterSample.h"
+#include "ProcessedSample.h"
+#include "ProcessedSampleCache.h"
+#include "RealParameter.h"
 #include "StringUtils.h"
 #include <gsl/gsl_errno.h>
 #include <iomanip>
@@ -32,21 +35,24 @@ namespace
 size_t getIndexStep(size_t total_size, size_t n_handlers);
 size_t getStartIndex(size_t n_handlers, size_t current_handler, size_t n_elements);
 size_t getNumberOfElements(size_t n_handlers, size_t current_handler, size_t n_elements);
-void runComputations(std::vector<std::unique_ptr<IComputation>> computations);
+void runComputations(std::vector<std::unique_ptr<IComputation>> computations,
+                     Instrumentation::Run* p_run);
 } // namespace
 
-Simulation::Simulation()
+Simulation::Simulation() : m_reuse_sample(false), m_processed_wavelength(0.0)
 {
     initialize();
 }
 
 Simulation::Simulation(const MultiLayer& p_sample)
+    : m_reuse_sample(false), m_processed_wavelength(0.0)
 {
     initialize();
     m_sample_provider.setSample(p_sample);
 }
 
 Simulation::Simulation(const std::shared_ptr<IMultiLayerBuilder> p_sample_builder)
+    : m_reuse_sample(false), m_processed_wavelength(0.0)
 {
     initialize();
     m_sample_provider.setSampleBuilder(p_sample_builder);
@@ -55,7 +61,7 @@ Simulation::Simulation(const std::shared_ptr<IMultiLayerBuilder> p_sample_builde
 Simulation::Simulation(const Simulation& other)
     : ICloneable(), m_sample_provider(other.m_sample_provider), m_options(other.m_options),
       m_distribution_handler(other.m_distribution_handler), m_progress(other.m_progress),
-      m_instrument(other.m_instrument)
+      m_instrument(other.m_instrument), m_reuse_sample(false), m_processed_wavelength(0.0)
 {
     if (other.mP_background)
         setBackground(*other.mP_background);
@@ -76,6 +82,13 @@ void Simulation::setTerminalProgressMonitor()
     });
 }
 
+InstrumentationReport Simulation::instrumentationReport() const
+{
+    if (!mP_instrumentation_run)
+        return InstrumentationReport();
+    return mP_instrumentation_run->report();
+}
+
 void Simulation::setDetectorResolutionFunction(const IResolutionFunction2D& resolution_function)
 {
     m_instrument.setDetectorResolutionFunction(resolution_function);
@@ -122,6 +135,7 @@ void Simulation::prepareSimulation()
 //! Run simulation with possible averaging over parameter distributions
 void Simulation::runSimulation()
 {
+    Instrumentation::RunScope instrumentation_scope(startInstrumentationRun());
     prepareSimulation();
 
     size_t param_combinations = m_distribution_handler.getTotalNumberOfSamples();
@@ -140,10 +154,13 @@ void Simulation::runSimulation()
         return;
 
     std::unique_ptr<ParameterPool> P_param_pool(createParameterTree());
+    const auto distributed_parameters = m_distribution_handler.boundParameters(*P_param_pool);
+    initSampleReuse(*P_param_pool);
     for (size_t index = 0; index < param_combinations; ++index) {
-        double weight = m_distribution_handler.setParameterValues(P_param_pool.get(), index);
+        double weight = m_distribution_handler.setParameterValues(distributed_parameters, index);
         runSingleSimulation(batch_start, batch_size, weight);
     }
+    resetSampleReuse();
     m_distribution_handler.setParameterToMeans(P_param_pool.get());
     moveDataFromCache();
     transferResultsToIntensityMap();
@@ -219,24 +236,92 @@ void Simulation::runSingleSimulation(size_t batch_start, size_t batch_size, doub
     prepareSimulation();
     initSimulationElementVector();
 
+    const double wavelength = m_instrument.getBeam().getWavelength();
+    if (!m_reuse_sample) {
+        mP_processed_sample.reset();
+    } else if (mP_processed_sample && wavelength != m_processed_wavelength
+               && m_options.useSampleCaching()) {
+        // the shared sample is fetched again, so that the cache tracks its wavelength
+        mP_processed_sample.reset();
+    } else if (mP_processed_sample && wavelength != m_processed_wavelength) {
+        mP_processed_sample->clearFresnelCache();
+        m_processed_wavelength = wavelength;
+    }
+
+    computeElements(batch_start, batch_size);
+
+    {
+        BA_INSTRUMENT_SCOPE(Normalization);
+        normalize(batch_start, batch_size);
+    }
+    {
+        BA_INSTRUMENT_SCOPE(Background);
+        addBackGroundIntensity(batch_start, batch_size);
+    }
+    addDataToCache(weight);
+}
+
+void Simulation::computeElements(size_t start, size_t n_elements)
+{
     const size_t n_threads = m_options.getNumberOfThreads();
     assert(n_threads > 0);
 
+    // the sample is processed once and then evaluated concurrently by all threads
+    auto p_sample = processedSample();
     std::vector<std::unique_ptr<IComputation>> computations;
 
     for (size_t i_thread = 0; i_thread < n_threads;
          ++i_thread) { // Distribute computations by threads
-        const size_t thread_start = batch_start + getStartIndex(n_threads, i_thread, batch_size);
-        const size_t thread_size = getNumberOfElements(n_threads, i_thread, batch_size);
+        const size_t thread_start = start + getStartIndex(n_threads, i_thread, n_elements);
+        const size_t thread_size = getNumberOfElements(n_threads, i_thread, n_elements);
         if (thread_size == 0)
             break;
-        computations.push_back(generateSingleThreadedComputation(thread_start, thread_size));
+        computations.push_back(
+            generateSingleThreadedComputation(thread_start, thread_size, p_sample));
     }
-    runComputations(std::move(computations));
+    runComputations(std::move(computations), mP_instrumentation_run.get());
+}
 
-    normalize(batch_start, batch_size);
-    addBackGroundIntensity(batch_start, batch_size);
-    addDataToCache(weight);
+//! The processed sample only depends on the sample and the simulation options, while the
+//! coefficients cached in its Fresnel map are only reused for the same wavelength, to bound
+//! the memory for wavelength distributions.
+void Simulation::initSampleReuse(const ParameterPool& parameter_pool)
+{
+    mP_processed_sample.reset();
+    m_reuse_sample = true;
+    std::unique_ptr<ParameterPool> P_sample_pool(m_sample_provider.createParameterTree());
+    for (const auto& distribution : m_distribution_handler.getDistributions())
+        for (auto p_parameter :
+             parameter_pool.getMatchedParameters(distribution.getMainParameterName()))
+            for (auto p_sample_parameter : P_sample_pool->parameters())
+                if (p_parameter->hasSameData(*p_sample_parameter))
+                    m_reuse_sample = false;
+}
+
+void Simulation::resetSampleReuse()
+{
+    mP_processed_sample.reset();
+    m_reuse_sample = false;
+}
+
+Instrumentation::Run* Simulation::startInstrumentationRun()
+{
+    mP_instrumentation_run.reset(new Instrumentation::Run);
+    return mP_instrumentation_run.get();
+}
+
+std::shared_ptr<const ProcessedSample> Simulation::processedSample()
+{
+    if (!mP_processed_sample) {
+        BA_INSTRUMENT_SCOPE(SampleProcessing);
+        mP_processed_sample
+            = m_options.useSampleCaching()
+                  ? ProcessedSampleCache::instance().processedSample(
+                        *sample(), m_options, m_instrument.getBeam().getWavelength())
+                  : std::make_shared<ProcessedSample>(*sample(), m_options);
+        m_processed_wavelength = m_instrument.getBeam().getWavelength();
+    }
+    return mP_processed_sample;
 }
 
 void Simulation::initialize()
@@ -273,7 +358,9 @@ size_t getNumberOfElements(size_t n_handlers, size_t current_handler, size_t n_e
     return std::min(handler_size, n_elements - start_index);
 }
 
-void runComputations(std::vector<std::unique_ptr<IComputation>> computations)
+//! Threads other than the calling one are attached to the given run.
+void runComputations(std::vector<std::unique_ptr<IComputation>> computations,
+                     Instrumentation::Run* p_run)
 {
     assert(!computations.empty());
 
@@ -296,7 +383,10 @@ void runComputations(std::vector<std::unique_ptr<IComputation>> computations)
 
     // Run simulations in n threads.
     for (auto& comp : computations)
-        threads.emplace_back(new std::thread([&comp]() { comp->run(); }));
+        threads.emplace_back(new std::thread([&comp, p_run]() {
+            Instrumentation::RunScope instrumentation_scope(p_run);
+            comp->run();
+        }));
 
     // Wait for threads to complete.
     for (auto& thread : threads)
@@ -19,6 +19,7 @@
 #include "DistributionHandler.h"
 #include "IDetector2D.h"
 #include "Instrument.h"
+#include "Instrumentation.h"
 #include "ProgressHandler.h"
 #include "SimulationOptions.h"
 #include "SimulationResult.h"
@@ -29,6 +30,7 @@ class IBackground;
 class IComputation;
 class IMultiLayerBuilder;
 class MultiLayer;
+class ProcessedSample;
 
 //! Pure virtual base class of OffSpecularSimulation, GISASSimulation and SpecularSimulation.
 //! Holds the common infrastructure to run a simulation: multithreading, batch processing,
@@ -97,6 +99,11 @@ public:
     void subscribe(ProgressHandler::Callback_t inform) { m_progress.subscribe(inform); }
     void setTerminalProgressMonitor();
 
+    //! Returns the times and counts of the simulation stages of the last run, recorded by the
+    //! threads that worked on it. Stage times are only recorded if BornAgain is built with
+    //! BORNAGAIN_INSTRUMENTATION.
+    InstrumentationReport instrumentationReport() const;
+
     std::vector<const INode*> getChildren() const;
 
     friend class MPISimulation;
@@ -112,9 +119,27 @@ protected:
 
     virtual void updateIntensityMap() {}
 
+    //! Computes the given range of simulation elements, distributing it over the threads
+    //! @param start Index of the first element to compute
+    //! @param n_elements Number of elements to compute
+    virtual void computeElements(size_t start, size_t n_elements);
+
     //! Gets the number of elements this simulation needs to calculate
     virtual size_t numberOfSimulationElements() const = 0;
 
+    void runSingleSimulation(size_t batch_start, size_t batch_size, double weight = 1.0);
+
+    //! Keeps the processed sample between the runSingleSimulation calls for the samples of the
+    //! parameter distributions, unless one of them varies a parameter of the sample
+    void initSampleReuse(const ParameterPool& parameter_pool);
+
+    //! Discards the processed sample kept by initSampleReuse
+    void resetSampleReuse();
+
+    //! Replaces the times and counts of the last run by a new run, to which the calling thread
+    //! attaches with a RunScope
+    Instrumentation::Run* startInstrumentationRun();
+
     SampleProvider m_sample_provider;
     SimulationOptions m_options;
     DistributionHandler m_distribution_handler;
@@ -128,13 +153,16 @@ private:
     //! Update the sample by calling the sample builder, if present
     void updateSample();
 
-    void runSingleSimulation(size_t batch_start, size_t batch_size, double weight = 1.0);
+    //! Returns the processed sample, which is created on first use after a parameter change
+    std::shared_ptr<const ProcessedSample> processedSample();
 
     //! Generate a single threaded computation for a given range of simulation elements
     //! @param start Index of the first element to include into computation
     //! @param n_elements Number of elements to process
+    //! @param p_sample Processed sample, shared by the computations of all threads
     virtual std::unique_ptr<IComputation>
-    generateSingleThreadedComputation(size_t start, size_t n_elements) = 0;
+    generateSingleThreadedComputation(size_t start, size_t n_elements,
+                                      std::shared_ptr<const ProcessedSample> p_sample) = 0;
 
     //! Checks the distribution validity for simulation.
     virtual void validateParametrization(const ParameterDistribution&) const {}
@@ -153,6 +181,11 @@ private:
     // used in MPI calculations for transfer of partial results
     virtual std::vector<double> rawResults() const=0;
     virtual void setRawResults(const std::vector<double>& raw_data) =0;
+
+    std::shared_ptr<ProcessedSample> mP_processed_sample;
+    bool m_reuse_sample;
+    double m_processed_wavelength; //!< wavelength for which the Fresnel coefficients are cached
+    std::unique_ptr<Instrumentation::Run> mP_instrumentation_run; //!< counts of the last run
 };
 
 #endif // SIMULATION_H
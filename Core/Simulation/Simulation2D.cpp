@@ -18,19 +18,37 @@
 #include "DWBAComputation.h"
 #include "Histogram2D.h"
 #include "IBackground.h"
+#include "IntensitySink.h"
+#include "Layer.h"
+#include "MirrorSymmetry.h"
+#include "MultiLayer.h"
+#include "MultiResolutionGrid.h"
+#include "ParameterPool.h"
 #include "SimulationElement.h"
+#include "UnitConverterUtils.h"
+#include <numeric>
 
 namespace
 {
 IDetector2D* Detector2D(Instrument& instrument);
+double CriticalAngle(const MultiLayer& sample, double wavelength);
 }
 
+Simulation2D::Simulation2D()
+    : m_chunk_start(0)
+    , m_chunk_size(0)
+{}
+
 Simulation2D::Simulation2D(const MultiLayer& p_sample)
     : Simulation(p_sample)
+    , m_chunk_start(0)
+    , m_chunk_size(0)
 {}
 
 Simulation2D::Simulation2D(const std::shared_ptr<IMultiLayerBuilder> p_sample_builder)
     : Simulation(p_sample_builder)
+    , m_chunk_start(0)
+    , m_chunk_size(0)
 {}
 
 void Simulation2D::removeMasks()
@@ -48,6 +66,68 @@ void Simulation2D::maskAll()
     Detector2D(m_instrument)->maskAll();
 }
 
+void Simulation2D::runChunkedSimulation(IIntensitySink& sink, size_t max_elements)
+{
+    if (max_elements == 0)
+        throw std::runtime_error("Error in Simulation2D::runChunkedSimulation: "
+                                 "chunk size must be positive");
+    Instrumentation::RunScope instrumentation_scope(startInstrumentationRun());
+    prepareSimulation();
+
+    const size_t param_combinations = m_distribution_handler.getTotalNumberOfSamples();
+    const size_t total_size = numberOfSimulationElements();
+    const size_t chunk_size = chunkSize(max_elements);
+
+    m_progress.reset();
+    m_progress.setExpectedNTicks(param_combinations * total_size);
+    sink.open(intensityMapAxes());
+
+    std::unique_ptr<ParameterPool> P_param_pool(createParameterTree());
+    const auto distributed_parameters = m_distribution_handler.boundParameters(*P_param_pool);
+    initSampleReuse(*P_param_pool);
+    try {
+        for (m_chunk_start = 0; m_chunk_start < total_size; m_chunk_start += chunk_size) {
+            m_chunk_size = std::min(chunk_size, total_size - m_chunk_start);
+            m_cache.clear();
+            for (size_t index = 0; index < param_combinations; ++index) {
+                double weight = m_distribution_handler.setParameterValues(
+                    distributed_parameters, index);
+                runSingleSimulation(0, m_chunk_size, weight);
+            }
+            moveDataFromCache();
+            transferChunk(sink);
+        }
+    } catch (...) {
+        m_chunk_start = m_chunk_size = 0;
+        m_sim_elements.clear();
+        resetSampleReuse();
+        throw;
+    }
+    resetSampleReuse();
+    m_distribution_handler.setParameterToMeans(P_param_pool.get());
+
+    // the full result is only available through the sink
+    m_chunk_start = m_chunk_size = 0;
+    m_sim_elements.clear();
+    sink.close();
+}
+
+//! The axes are those of result() in default units.
+std::vector<std::unique_ptr<IAxis>> Simulation2D::intensityMapAxes() const
+{
+    const auto P_converter = UnitConverterUtils::createConverter(*this);
+    std::vector<std::unique_ptr<IAxis>> result;
+    size_t size = 1;
+    for (size_t i = 0; i < P_converter->dimension(); ++i) {
+        result.push_back(P_converter->createConvertedAxis(i, P_converter->defaultUnits()));
+        size *= result.back()->size();
+    }
+    if (size != intensityMapSize())
+        throw std::runtime_error("Error in Simulation2D::intensityMapAxes: "
+                                 "axes do not match the intensity map");
+    return result;
+}
+
 void Simulation2D::setRegionOfInterest(double xlow, double ylow, double xup, double yup)
 {
     Detector2D(m_instrument)->setRegionOfInterest(xlow, ylow, xup, yup);
@@ -57,6 +137,9 @@ Simulation2D::Simulation2D(const Simulation2D& other)
     : Simulation(other)
     , m_sim_elements(other.m_sim_elements)
     , m_cache(other.m_cache)
+    , m_interpolation_errors(other.m_interpolation_errors)
+    , m_chunk_start(0)
+    , m_chunk_size(0)
 {}
 
 void Simulation2D::setDetectorParameters(size_t n_x, double x_min, double x_max,
@@ -76,16 +159,25 @@ void Simulation2D::setDetector(const IDetector2D& detector)
     initUnitConverter();
 }
 
-std::unique_ptr<IComputation> Simulation2D::generateSingleThreadedComputation(size_t start,
-                                                                              size_t n_elements)
+std::unique_ptr<IComputation>
+Simulation2D::generateSingleThreadedComputation(size_t start, size_t n_elements,
+                                                std::shared_ptr<const ProcessedSample> p_sample)
 {
     assert(start < m_sim_elements.size() && start + n_elements <= m_sim_elements.size());
     const auto& begin = m_sim_elements.begin() + static_cast<long>(start);
-    return std::make_unique<DWBAComputation>(*sample(), m_options, m_progress, begin,
+    return std::make_unique<DWBAComputation>(std::move(p_sample), m_options, m_progress, begin,
                                              begin + static_cast<long>(n_elements));
 }
 
 std::vector<SimulationElement> Simulation2D::generateSimulationElements(const Beam& beam)
+{
+    return generateSimulationElements(beam, 0,
+                                      Detector2D(m_instrument)->numberOfSimulationElements());
+}
+
+std::vector<SimulationElement> Simulation2D::generateSimulationElements(const Beam& beam,
+                                                                        size_t start,
+                                                                        size_t n_elements)
 {
     std::vector<SimulationElement> result;
 
@@ -94,7 +186,7 @@ std::vector<SimulationElement> Simulation2D::generateSimulationElements(const Be
     const double phi_i = beam.getPhi();
     const Eigen::Matrix2cd& beam_polarization = beam.getPolarization();
     auto detector = Detector2D(m_instrument);
-    auto detector_elements = detector->createDetectorElements(beam);
+    auto detector_elements = detector->createDetectorElements(beam, start, n_elements);
 
     result.reserve(detector_elements.size());
     for (auto it=detector_elements.begin(); it!=detector_elements.end(); ++it) {
@@ -133,6 +225,49 @@ void Simulation2D::addBackGroundIntensity(size_t start_ind, size_t n_elements)
     }
 }
 
+void Simulation2D::computeElements(size_t start, size_t n_elements)
+{
+    if (m_interpolation_errors.size() != m_sim_elements.size())
+        m_interpolation_errors.assign(m_sim_elements.size(), 0.0);
+    if (n_elements != m_sim_elements.size()) {
+        Simulation::computeElements(start, n_elements);
+        return;
+    }
+
+    m_mirror_partners.clear();
+    if (m_options.useMirrorSymmetry() && MirrorSymmetry::IsSymmetric(*sample()))
+        m_mirror_partners = MirrorSymmetry::Partners(m_sim_elements);
+
+    std::unique_ptr<MultiResolutionGrid> P_grid;
+    if (m_options.isMultiResolution()) {
+        P_grid.reset(new MultiResolutionGrid(*Detector2D(m_instrument),
+                                             m_options.multiResolutionStep()));
+        if (!P_grid->isValid(m_sim_elements.size()))
+            P_grid.reset();
+    }
+    if (!P_grid) {
+        if (m_mirror_partners.empty()) {
+            Simulation::computeElements(start, n_elements);
+        } else {
+            std::vector<size_t> indices(n_elements);
+            std::iota(indices.begin(), indices.end(), 0);
+            computeElementSubset(indices);
+        }
+        return;
+    }
+
+    computeElementSubset(P_grid->coarseElements());
+    const double alpha_c = CriticalAngle(*sample(), m_instrument.getBeam().getWavelength());
+    computeElementSubset(P_grid->refine(m_sim_elements, m_options.multiResolutionThreshold(),
+                                        alpha_c));
+
+    std::vector<double> errors;
+    P_grid->interpolate(m_sim_elements, errors);
+    for (size_t i = 0; i < errors.size(); ++i)
+        m_interpolation_errors[i] = std::max(m_interpolation_errors[i], errors[i]);
+    m_progress.incrementDone(P_grid->numberOfInterpolatedElements());
+}
+
 void Simulation2D::addDataToCache(double weight)
 {
     if (m_sim_elements.size() != m_cache.size())
@@ -176,6 +311,52 @@ void Simulation2D::setRawResults(const std::vector<double>& raw_data)
     transferResultsToIntensityMap();
 }
 
+void Simulation2D::computeElementSubset(const std::vector<size_t>& indices)
+{
+    if (indices.empty())
+        return;
+
+    // an element is copied from its mirror image if the latter is computed in the same pass
+    std::vector<size_t> computed, mirrored;
+    if (m_mirror_partners.empty()) {
+        computed = indices;
+    } else {
+        std::vector<bool> requested(m_sim_elements.size(), false);
+        for (size_t index : indices)
+            requested[index] = true;
+        for (size_t index : indices) {
+            const size_t partner = m_mirror_partners[index];
+            if (partner < index && requested[partner] && m_mirror_partners[partner] == index)
+                mirrored.push_back(index);
+            else
+                computed.push_back(index);
+        }
+    }
+
+    std::vector<SimulationElement> subset;
+    subset.reserve(computed.size());
+    for (size_t index : computed)
+        subset.push_back(m_sim_elements[index]);
+
+    // computations always operate on m_sim_elements, so the subset is swapped in temporarily
+    std::swap(subset, m_sim_elements);
+    try {
+        Simulation::computeElements(0, m_sim_elements.size());
+    } catch (...) {
+        std::swap(subset, m_sim_elements);
+        throw;
+    }
+    std::swap(subset, m_sim_elements);
+
+    for (size_t i = 0; i < computed.size(); ++i)
+        m_sim_elements[computed[i]].setIntensity(subset[i].getIntensity());
+    for (size_t index : mirrored)
+        m_sim_elements[index].setIntensity(
+            m_sim_elements[m_mirror_partners[index]].getIntensity());
+    if (!mirrored.empty())
+        m_progress.incrementDone(mirrored.size());
+}
+
 namespace
 {
 IDetector2D* Detector2D(Instrument& instrument)
@@ -186,4 +367,19 @@ IDetector2D* Detector2D(Instrument& instrument)
             "Error in Simulation2D: wrong detector type");
     return p_detector;
 }
+
+//! Returns the critical angle of total reflection at the substrate (position of the Yoneda
+//! peak), or zero if there is none.
+double CriticalAngle(const MultiLayer& sample, double wavelength)
+{
+    const size_t n_layers = sample.numberOfLayers();
+    if (n_layers < 2)
+        return 0.0;
+    const double n_top = sample.layer(0)->material()->refractiveIndex(wavelength).real();
+    const double n_bottom =
+        sample.layer(n_layers - 1)->material()->refractiveIndex(wavelength).real();
+    if (n_bottom >= n_top)
+        return 0.0;
+    return std::acos(n_bottom / n_top);
+}
 }
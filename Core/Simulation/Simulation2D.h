@@ -18,6 +18,8 @@
 #include "Simulation.h"
 #include "SimulationResult.h"
 
+class IIntensitySink;
+
 //! Pure virtual base class of OffSpecularSimulation and GISASSimulation.
 //! Holds the common implementations for simulations with a 2D detector
 //! @ingroup simulation
@@ -25,7 +27,7 @@
 class BA_CORE_API_ Simulation2D : public Simulation
 {
 public:
-    Simulation2D() =default;
+    Simulation2D();
     Simulation2D(const MultiLayer& p_sample);
     Simulation2D(const std::shared_ptr<IMultiLayerBuilder> p_sample_builder);
     ~Simulation2D() override = default;
@@ -58,6 +60,11 @@ public:
     //! Put the mask for all detector channels (i.e. exclude whole detector from the analysis)
     void maskAll();
 
+    //! Runs the simulation in chunks of at most max_elements simulation elements and hands
+    //! the intensities of each completed chunk to the sink. Only the simulation elements of
+    //! one chunk are held in memory at a time. Parallelization over batches is not supported.
+    void runChunkedSimulation(IIntensitySink& sink, size_t max_elements);
+
     //! Sets rectangular region of interest with lower left and upper right corners defined.
     void setRegionOfInterest(double xlow, double ylow, double xup, double yup);
 
@@ -69,12 +76,23 @@ protected:
     //! Generate a single threaded computation for a given range of simulation elements
     //! @param start Index of the first element to include into computation
     //! @param n_elements Number of elements to process
-    std::unique_ptr<IComputation> generateSingleThreadedComputation(size_t start,
-                                                                    size_t n_elements) override;
+    std::unique_ptr<IComputation>
+    generateSingleThreadedComputation(size_t start, size_t n_elements,
+                                      std::shared_ptr<const ProcessedSample> p_sample) override;
 
     //! Generate simulation elements for given beam
     std::vector<SimulationElement> generateSimulationElements(const Beam& beam);
 
+    //! Generate the simulation elements with indices in the range [start, start + n_elements)
+    std::vector<SimulationElement> generateSimulationElements(const Beam& beam, size_t start,
+                                                              size_t n_elements);
+
+    //! Returns the number of elements per chunk to be used for the given upper limit
+    virtual size_t chunkSize(size_t max_elements) const { return max_elements; }
+
+    //! Transfers the intensities of the current chunk of simulation elements to the sink
+    virtual void transferChunk(IIntensitySink& sink) = 0;
+
     //! Normalize the detector counts to beam intensity, to solid angle, and to exposure angle.
     //! @param start_ind Index of the first element to operate on
     //! @param n_elements Number of elements to process
@@ -82,14 +100,34 @@ protected:
 
     void addBackGroundIntensity(size_t start_ind, size_t n_elements) override;
 
+    //! Computes the given range of simulation elements; if requested in the simulation options,
+    //! a coarse grid of channels is computed first and refined only where needed.
+    //! Of two mirror-symmetric channels, only one is computed if the sample is symmetric.
+    void computeElements(size_t start, size_t n_elements) override;
+
     void addDataToCache(double weight) override;
 
     void moveDataFromCache() override;
 
     std::vector<SimulationElement> m_sim_elements;
     std::vector<double> m_cache;
+    //! Estimated relative interpolation error of each element (zero for computed elements)
+    std::vector<double> m_interpolation_errors;
+    //! Range of the simulation elements in a chunked simulation (all elements, if size is zero)
+    size_t m_chunk_start;
+    size_t m_chunk_size;
 
 private:
+    //! Returns the axes of the intensity map, as passed to the sink of a chunked simulation
+    std::vector<std::unique_ptr<IAxis>> intensityMapAxes() const;
+
+    //! Computes the simulation elements with the given indices; mirror images of other
+    //! requested elements are copied instead of computed
+    void computeElementSubset(const std::vector<size_t>& indices);
+
+    //! Index of the mirror image of each element, or empty if the symmetry is broken
+    std::vector<size_t> m_mirror_partners;
+
     std::vector<double> rawResults() const override;
     void setRawResults(const std::vector<double>& raw_data) override;
 };
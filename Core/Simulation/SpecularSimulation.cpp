@@ -20,16 +20,22 @@
 #include "IFootprintFactor.h"
 #include "IMultiLayerBuilder.h"
 #include "ISpecularScan.h"
+#include "LayerRoughness.h"
 #include "MathConstants.h"
 #include "MultiLayer.h"
 #include "MaterialUtils.h"
 #include "ParameterPool.h"
+#include "Parameters.h"
 #include "PointwiseAxis.h"
+#include "ProcessedSample.h"
 #include "RealParameter.h"
 #include "SpecularComputation.h"
 #include "SpecularDetector1D.h"
+#include "SpecularMatrix.h"
 #include "SpecularSimulationElement.h"
 #include "UnitConverter1D.h"
+#include <algorithm>
+#include <cmath>
 
 namespace
 {
@@ -37,6 +43,16 @@ namespace
 std::unique_ptr<ISpecularScan> mangledDataHandler(const ISpecularScan& data_handler,
                                                          const Beam& beam);
 
+//! Derivatives of the thickness and top roughness of all slices by one parameter
+struct SliceDerivatives {
+    std::vector<double> d_thickness;
+    std::vector<double> d_sigma;
+};
+
+SliceDerivatives sliceDifferences(const std::vector<Slice>& slices,
+                                  const std::vector<Slice>& shifted_slices,
+                                  const std::string& parameter_name);
+
 const RealLimits alpha_limits = RealLimits::limited(0.0, M_PI_2);
 const double zero_phi_i = 0.0;
 const double zero_alpha_i = 0.0;
@@ -148,11 +164,12 @@ SpecularSimulation::generateSimulationElements(const Beam& beam)
 }
 
 std::unique_ptr<IComputation>
-SpecularSimulation::generateSingleThreadedComputation(size_t start, size_t n_elements)
+SpecularSimulation::generateSingleThreadedComputation(
+    size_t start, size_t n_elements, std::shared_ptr<const ProcessedSample> p_sample)
 {
     assert(start < m_sim_elements.size() && start + n_elements <= m_sim_elements.size());
     const auto& begin = m_sim_elements.begin() + static_cast<long>(start);
-    return std::make_unique<SpecularComputation>(*sample(), m_options, m_progress, begin,
+    return std::make_unique<SpecularComputation>(std::move(p_sample), m_options, m_progress, begin,
                                                  begin + static_cast<long>(n_elements));
 }
 
@@ -257,6 +274,87 @@ std::unique_ptr<OutputData<double>> SpecularSimulation::createIntensityData() co
     return result;
 }
 
+//! The thickness and roughness of the slices depend linearly on layer thicknesses and roughness
+//! sigmas, so that their derivatives follow exactly from the slices of the sample with one
+//! shifted parameter. All steps from the intensities of the simulation elements to the result
+//! are linear, apart from the background, and are applied to the element derivatives.
+std::vector<std::vector<double>>
+SpecularSimulation::intensityDerivatives(const Fit::Parameters& parameters)
+{
+    if (!m_distribution_handler.getDistributions().empty())
+        throw std::runtime_error("Error in SpecularSimulation::intensityDerivatives: parameter "
+                                 "distributions are not supported.");
+    prepareSimulation();
+    const auto slices = currentSlices();
+
+    std::unique_ptr<ParameterPool> P_param_pool(createParameterTree());
+    std::unique_ptr<ParameterPool> P_sample_pool(m_sample_provider.createParameterTree());
+    const auto sample_parameters = P_sample_pool->parameters();
+    std::vector<SliceDerivatives> slice_derivatives;
+    for (const auto& parameter : parameters) {
+        const std::string name = parameter.name();
+        const auto matched = P_param_pool->getMatchedParameters(name);
+        if (matched.empty())
+            throw std::runtime_error("Error in SpecularSimulation::intensityDerivatives: no "
+                                     "parameter matches '" + name + "'.");
+        for (auto p_parameter : matched)
+            if (std::none_of(sample_parameters.begin(), sample_parameters.end(),
+                             [p_parameter](RealParameter* p_sample_parameter) {
+                                 return p_parameter->hasSameData(*p_sample_parameter);
+                             }))
+                throw std::runtime_error("Error in SpecularSimulation::intensityDerivatives: '"
+                                         + p_parameter->getName()
+                                         + "' is not a parameter of the sample.");
+        const double value = matched.front()->value();
+        const double step = 1e-3 * std::max(std::abs(value), 1.0);
+        P_param_pool->setMatchedParametersValue(name, value + step);
+        prepareSimulation();
+        SliceDerivatives derivatives = sliceDifferences(slices, currentSlices(), name);
+        P_param_pool->setMatchedParametersValue(name, value);
+        prepareSimulation();
+        for (size_t i = 0; i < slices.size(); ++i) {
+            derivatives.d_thickness[i] /= step;
+            derivatives.d_sigma[i] /= step;
+        }
+        slice_derivatives.push_back(std::move(derivatives));
+    }
+
+    auto elements = generateSimulationElements(m_instrument.getBeam());
+    std::vector<std::vector<double>> element_derivatives(
+        parameters.size(), std::vector<double>(elements.size(), 0.0));
+    for (size_t i_elem = 0; i_elem < elements.size(); ++i_elem) {
+        if (!elements[i_elem].isCalculated())
+            continue;
+        const auto dR = SpecularMatrix::ExecuteDerivatives(slices,
+                                                           elements[i_elem].produceKz(slices));
+        for (size_t i_par = 0; i_par < parameters.size(); ++i_par) {
+            const auto& derivatives = slice_derivatives[i_par];
+            complex_t dR_dpar = 0.0;
+            for (size_t i = 0; i < slices.size(); ++i)
+                dR_dpar += dR.dR_dthickness[i] * derivatives.d_thickness[i]
+                           + dR.dR_dsigma[i] * derivatives.d_sigma[i];
+            element_derivatives[i_par][i_elem] = 2.0 * std::real(std::conj(dR.R) * dR_dpar);
+        }
+    }
+
+    // normalization and resolution act on the simulation elements of this simulation
+    std::swap(m_sim_elements, elements);
+    std::vector<std::vector<double>> result;
+    for (const auto& derivatives : element_derivatives) {
+        for (size_t i = 0; i < m_sim_elements.size(); ++i)
+            m_sim_elements[i].setIntensity(derivatives[i]);
+        normalize(0, m_sim_elements.size());
+        result.push_back(m_data_handler->createIntensities(m_sim_elements));
+    }
+    std::swap(m_sim_elements, elements);
+    return result;
+}
+
+std::vector<Slice> SpecularSimulation::currentSlices() const
+{
+    return ProcessedSample(*sample(), m_options).averageSlices();
+}
+
 std::vector<double> SpecularSimulation::rawResults() const
 {
     std::vector<double> result;
@@ -300,4 +398,25 @@ std::unique_ptr<ISpecularScan> mangledDataHandler(const ISpecularScan& data_hand
     result->setAngleResolution(*scan.angleResolution());
     return std::unique_ptr<ISpecularScan>(result.release());
 }
+
+SliceDerivatives sliceDifferences(const std::vector<Slice>& slices,
+                                  const std::vector<Slice>& shifted_slices,
+                                  const std::string& parameter_name)
+{
+    const std::string message = "Error in SpecularSimulation::intensityDerivatives: parameter '"
+                                + parameter_name + "' ";
+    if (shifted_slices.size() != slices.size())
+        throw std::runtime_error(message + "changes the number of slices.");
+    SliceDerivatives result;
+    for (size_t i = 0; i < slices.size(); ++i) {
+        if (!(shifted_slices[i].material() == slices[i].material()))
+            throw std::runtime_error(message + "changes the materials of slices.");
+        const auto sigma = [](const Slice& slice) {
+            return slice.topRoughness() ? slice.topRoughness()->getSigma() : 0.0;
+        };
+        result.d_thickness.push_back(shifted_slices[i].thickness() - slices[i].thickness());
+        result.d_sigma.push_back(sigma(shifted_slices[i]) - sigma(slices[i]));
+    }
+    return result;
+}
 }
@@ -26,7 +26,9 @@ class IMultiLayerBuilder;
 class ISample;
 class ISpecularScan;
 class MultiLayer;
+class Slice;
 class SpecularSimulationElement;
+namespace Fit { class Parameters; }
 
 //! Main class to run a specular simulation.
 //! @ingroup simulation
@@ -66,6 +68,13 @@ public:
 #ifndef SWIG
     //! Returns internal data handler
     const ISpecularScan* dataHandler() const { return m_data_handler.get(); }
+
+    //! Returns the derivatives of the simulated intensities by the given fit parameters, one
+    //! vector for each of them. Parameter names are matched against the parameter tree of the
+    //! simulation, and must refer to parameters of the sample which only change the thickness
+    //! or the roughness of slices, like layer thicknesses and roughness sigmas. The derivatives
+    //! of the reflection coefficients are computed analytically.
+    std::vector<std::vector<double>> intensityDerivatives(const Fit::Parameters& parameters);
 #endif //SWIG
 
 private:
@@ -80,8 +89,9 @@ private:
     //! Generate a single threaded computation for a given range of simulation elements
     //! @param start Index of the first element to include into computation
     //! @param n_elements Number of elements to process
-    std::unique_ptr<IComputation> generateSingleThreadedComputation(size_t start,
-                                                                    size_t n_elements) override;
+    std::unique_ptr<IComputation>
+    generateSingleThreadedComputation(size_t start, size_t n_elements,
+                                      std::shared_ptr<const ProcessedSample> p_sample) override;
 
     void checkCache() const;
 
@@ -108,6 +118,9 @@ private:
     //! Creates intensity data from simulation elements
     std::unique_ptr<OutputData<double>> createIntensityData() const;
 
+    //! Returns the slices of the sample, as used by the specular computation
+    std::vector<Slice> currentSlices() const;
+
     std::vector<double> rawResults() const override;
     void setRawResults(const std::vector<double>& raw_data) override;
 
@@ -0,0 +1,128 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/CounterRegistry.h
+//! @brief     Defines and implements template class CounterRegistry.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef COUNTERREGISTRY_H
+#define COUNTERREGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <set>
+
+//! @class CounterRegistry
+//! @ingroup tools_internal
+//! @brief Set of N counters, recorded per thread and combined on request.
+//!
+//! Each counting thread owns a Record, which is registered for its lifetime; the values of
+//! destroyed records are kept. Counters are combined over the records by their sum, or by
+//! their maximum for the indices passed to the constructor. reset() must not be called while
+//! records are counting.
+
+template <size_t N> class CounterRegistry
+{
+public:
+    typedef std::array<uint64_t, N> Values;
+
+    //! Counters of one thread. Only the owning thread writes, so that relaxed loads and
+    //! stores suffice; other threads read when the totals are requested.
+    class Record
+    {
+    public:
+        explicit Record(CounterRegistry& registry) : m_registry(registry)
+        {
+            for (auto& value : m_values)
+                value.store(0);
+            std::lock_guard<std::mutex> lock(m_registry.m_mutex);
+            m_registry.m_running.insert(this);
+        }
+        ~Record()
+        {
+            std::lock_guard<std::mutex> lock(m_registry.m_mutex);
+            m_registry.combine(m_registry.m_finished, *this);
+            m_registry.m_running.erase(this);
+        }
+
+        Record(const Record&) = delete;
+        Record& operator=(const Record&) = delete;
+
+        //! Adds n to the given counter
+        void add(size_t index, uint64_t n)
+        {
+            m_values[index].store(m_values[index].load(std::memory_order_relaxed) + n,
+                                  std::memory_order_relaxed);
+        }
+
+        //! Raises the given counter to n, if it is smaller
+        void raise(size_t index, uint64_t n)
+        {
+            if (n > m_values[index].load(std::memory_order_relaxed))
+                m_values[index].store(n, std::memory_order_relaxed);
+        }
+
+    private:
+        friend class CounterRegistry;
+        CounterRegistry& m_registry;
+        std::array<std::atomic<uint64_t>, N> m_values;
+    };
+
+    explicit CounterRegistry(std::initializer_list<size_t> maximum_indices = {})
+        : m_maximum{}, m_finished{}
+    {
+        for (size_t index : maximum_indices)
+            m_maximum[index] = true;
+    }
+
+    CounterRegistry(const CounterRegistry&) = delete;
+    CounterRegistry& operator=(const CounterRegistry&) = delete;
+
+    //! Returns the counters combined over all records since construction or the last reset
+    Values totals() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Values result = m_finished;
+        for (auto p_record : m_running)
+            combine(result, *p_record);
+        return result;
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished.fill(0);
+        for (auto p_record : m_running)
+            for (auto& value : p_record->m_values)
+                value.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    void combine(Values& values, const Record& record) const
+    {
+        for (size_t i = 0; i < N; ++i) {
+            const uint64_t value = record.m_values[i].load(std::memory_order_relaxed);
+            if (!m_maximum[i])
+                values[i] += value;
+            else if (value > values[i])
+                values[i] = value;
+        }
+    }
+
+    std::array<bool, N> m_maximum;
+    mutable std::mutex m_mutex;
+    std::set<Record*> m_running;
+    Values m_finished;
+};
+
+#endif // COUNTERREGISTRY_H
@@ -0,0 +1,243 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/FastSpecialFunctions.cpp
+//! @brief     Implements namespace FastSpecialFunctions.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "FastSpecialFunctions.h"
+#include "MathConstants.h"
+#include <cmath>
+
+namespace
+{
+// Chebyshev coefficients of J0(x) and J1(x)/x on the intervals [i/2, (i+1)/2], and of
+// P_0, x*Q_0, P_1, x*Q_1 as functions of (8/x)^2, generated by
+// dev-tools/math/specfunc/bessel_tables.cpp
+
+const double j0_small[16][12] = {
+    {9.76828004146703650e-01, -3.08253672832518677e-02, -7.60050962275644515e-03,
+     6.03101765265121601e-05, 7.41231064134433555e-06, -3.92856573076477849e-08,
+     -3.21496655869986055e-09, 1.27916137181231863e-11, 7.84584414140260888e-13,
+     -2.49873946590584315e-15, -1.22558038509461425e-16, 3.25388785349277831e-19},
+    {8.58032112826272838e-01, -8.68045515046966877e-02, -6.20426160826923852e-03,
+     1.68600553592065403e-04, 5.89820613484392750e-06, -1.09425863465407210e-07,
+     -2.52536011431654942e-09, 3.55518450482431852e-11, 6.11493962973238929e-13,
+     -6.93466130450419270e-15, -9.50216984519934342e-17, 9.02101101655146812e-19},
+    {6.42206187614938397e-01, -1.26927397012248873e-01, -3.69670176394131467e-03,
+     2.42545683509622428e-04, 3.19459387121258192e-06, -1.56132752506526449e-07,
+     -1.29823010154486601e-09, 5.04773580792798614e-11, 3.04193249340975040e-13,
+     -9.81371004420842852e-15, -4.62145117733684803e-17, 1.27363402551488717e-18},
+    {3.68445998703710730e-01, -1.44235757888414400e-01, -5.86652569697366715e-04,
+     2.67481103109813515e-04, -1.20891778496561040e-07, -1.69566341072943607e-07,
+     1.96410421218071133e-10, 5.43149218770087121e-11, -6.84022984566252468e-14,
+     -1.04946070802859007e-14, 1.27716004229569846e-17, 1.35598482336366554e-18},
+    {8.52550209445437288e-02, -1.36376311212180690e-01, 2.50182339273672317e-03,
+     2.39180553914097032e-04, -3.34463149429187610e-06, -1.47192735613723383e-07,
+     1.63115560791673347e-09, 4.62942088982275032e-11, -4.23000691898379975e-13,
+     -8.83507165957755811e-15, 6.85634891025644504e-17, 1.13146052545644688e-18},
+    {-1.59173845656665609e-01, -1.05998647234411536e-01, 4.96177836734729413e-03,
+     1.64652281662257007e-04, -5.80108944326560683e-06, -9.42924019007132306e-08,
+     2.69437656838474860e-09, 2.82886808656265031e-11, -6.80813226774476696e-13,
+     -5.22237814845505890e-15, 1.08569717909246434e-16, 6.52555700348974672e-19},
+    {-3.26413335331291345e-01, -6.00983544500876936e-02, 6.33047420356496380e-03,
+     6.04846297855077925e-05, -6.98947552828185857e-06, -2.27267407099007913e-08,
+     3.15944146328621721e-09, 4.37840856676550693e-12, -7.85332001635318821e-13,
+     -4.82814828850081345e-16, 1.23854219549150563e-16, 2.96468300750802752e-20},
+    {-3.95015724495641856e-01, -8.46021404285302793e-03, 6.38363707093838588e-03,
+     -5.08726245768804906e-05, -6.69043450804992931e-06, 5.17492165740861110e-08,
+     2.93437098304772436e-09, -2.00829712530610089e-11, -7.14948567607725927e-13,
+     4.30873256923082366e-15, 1.11159226339651626e-16, -5.94604180742934050e-19},
+    {-3.64017955466755639e-01, 3.84495863238683895e-02, 5.17680335686169199e-03,
+     -1.46048858378249156e-04, -5.00939494670388317e-06, 1.13013546931002806e-07,
+     2.08084373649523907e-09, -3.96821712019464096e-11, -4.87557700017780881e-13,
+     8.07491930451447217e-15, 7.36148858700737991e-17, -1.07817116370103666e-18},
+    {-2.52092886194338569e-01, 7.16785302036077389e-02, 3.02559287231794695e-03,
+     -2.05809462156688477e-04, -2.34762605717521731e-06, 1.48144093638671020e-07,
+     7.98504056805647659e-10, -5.01631087829000430e-11, -1.56143803047490907e-13,
+     9.98100928864164045e-15, 1.99784403234410303e-17, -1.31226623047704041e-18},
+    {-9.26513466316514156e-02, 8.55954113760470453e-02, 4.30335258175809515e-04,
+     -2.19110601908991028e-04, 6.91628749526797218e-07, 1.50223481827642032e-07,
+     -6.21556210971017383e-10, -4.93699495379858464e-11, 2.03577107146267307e-13,
+     9.62262397729227681e-15, -3.74134500121262833e-17, -1.24608671640945647e-18},
+    {7.39345728955696449e-02, 7.89297156857342055e-02, -2.03731718686337186e-03,
+     -1.85272074781237135e-04, 3.44007066475639885e-06, 1.19761152258998226e-07,
+     -1.86329264689649914e-09, -3.77042756928942605e-11, 5.10570376141474335e-13,
+     7.11347100810998868e-15, -8.54990843616899272e-17, -8.98028183335137642e-19},
+    {2.09224679201603695e-01, 5.48384315902047967e-02, -3.86005817328997165e-03,
+     -1.13821837890735148e-04, 5.31304418057519874e-06, 6.44309848415231957e-08,
+     -2.65688945025796550e-09, -1.79972315215154984e-11, 6.96922162301716974e-13,
+     3.05369437437588919e-15, -1.13488974925210019e-16, -3.50855760014839389e-19},
+    {2.84765927384935309e-01, 2.00144290186681920e-02, -4.68492302855535314e-03,
+     -2.20937632047624769e-05, 5.93653191038724602e-06, -2.79165492688023251e-09,
+     -2.83843231341566115e-09, 5.16771752338623436e-12, 7.23074665199921907e-13,
+     -1.61284035581156249e-15, -1.15313542521672706e-16, 2.67936526706785349e-19},
+    {2.87597969828198602e-01, -1.69385777084704365e-02, -4.39372761121649452e-03,
+     6.88380101192647969e-05, 5.22436708799352860e-06, -6.66477519670066941e-08,
+     -2.38468941489155466e-09, 2.65203564457909618e-11, 5.86401487349710400e-13,
+     -5.81845847231242132e-15, -9.09610755426609820e-17, 8.15919049720658593e-19},
+    {2.22111261527510843e-01, -4.74832548674439896e-02, -3.11941689010712987e-03,
+     1.38942520530908053e-04, 3.38928670434800623e-06, -1.13065799916810970e-07,
+     -1.41546309663108702e-09, 4.13093691657712593e-11, 3.21233284732684121e-13,
+     -8.61739940652295538e-15, -4.64071464216767057e-17, 1.16868932535409358e-18},
+};
+
+const double j1c_small[16][12] = {
+    {4.94184939089123507e-01, -7.74161922016514085e-03, -1.91772540374615494e-03,
+     1.00818157016624614e-05, 1.24439368842775883e-06, -4.92194397152320928e-09,
+     -4.04270737071364840e-10, 1.28154483058699700e-12, 7.88543047833253991e-14,
+     -2.08556318155322781e-16, -1.02577409609788919e-17, 2.32738041040000279e-20},
+    {4.63974890119723365e-01, -2.22718455363464244e-02, -1.68219250816590427e-03,
+     2.86946487413713249e-05, 1.05327045742539518e-06, -1.39184098450997674e-08,
+     -3.34738560283504878e-10, 3.60835508981881095e-12, 6.43267026877174657e-14,
+     -5.85403976006787792e-16, -8.27843763964919933e-18, 6.51765386410912549e-20},
+    {4.07250664688745532e-01, -3.40893581761164018e-02, -1.24723949822756549e-03,
+     4.29217971420199509e-05, 7.03860418568087769e-07, -2.05287302314370216e-08,
+     -2.08474630637186690e-10, 5.27191873692488231e-12, 3.80731197574628311e-14,
+     -8.49489085271071481e-16, -4.71450593543363278e-18, 9.40948101340182974e-20},
+    {3.30838676769623223e-01, -4.18482897929552903e-02, -6.78894607902265558e-04,
+     5.06794086050934889e-05, 2.55796138132772135e-07, -2.36524366720752034e-08,
+     -4.86126672869218567e-11, 5.97295236144873793e-12, 5.13839832104927330e-15,
+     -9.50768701023136008e-16, -2.74617328224964011e-19, 1.04341344080739886e-19},
+    {2.43662083659444620e-01, -4.48133397856348747e-02, -6.18459324443009816e-05,
+     5.09811588046720862e-05, -2.15410722036838287e-07, -2.28251289991061320e-08,
+     1.15823060197190225e-10, 5.59653396495376043e-12, -2.81920921772945539e-14,
+     -8.71491595192476246e-16, 4.16310083051896110e-18, 9.40308356456839409e-20},
+    {1.55414465153576809e-01, -4.29530604679538976e-02, 5.14813572759114390e-04,
+     4.40846863868666559e-05, -6.32067889548558221e-07, -1.82945299674786745e-08,
+     2.55453470002987243e-10, 4.23223007550967841e-12, -5.56350068108908341e-14,
+     -6.29462442194400676e-16, 7.72939637671645159e-18, 6.54396783755784932e-20},
+    {7.51638585255053541e-02, -3.69158684218526565e-02, 9.72256772571976809e-04,
+     3.14140119419741248e-05, -9.28171334321653634e-07, -1.09614714003175376e-08,
+     3.46079556514225604e-10, 2.15397350720248636e-12, -7.21391894674694153e-14,
+     -2.74110570625980475e-16, 9.73904328820155585e-18, 2.45051414693635755e-20},
+    {1.01166132418117575e-02, -2.78960513009823043e-02, 1.25439226731804682e-03,
+     1.52764455879563723e-05, -1.06083337091248499e-06, -2.19907457941319479e-09,
+     3.73133338478027814e-10, -2.35864962694205816e-13, -7.48556738512004380e-14,
+     1.23771843673967235e-16, 9.82673574595596824e-18, -2.04256432070519754e-20},
+    {-3.52637571387906033e-02, -1.74164025216238399e-02, 1.33597664643900286e-03,
+     -1.56921073403645250e-06, -1.01716953794871357e-06, 6.41296867571619688e-09,
+     3.34190595037383747e-10, -2.48660308698202588e-12, -6.36552336818268475e-14,
+     4.86460434887337550e-16, 8.01610488652875429e-18, -6.03299447018119238e-20},
+    {-5.96555477316587303e-02, -7.06813616669368852e-03, 1.22506786599229985e-03,
+     -1.64096495692959674e-05, -8.15457347168484230e-07, 1.33861219207640270e-08,
+     2.39089208429325046e-10, -4.18724395607584727e-12, -4.10957516216404154e-14,
+     7.44900781803871096e-16, 4.70841895823644854e-18, -8.73610111461129052e-20},
+    {-6.47568494042218590e-02, 1.74510402608116179e-03, 9.59598280029920048e-04,
+     -2.70456228007330364e-05, -5.00508900517440828e-07, 1.75946332588569853e-08,
+     1.07681120611575704e-10, -5.04468578719125552e-12, -1.18552560900262448e-14,
+     8.52281286711314428e-16, 5.94389958128476844e-19, -9.64302477480793247e-20},
+    {-5.46956285624123126e-02, 8.01497776581851983e-03, 5.98936968525760202e-04,
+     -3.21466413100553849e-05, -1.34315421762974928e-07, 1.84694070560593175e-08,
+     -3.42837281245263381e-11, -4.93677907096654816e-12, 1.82447624664319732e-14,
+     7.92841021370968632e-16, -3.49153575809011109e-18, -8.61944517644489707e-20},
+    {-3.51033535197845951e-02, 1.12544566131127148e-02, 2.12203143619944010e-04,
+     -3.14307732370136702e-05, 2.16096800863819291e-07, 1.60790455759404433e-08,
+     -1.60282285642469053e-10, -3.93025315953527506e-12, 4.34197594719134727e-14,
+     5.84204451744594848e-16, -6.74334094502808732e-18, -5.92518378439590569e-20},
+    {-1.20345439547351093e-02, 1.15250917336549335e-02, -1.34380634002208642e-04,
+     -2.56439468533126134e-05, 4.91182889868772457e-07, 1.10861683575398273e-08,
+     -2.48113261931609094e-10, -2.26085626821274745e-12, 5.90627927383683902e-14,
+     2.72902097375481508e-16, -8.54599571554194582e-18, -2.15196751016802060e-20},
+    {9.07016031725964517e-03, 9.36739699997543307e-03, -3.88734951353488596e-04,
+     -1.63523615113233290e-05, 6.49365039862792414e-07, 4.59205989353621941e-09,
+     -2.83957723459490182e-10, -2.80762860687525283e-13, 6.26154560253910143e-14,
+     -7.58493329184078228e-17, -8.59500565602493088e-18, 1.90612483115528914e-20},
+    {2.42014507484500740e-02, 5.65380866050529871e-03, -5.20790537441773249e-04,
+     -5.59672671091089142e-06, 6.73570592520463403e-07, -2.09568656520083286e-09,
+     -2.64638116471229454e-10, 1.61519954528909870e-12, 5.39998664245150920e-14,
+     -3.91869854798815906e-16, -6.94917353823088564e-18, 5.42111824238430437e-20},
+};
+
+const double pq_large[4][14] = {
+    {9.99460349347518665e-01, -5.36522046813211742e-04, 3.07518478751947462e-06,
+     -5.17059453760609770e-08, 1.63064646351513831e-09, -7.86409137723707000e-11,
+     5.16826238734919246e-12, -4.30457886992539123e-13, 4.32659574315494062e-14,
+     -5.06903409593523615e-15, 6.74807221573386952e-16, -1.00115137234677057e-16,
+     1.63059192337432086e-17, -2.88086616948197366e-18},
+    {-1.24446836842696073e-01, 5.47081595408931968e-04, -5.93159872884851781e-06,
+     1.43779657983751934e-07, -5.81753274949305598e-09, 3.37609752373499076e-10,
+     -2.56539793679730780e-11, 2.40491610028136507e-12, -2.66906254825794176e-13,
+     3.40418003219636912e-14, -4.87994410531202765e-15, 7.72970317624236872e-16,
+     -1.33488521714996338e-16, 2.48659523893640054e-17},
+    {1.00090304086001370e+00, 8.98989833085940856e-04, -3.98728430048890852e-06,
+     6.17763396064429853e-08, -1.87189074910630661e-09, 8.81689865958233890e-11,
+     -5.70486364039564470e-12, 4.69919551523054238e-13, -4.68422378399048928e-14,
+     5.45267489604471724e-15, -7.22118084227401366e-16, 1.06676891143353310e-16,
+     -1.73123132161153421e-17, 3.04929911976567436e-18},
+    {3.74222296556282602e-01, -7.70217883932566346e-04, 7.31089220636436330e-06,
+     -1.67678251072667380e-07, 6.58335466212044330e-09, -3.74909095054155618e-10,
+     2.81217503597488647e-11, -2.61145253946231997e-12, 2.87742126633322352e-13,
+     -3.64900191606183798e-14, 5.20662636622669460e-15, -8.21531802545835365e-16,
+     1.41410843902089016e-16, -2.62676158983583365e-17},
+};
+
+//! Argument from which on the asymptotic form is used
+const double x_large = 8.0;
+
+//! Number of Chebyshev coefficients for arguments below and above x_large
+const size_t n_small = 12;
+const size_t n_large = 14;
+
+//! Returns sum_j c_j T_j(t) for j < n_terms, using Clenshaw's recurrence
+inline double chebyshevSum(const double* c, size_t n_terms, double t)
+{
+    double b1 = 0.0, b2 = 0.0;
+    for (size_t j = n_terms - 1; j > 0; --j) {
+        const double b0 = 2.0 * t * b1 - b2 + c[j];
+        b2 = b1;
+        b1 = b0;
+    }
+    return t * b1 - b2 + c[0];
+}
+
+//! Evaluates an expansion of j0_small or j1c_small at 0 <= x < 8
+inline double smallArgument(const double (&table)[16][n_small], double x)
+{
+    const double scaled = 2.0 * x;
+    const size_t i = static_cast<size_t>(scaled);
+    return chebyshevSum(table[i], n_small, 2.0 * (scaled - i) - 1.0);
+}
+
+//! Returns J_order(x) at x >= 8 from the asymptotic form
+inline double largeArgument(int order, double x)
+{
+    const double t = 128.0 / (x * x) - 1.0;
+    const double p = chebyshevSum(pq_large[2 * order], n_large, t);
+    const double q = chebyshevSum(pq_large[2 * order + 1], n_large, t) / x;
+    const double sin_x = std::sin(x);
+    const double cos_x = std::cos(x);
+    // sqrt(2) times cosine and sine of the phase x - (2*order+1)*pi/4
+    const double cos_phase = order == 0 ? cos_x + sin_x : sin_x - cos_x;
+    const double sin_phase = order == 0 ? sin_x - cos_x : -sin_x - cos_x;
+    return std::sqrt(1.0 / (M_PI * x)) * (p * cos_phase - q * sin_phase);
+}
+} // namespace
+
+double FastSpecialFunctions::Bessel_J0(double x)
+{
+    const double ax = std::abs(x);
+    return ax < x_large ? smallArgument(j0_small, ax) : largeArgument(0, ax);
+}
+
+double FastSpecialFunctions::Bessel_J1(double x)
+{
+    const double ax = std::abs(x);
+    if (ax < x_large)
+        return x * smallArgument(j1c_small, ax);
+    const double result = largeArgument(1, ax);
+    return x < 0.0 ? -result : result;
+}
+
+double FastSpecialFunctions::Bessel_J1c(double x)
+{
+    const double ax = std::abs(x);
+    return ax < x_large ? smallArgument(j1c_small, ax) : largeArgument(1, ax) / ax;
+}
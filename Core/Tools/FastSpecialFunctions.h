@@ -0,0 +1,41 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/FastSpecialFunctions.h
+//! @brief     Defines namespace FastSpecialFunctions.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef FASTSPECIALFUNCTIONS_H
+#define FASTSPECIALFUNCTIONS_H
+
+#include "WinDllMacros.h"
+
+//! Bessel functions of real argument from tabulated Chebyshev expansions of fixed length.
+//!
+//! For |x| < 8, the functions are expanded on intervals of width 1/2; beyond, the amplitude
+//! and phase corrections of the asymptotic form are expanded in (8/x)^2. The evaluation
+//! needs neither iterations nor branches other than the choice of the expansion, and is
+//! accurate to a few units of the machine precision. The tables are generated by
+//! dev-tools/math/specfunc.
+//! @ingroup tools_internal
+
+namespace FastSpecialFunctions
+{
+//! Bessel function of the first kind and order 0
+BA_CORE_API_ double Bessel_J0(double x);
+
+//! Bessel function of the first kind and order 1
+BA_CORE_API_ double Bessel_J1(double x);
+
+//! Bessel function Bessel_J1(x)/x
+BA_CORE_API_ double Bessel_J1c(double x);
+} // namespace FastSpecialFunctions
+
+#endif // FASTSPECIALFUNCTIONS_H
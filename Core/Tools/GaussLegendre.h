@@ -0,0 +1,73 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/GaussLegendre.h
+//! @brief     Defines and implements namespace GaussLegendre.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef GAUSSLEGENDRE_H
+#define GAUSSLEGENDRE_H
+
+#include <cmath>
+#include <cstddef>
+
+//! Composite Gauss-Legendre quadrature of fixed order, for integrands that are analytic
+//! on the integration interval, but may oscillate.
+//!
+//! The interval is divided into panels of equal width, each of which is integrated with the
+//! 16-point rule. The number of panels follows from an estimate of the total phase of the
+//! integrand over the interval (e.g. q*L for exp(i*q*z) on an interval of length L), such
+//! that the phase per panel is at most max_phase_per_panel. For exp(i*phi), the truncation
+//! error of the 16-point rule is then below 1e-25 relative to the panel width.
+//! Unlike the adaptive integrators, the quadrature needs neither a workspace nor a callback,
+//! so it can be used from const methods of objects that are shared between threads.
+//! @ingroup tools_internal
+
+namespace GaussLegendre
+{
+const size_t n_half_nodes = 8;
+
+//! Positive nodes of the 16-point rule on [-1, 1], which is symmetric
+constexpr double nodes[n_half_nodes] = {
+    0.09501250983763745, 0.2816035507792589, 0.45801677765722737, 0.6178762444026438,
+    0.755404408355003,   0.8656312023878318, 0.9445750230732326,  0.9894009349916499};
+
+//! Weights of the 16-point rule, in the order of the nodes
+constexpr double weights[n_half_nodes] = {
+    0.18945061045506859, 0.1826034150449236,  0.16915651939500262, 0.14959598881657676,
+    0.12462897125553403, 0.09515851168249259, 0.062253523938647706, 0.027152459411754037};
+
+//! Maximal phase of the integrand within one panel
+const double max_phase_per_panel = 8.0;
+
+//! Returns the number of panels for an integrand with the given total phase
+inline size_t numberOfPanels(double phase)
+{
+    return 1 + static_cast<size_t>(std::abs(phase) / max_phase_per_panel);
+}
+
+//! Integrates f over [a, b]; phase is an upper estimate of the total phase of f on [a, b]
+template <class F> auto integrate(F f, double a, double b, double phase) -> decltype(f(a))
+{
+    const size_t n_panels = numberOfPanels(phase);
+    const double half_width = (b - a) / (2.0 * n_panels);
+    decltype(f(a)) result = 0.0;
+    for (size_t panel = 0; panel < n_panels; ++panel) {
+        const double center = a + (2 * panel + 1) * half_width;
+        for (size_t i = 0; i < n_half_nodes; ++i) {
+            const double dx = half_width * nodes[i];
+            result += weights[i] * (f(center - dx) + f(center + dx));
+        }
+    }
+    return result * half_width;
+}
+} // namespace GaussLegendre
+
+#endif // GAUSSLEGENDRE_H
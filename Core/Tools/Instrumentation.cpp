@@ -0,0 +1,203 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/Instrumentation.cpp
+//! @brief     Implements namespace Instrumentation and struct InstrumentationReport.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "Instrumentation.h"
+#include "CounterRegistry.h"
+#include "IntegratorWorkspace.h"
+#include <iomanip>
+#include <sstream>
+
+using namespace Instrumentation;
+
+namespace
+{
+const char* const stage_names[NumberOfStages] = {
+    "SampleProcessing",      "FresnelCoefficients", "ParticleLayouts", "FormFactors",
+    "InterferenceFunctions", "MonteCarloIntegration", "Roughness",     "SpecularPeak",
+    "DetectorResolution",    "Normalization",       "Background"};
+
+const char* const counter_names[NumberOfCounters] = {
+    "SimulationElements", "FresnelLookups", "FresnelCacheMisses", "MonteCarloEvaluations"};
+
+//! Layout of the counters: the nanoseconds and the calls of the stages, the counters, and the
+//! integrations with their integrand evaluations, which are only recorded for runs
+const size_t calls_offset = NumberOfStages;
+const size_t counts_offset = 2 * NumberOfStages;
+const size_t integrations_index = 2 * NumberOfStages + NumberOfCounters;
+const size_t evaluations_index = integrations_index + 1;
+typedef CounterRegistry<evaluations_index + 1> CountRegistry;
+
+CountRegistry& registry()
+{
+    static CountRegistry result;
+    return result;
+}
+
+CountRegistry::Record& threadRecord()
+{
+    thread_local CountRegistry::Record result(registry());
+    return result;
+}
+
+//! Record of the run the calling thread is attached to
+thread_local CountRegistry::Record* run_record = nullptr;
+
+void add(size_t index, uint64_t n)
+{
+    threadRecord().add(index, n);
+    if (run_record)
+        run_record->add(index, n);
+}
+
+InstrumentationReport createReport(const CountRegistry::Values& totals)
+{
+    InstrumentationReport result;
+    for (size_t i = 0; i < NumberOfStages; ++i) {
+        result.stage_seconds[i] = 1e-9 * totals[i];
+        result.stage_calls[i] = totals[calls_offset + i];
+    }
+    for (size_t i = 0; i < NumberOfCounters; ++i)
+        result.counts[i] = totals[counts_offset + i];
+    result.integrations = totals[integrations_index];
+    result.integrand_evaluations = totals[evaluations_index];
+    return result;
+}
+} // namespace
+
+bool Instrumentation::isEnabled()
+{
+#ifdef BORNAGAIN_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string Instrumentation::stageName(Stage stage)
+{
+    return stage_names[stage];
+}
+
+std::string Instrumentation::counterName(Counter counter)
+{
+    return counter_names[counter];
+}
+
+void Instrumentation::addTime(Stage stage, std::chrono::nanoseconds duration)
+{
+    add(stage, static_cast<uint64_t>(duration.count()));
+    add(calls_offset + stage, 1);
+}
+
+void Instrumentation::addCount(Counter counter, size_t n)
+{
+    add(counts_offset + counter, n);
+}
+
+void Instrumentation::addIntegration(size_t n_evaluations)
+{
+    if (!run_record)
+        return;
+    run_record->add(integrations_index, 1);
+    run_record->add(evaluations_index, n_evaluations);
+}
+
+class Instrumentation::Run::Registry : public CountRegistry
+{
+};
+
+Instrumentation::Run::Run() : mP_registry(new Registry) {}
+
+Instrumentation::Run::~Run() = default;
+
+InstrumentationReport Instrumentation::Run::report() const
+{
+    return createReport(mP_registry->totals());
+}
+
+class Instrumentation::RunScope::Record : public CountRegistry::Record
+{
+public:
+    explicit Record(CountRegistry& registry) : CountRegistry::Record(registry) {}
+};
+
+//! Only RunScope sets the record of the run, so that the previous one is a RunScope::Record.
+Instrumentation::RunScope::RunScope(Run* p_run)
+    : mP_record(p_run ? new Record(*p_run->mP_registry) : nullptr),
+      mp_previous(static_cast<Record*>(run_record))
+{
+    run_record = mP_record.get();
+}
+
+Instrumentation::RunScope::~RunScope()
+{
+    run_record = mp_previous;
+}
+
+InstrumentationReport::InstrumentationReport()
+    : enabled(Instrumentation::isEnabled()), stage_seconds(NumberOfStages, 0.0),
+      stage_calls(NumberOfStages, 0), counts(NumberOfCounters, 0), integrations(0),
+      integrand_evaluations(0)
+{}
+
+double InstrumentationReport::fresnelCacheHitRate() const
+{
+    if (counts[FresnelLookups] == 0)
+        return 0.0;
+    return 1.0 - static_cast<double>(counts[FresnelCacheMisses]) / counts[FresnelLookups];
+}
+
+std::string InstrumentationReport::toJson() const
+{
+    std::ostringstream result;
+    result << std::setprecision(9);
+    result << "{\"enabled\": " << (enabled ? "true" : "false") << ", \"stages\": {";
+    for (size_t i = 0; i < NumberOfStages; ++i)
+        result << (i ? ", " : "") << "\"" << stage_names[i] << "\": {\"seconds\": "
+               << stage_seconds[i] << ", \"calls\": " << stage_calls[i] << "}";
+    result << "}, \"counters\": {";
+    for (size_t i = 0; i < NumberOfCounters; ++i)
+        result << (i ? ", " : "") << "\"" << counter_names[i] << "\": " << counts[i];
+    result << "}, \"fresnel_cache_hit_rate\": " << fresnelCacheHitRate()
+           << ", \"integrations\": " << integrations
+           << ", \"integrand_evaluations\": " << integrand_evaluations << "}";
+    return result.str();
+}
+
+InstrumentationReport InstrumentationReport::current()
+{
+    InstrumentationReport result = createReport(registry().totals());
+    const auto integration_counts = IntegrationCounters::counts();
+    result.integrations = integration_counts.integrations;
+    result.integrand_evaluations = integration_counts.evaluations;
+    return result;
+}
+
+//! The integrator counts may have been reset in between; they are then counted from the reset.
+InstrumentationReport InstrumentationReport::since(const InstrumentationReport& earlier) const
+{
+    InstrumentationReport result(*this);
+    for (size_t i = 0; i < NumberOfStages; ++i) {
+        result.stage_seconds[i] -= earlier.stage_seconds[i];
+        result.stage_calls[i] -= earlier.stage_calls[i];
+    }
+    for (size_t i = 0; i < NumberOfCounters; ++i)
+        result.counts[i] -= earlier.counts[i];
+    if (integrations >= earlier.integrations
+        && integrand_evaluations >= earlier.integrand_evaluations) {
+        result.integrations -= earlier.integrations;
+        result.integrand_evaluations -= earlier.integrand_evaluations;
+    }
+    return result;
+}
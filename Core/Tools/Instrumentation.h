@@ -0,0 +1,172 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/Instrumentation.h
+//! @brief     Defines namespace Instrumentation and struct InstrumentationReport.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include "WinDllMacros.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct InstrumentationReport;
+
+//! Timers and counters of the stages of a simulation.
+//!
+//! Each thread records into its own counters, which are summed up on request. Threads that
+//! work on a simulation run attach to its Run, which then receives their counts in addition
+//! to the process-wide totals. The timers and counters are only placed in the simulation code
+//! if BornAgain is configured with -DBORNAGAIN_INSTRUMENTATION=ON; otherwise, the macros
+//! BA_INSTRUMENT_SCOPE and BA_INSTRUMENT_COUNT expand to nothing and only the integrator
+//! counts are reported.
+//! @ingroup tools_internal
+
+namespace Instrumentation
+{
+//! Timed stages of a simulation. Stages may be nested, e.g. the form factors and the
+//! interference functions are evaluated within the particle layouts.
+enum Stage {
+    SampleProcessing,
+    FresnelCoefficients,
+    ParticleLayouts,
+    FormFactors,
+    InterferenceFunctions,
+    MonteCarloIntegration,
+    Roughness,
+    SpecularPeak,
+    DetectorResolution,
+    Normalization,
+    Background,
+    NumberOfStages
+};
+
+enum Counter {
+    SimulationElements,
+    FresnelLookups,
+    FresnelCacheMisses,
+    MonteCarloEvaluations,
+    NumberOfCounters
+};
+
+//! Returns true if the timers and counters are compiled into the simulation code
+BA_CORE_API_ bool isEnabled();
+
+BA_CORE_API_ std::string stageName(Stage stage);
+BA_CORE_API_ std::string counterName(Counter counter);
+
+#ifndef SWIG
+//! Adds a call of the given stage that took the given time, for the calling thread
+BA_CORE_API_ void addTime(Stage stage, std::chrono::nanoseconds duration);
+
+//! Increments the given counter of the calling thread
+BA_CORE_API_ void addCount(Counter counter, size_t n = 1);
+
+//! Records a numerical integration for the run the calling thread is attached to, if any
+BA_CORE_API_ void addIntegration(size_t n_evaluations);
+
+//! Times and counts of one simulation run, recorded by the threads attached to it
+class BA_CORE_API_ Run
+{
+public:
+    Run();
+    ~Run();
+
+    Run(const Run&) = delete;
+    Run& operator=(const Run&) = delete;
+
+    InstrumentationReport report() const;
+
+private:
+    friend class RunScope;
+    class Registry;
+    std::unique_ptr<Registry> mP_registry;
+};
+
+//! Attaches the calling thread to the given run during the lifetime of the scope. A nested
+//! scope attaches the thread to its run until it ends; a null run detaches the thread.
+class BA_CORE_API_ RunScope
+{
+public:
+    explicit RunScope(Run* p_run);
+    ~RunScope();
+
+    RunScope(const RunScope&) = delete;
+    RunScope& operator=(const RunScope&) = delete;
+
+private:
+    class Record;
+    std::unique_ptr<Record> mP_record;
+    Record* mp_previous;
+};
+
+//! Times the given stage during the lifetime of the timer
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Stage stage)
+        : m_stage(stage), m_start(std::chrono::steady_clock::now())
+    {}
+    ~ScopedTimer() { addTime(m_stage, std::chrono::steady_clock::now() - m_start); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Stage m_stage;
+    std::chrono::steady_clock::time_point m_start;
+};
+#endif // SWIG
+} // namespace Instrumentation
+
+//! Times and counts of the simulation stages, summed over all threads.
+//! @ingroup simulation
+
+struct BA_CORE_API_ InstrumentationReport {
+    InstrumentationReport();
+
+    double seconds(Instrumentation::Stage stage) const { return stage_seconds[stage]; }
+    size_t calls(Instrumentation::Stage stage) const { return stage_calls[stage]; }
+    size_t count(Instrumentation::Counter counter) const { return counts[counter]; }
+
+    //! Returns the fraction of the Fresnel coefficient lookups that were served from the cache
+    double fresnelCacheHitRate() const;
+
+    //! Returns the report as a JSON object
+    std::string toJson() const;
+
+    //! Returns the counts of all threads since the start of the program
+    static InstrumentationReport current();
+
+    //! Returns the counts accumulated since the given earlier report
+    InstrumentationReport since(const InstrumentationReport& earlier) const;
+
+    bool enabled;
+    std::vector<double> stage_seconds;
+    std::vector<size_t> stage_calls;
+    std::vector<size_t> counts;
+    size_t integrations;          //!< number of one-dimensional numerical integrations
+    size_t integrand_evaluations; //!< integrand evaluations of these integrations
+};
+
+#ifdef BORNAGAIN_INSTRUMENTATION
+#define BA_INSTRUMENT_SCOPE(stage) \
+    Instrumentation::ScopedTimer instrumentation_timer(Instrumentation::stage)
+#define BA_INSTRUMENT_COUNT(counter, n) Instrumentation::addCount(Instrumentation::counter, n)
+#else
+#define BA_INSTRUMENT_SCOPE(stage)
+#define BA_INSTRUMENT_COUNT(counter, n)
+#endif
+
+#endif // INSTRUMENTATION_H
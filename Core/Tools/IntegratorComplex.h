@@ -25,8 +25,7 @@ using complex_integrand = complex_t (T::*)(double) const;
 
 //! Template class to integrate complex class member functions.
 //!
-//! Wraps an two integrators from the GNU Scientific Library.
-//! Since this class holds a persistent workspace, we need at least one instance per thread.
+//! Wraps two integrators from the GNU Scientific Library.
 //! Standard usage for integration inside a class T:
 //! - Create a handle to an integrator:
 //!      'auto integrator = make_integrator_complex(this, mem_function)'
@@ -15,7 +15,7 @@
 #ifndef INTEGRATORREAL_H
 #define INTEGRATORREAL_H
 
-#include <gsl/gsl_integration.h>
+#include "IntegratorWorkspace.h"
 #include <memory>
 
 //! Alias template for member function with signature double f(double)
@@ -25,8 +25,7 @@ using real_integrand = double (T::*)(double) const;
 
 //! Template class to integrate class member functions.
 //!
-//! Wraps an integrator from the GNU Scientific Library.
-//! Since this class holds a persistent workspace, we need at least one instance per thread.
+//! Wraps an integrator from the GNU Scientific Library, via integrate_real.
 //! Standard usage for integration inside a class T:
 //! - Create a handle to an integrator: 'auto integrator = make_integrator_real(this, mem_function)'
 //! - Call: 'integrator.integrate(lmin, lmax)'
@@ -43,20 +42,12 @@ public:
 
     //! to integrate p_member_function, which must belong to p_object
     IntegratorReal(const T *p_object, real_integrand<T> p_member_function);
-    ~IntegratorReal();
 
     //! perform the actual integration over the range [lmin, lmax]
     double integrate(double lmin, double lmax);
 
 private:
-    //! static function that can be passed to gsl integrator
-    static double StaticCallBack(double d, void *v) {
-        CallBackHolder *p_cb = static_cast<CallBackHolder *>(v);
-        auto mf = static_cast<real_integrand<T>>(p_cb->m_member_function);
-        return (p_cb->m_object_pointer->*mf)(d);
-    }
     CallBackHolder m_cb;
-    gsl_integration_workspace *mp_gsl_workspace;
 };
 
 
@@ -75,32 +66,50 @@ P_integrator_real<T> make_integrator_real(const T *object, real_integrand<T> mem
     return P_integrator;
 }
 
+//! Integrates the callable f over the range [lmin, lmax], with the same rule as IntegratorReal.
+//!
+//! Holds no state between calls, so it can be used in const methods of objects that are shared
+//! between threads, with integrands that capture call-specific parameters (e.g. q):
+//! 'integrate_real([&](double x) { return integrand(x, q); }, lmin, lmax)'
+//! The workspace is drawn from the pool of the calling thread, and the integration is recorded
+//! in IntegrationCounters.
+//! @ingroup tools_internal
+
+template <class F> double integrate_real(const F& f, double lmin, double lmax)
+{
+    struct CountingIntegrand {
+        const F& f;
+        size_t n_evaluations;
+    } integrand{f, 0};
+    gsl_function gsl_f;
+    gsl_f.function = [](double x, void* p_integrand) {
+        auto& integrand = *static_cast<CountingIntegrand*>(p_integrand);
+        ++integrand.n_evaluations;
+        return integrand.f(x);
+    };
+    gsl_f.params = &integrand;
+
+    IntegratorWorkspace workspace;
+    double result, error;
+    gsl_integration_qag(&gsl_f, lmin, lmax, 1e-10, 1e-8, 50, 1, workspace.get(), &result,
+                        &error);
+    IntegrationCounters::addIntegration(integrand.n_evaluations);
+    return result;
+}
+
 // ************************************************************************** //
 // Implementation
 // ************************************************************************** //
 
 template<class T> IntegratorReal<T>::IntegratorReal(
     const T *p_object, real_integrand<T> p_member_function)
-    : mp_gsl_workspace { nullptr }
-{
-    m_cb = CallBackHolder{ p_object, p_member_function };
-    mp_gsl_workspace = gsl_integration_workspace_alloc(200);
-}
-
-template<class T> IntegratorReal<T>::~IntegratorReal()
-{
-    gsl_integration_workspace_free(mp_gsl_workspace);
-}
+    : m_cb { p_object, p_member_function }
+{}
 
 template<class T> double IntegratorReal<T>::integrate(double lmin, double lmax)
 {
-    gsl_function f;
-    f.function = StaticCallBack;
-    f.params =&m_cb;
-
-    double result, error;
-    gsl_integration_qag(&f, lmin, lmax, 1e-10, 1e-8, 50, 1,  mp_gsl_workspace, &result, &error);
-
-    return result;
+    return integrate_real(
+        [this](double x) { return (m_cb.m_object_pointer->*m_cb.m_member_function)(x); }, lmin,
+        lmax);
 }
 #endif // INTEGRATORREAL_H
@@ -0,0 +1,87 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/IntegratorWorkspace.cpp
+//! @brief     Implements class IntegratorWorkspace and namespace IntegrationCounters.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "IntegratorWorkspace.h"
+#include "CounterRegistry.h"
+#include "Instrumentation.h"
+#include <memory>
+#include <vector>
+
+namespace
+{
+struct WorkspaceDeleter {
+    void operator()(gsl_integration_workspace* p_workspace) const
+    {
+        gsl_integration_workspace_free(p_workspace);
+    }
+};
+
+//! The workspaces of the calling thread that are not in use
+std::vector<std::unique_ptr<gsl_integration_workspace, WorkspaceDeleter>>& freeWorkspaces()
+{
+    thread_local std::vector<std::unique_ptr<gsl_integration_workspace, WorkspaceDeleter>>
+        result;
+    return result;
+}
+
+enum CountIndex { Integrations, Evaluations, MaxEvaluations, NumberOfCounts };
+
+CounterRegistry<NumberOfCounts>& countRegistry()
+{
+    static CounterRegistry<NumberOfCounts> result{MaxEvaluations};
+    return result;
+}
+
+CounterRegistry<NumberOfCounts>::Record& countRecord()
+{
+    thread_local CounterRegistry<NumberOfCounts>::Record result(countRegistry());
+    return result;
+}
+} // namespace
+
+IntegratorWorkspace::IntegratorWorkspace()
+{
+    auto& pool = freeWorkspaces();
+    if (pool.empty()) {
+        mp_workspace = gsl_integration_workspace_alloc(max_intervals);
+    } else {
+        mp_workspace = pool.back().release();
+        pool.pop_back();
+    }
+}
+
+IntegratorWorkspace::~IntegratorWorkspace()
+{
+    freeWorkspaces().emplace_back(mp_workspace);
+}
+
+IntegrationCounters::Counts IntegrationCounters::counts()
+{
+    const auto totals = countRegistry().totals();
+    return {totals[Integrations], totals[Evaluations], totals[MaxEvaluations]};
+}
+
+void IntegrationCounters::reset()
+{
+    countRegistry().reset();
+}
+
+void IntegrationCounters::addIntegration(size_t n_evaluations)
+{
+    auto& record = countRecord();
+    record.add(Integrations, 1);
+    record.add(Evaluations, n_evaluations);
+    record.raise(MaxEvaluations, n_evaluations);
+    Instrumentation::addIntegration(n_evaluations);
+}
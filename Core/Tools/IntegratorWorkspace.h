@@ -0,0 +1,68 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/IntegratorWorkspace.h
+//! @brief     Defines class IntegratorWorkspace and namespace IntegrationCounters.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef INTEGRATORWORKSPACE_H
+#define INTEGRATORWORKSPACE_H
+
+#include "WinDllMacros.h"
+#include <gsl/gsl_integration.h>
+
+//! Handle to a GSL integration workspace, drawn from a pool owned by the calling thread.
+//!
+//! The workspace returns to the pool when the handle goes out of scope, so that integrations
+//! do not allocate once the pool is warm. Nested integrations draw distinct workspaces.
+//! The pooled workspaces are freed when the thread exits.
+//! @ingroup tools_internal
+
+class BA_CORE_API_ IntegratorWorkspace
+{
+public:
+    //! Maximal number of subintervals of a workspace
+    static const size_t max_intervals = 200;
+
+    IntegratorWorkspace();
+    ~IntegratorWorkspace();
+
+    IntegratorWorkspace(const IntegratorWorkspace&) = delete;
+    IntegratorWorkspace& operator=(const IntegratorWorkspace&) = delete;
+
+    gsl_integration_workspace* get() const { return mp_workspace; }
+
+private:
+    gsl_integration_workspace* mp_workspace;
+};
+
+//! Counters of the one-dimensional numerical integrations, accumulated over all threads.
+//! Each thread counts in its own record, which is summed up on request; reset() must not be
+//! called while integrations are running.
+//! @ingroup tools_internal
+
+namespace IntegrationCounters
+{
+struct Counts {
+    size_t integrations;    //!< number of integrations run
+    size_t evaluations;     //!< total number of integrand evaluations
+    size_t max_evaluations; //!< maximal number of integrand evaluations of one integration
+};
+
+//! Returns the counts since the start of the program or the last reset
+BA_CORE_API_ Counts counts();
+
+BA_CORE_API_ void reset();
+
+//! Records one integration that took the given number of integrand evaluations
+BA_CORE_API_ void addIntegration(size_t n_evaluations);
+} // namespace IntegrationCounters
+
+#endif // INTEGRATORWORKSPACE_H
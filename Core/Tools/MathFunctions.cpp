@@ -13,11 +13,10 @@
 // ************************************************************************** //
 
 #include "MathFunctions.h"
+#include "FastSpecialFunctions.h"
 #include "MathConstants.h"
 #include <gsl/gsl_sf_bessel.h>
-#include <gsl/gsl_sf_erf.h>
 #include <gsl/gsl_sf_expint.h>
-#include <gsl/gsl_sf_trig.h>
 #include <fftw3.h>
 #include <chrono>
 #include <cstring>
@@ -43,7 +42,7 @@ double MathFunctions::IntegratedGaussian(double x, double average, double std_de
 {
     double normalized_x = (x - average) / std_dev;
     static double root2 = std::sqrt(2.0);
-    return (gsl_sf_erf(normalized_x / root2) + 1.0) / 2.0;
+    return (std::erf(normalized_x / root2) + 1.0) / 2.0;
 }
 
 double MathFunctions::cot(double x)
@@ -58,7 +57,10 @@ double MathFunctions::Si(double x)  // int_0^x du Sin(u)/u
 
 double MathFunctions::sinc(double x)  // Sin(x)/x
 {
-    return gsl_sf_sinc(x/M_PI);
+    // as for complex arguments, sin(x)/x is accurate down to the smallest non-zero x
+    if (x == 0.0)
+        return 1.0;
+    return std::sin(x)/x;
 }
 
 complex_t MathFunctions::sinc(const complex_t z)  // Sin(x)/x
@@ -79,15 +81,21 @@ complex_t MathFunctions::tanhc(const complex_t z)  // tanh(x)/x
     return std::tanh(z)/z;
 }
 
+//! The argument is reduced to x = k*pi + d with |d| <= pi/2, where sin(N*x)/sin(x) equals
+//! (-1)^(k*(N-1)) * sin(N*d)/sin(d). This avoids the ratio of two rounding errors at the
+//! principal maxima x = k*pi with k != 0.
 double MathFunctions::Laue(const double x, size_t N)
 {
     static const double SQRT6DOUBLE_EPS = std::sqrt(6.0*std::numeric_limits<double>::epsilon());
     auto nd = static_cast<double>(N);
-    if(std::abs(nd*x) < SQRT6DOUBLE_EPS)
-        return nd;
-    double num = std::sin(nd*x);
-    double den = std::sin(x);
-    return num/den;
+    const double k = std::nearbyint(x / M_PI);
+    const double d = x - k * M_PI;
+    const bool negative = N % 2 == 0 && std::fmod(k, 2.0) != 0.0;
+    if(std::abs(nd*d) < SQRT6DOUBLE_EPS)
+        return negative ? -nd : nd;
+    double num = std::sin(nd*d);
+    double den = std::sin(d);
+    return negative ? -num/den : num/den;
 }
 
 double MathFunctions::erf(double arg)
@@ -96,7 +104,7 @@ double MathFunctions::erf(double arg)
         throw std::runtime_error("Error in MathFunctions::erf: negative argument is not allowed");
     if (std::isinf(arg))
         return 1.0;
-    return gsl_sf_erf(arg);
+    return std::erf(arg);
 }
 
 // ************************************************************************** //
@@ -114,17 +122,17 @@ namespace MathFunctions
 
 double MathFunctions::Bessel_J0(double x)
 {
-    return gsl_sf_bessel_J0(x);
+    return FastSpecialFunctions::Bessel_J0(x);
 }
 
 double MathFunctions::Bessel_J1(double x)
 {
-    return gsl_sf_bessel_J1(x);
+    return FastSpecialFunctions::Bessel_J1(x);
 }
 
 double MathFunctions::Bessel_J1c(double x)
 {
-    return x==0 ? 0.5 : gsl_sf_bessel_J1(x)/x;
+    return FastSpecialFunctions::Bessel_J1c(x);
 }
 
 double MathFunctions::Bessel_I0(double x)
@@ -135,23 +143,21 @@ double MathFunctions::Bessel_I0(double x)
 complex_t MathFunctions::Bessel_J0(const complex_t z)
 {
     if (std::imag(z)==0)
-        return gsl_sf_bessel_J0(std::real(z));
+        return FastSpecialFunctions::Bessel_J0(std::real(z));
     return Bessel_J0_PowSer(z);
 }
 
 complex_t MathFunctions::Bessel_J1(const complex_t z)
 {
     if (std::imag(z)==0)
-        return gsl_sf_bessel_J1(std::real(z));
+        return FastSpecialFunctions::Bessel_J1(std::real(z));
     return Bessel_J1_PowSer(z);
 }
 
 complex_t MathFunctions::Bessel_J1c(const complex_t z)
 {
-    if (std::imag(z)==0) {
-        double xv = std::real(z);
-        return xv==0 ? 0.5 : gsl_sf_bessel_J1(xv)/xv;
-    }
+    if (std::imag(z)==0)
+        return FastSpecialFunctions::Bessel_J1c(std::real(z));
     return z==0. ? 0.5 : MathFunctions::Bessel_J1_PowSer(z)/z;
 }
 
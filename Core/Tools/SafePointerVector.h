@@ -62,8 +62,10 @@ template <class T> SafePointerVector<T>::SafePointerVector(const SafePointerVect
 }
 
 template <class T>
-SafePointerVector<T>::SafePointerVector(SafePointerVector<T>&& other) : m_pointers{other.m_pointers}
+SafePointerVector<T>::SafePointerVector(SafePointerVector<T>&& other)
+    : m_pointers{std::move(other.m_pointers)}
 {
+    other.m_pointers.clear();
 }
 
 template <class T>
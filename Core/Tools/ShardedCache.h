@@ -0,0 +1,99 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Core/Tools/ShardedCache.h
+//! @brief     Defines and implements template class ShardedCache.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef SHARDEDCACHE_H
+#define SHARDEDCACHE_H
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+//! @class ShardedCache
+//! @ingroup tools_internal
+//! @brief Thread safe hash map, split into independently locked shards.
+//!
+//! Concurrent lookups of different keys mostly hit different shards, so that threads
+//! sharing the cache rarely wait for each other. Values are only accessed under the lock
+//! of their shard, through the functor passed to find() and insert().
+
+template <class Key, class Value, class Hash> class ShardedCache
+{
+public:
+    ShardedCache() {}
+
+    //! Calls f(value) and returns true if the key is cached, returns false otherwise.
+    template <class F> bool find(const Key& key, F f) const
+    {
+        const Shard& shard = shardOf(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end())
+            return false;
+        f(it->second);
+        return true;
+    }
+
+    //! Caches the value unless the key is already present, then calls f on the cached value.
+    template <class F> void insert(const Key& key, Value value, F f)
+    {
+        Shard& shard = shardOf(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        f(shard.map.emplace(key, std::move(value)).first->second);
+    }
+
+    void clear()
+    {
+        for (auto& shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+    size_t size() const
+    {
+        size_t result = 0;
+        for (auto& shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            result += shard.map.size();
+        }
+        return result;
+    }
+
+private:
+    static constexpr size_t n_shard_bits = 6;
+
+    //! The padding keeps the mutexes of neighbouring shards on different cache lines.
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Key, Value, Hash> map;
+        char padding[64];
+    };
+
+    const Shard& shardOf(const Key& key) const { return m_shards[shardIndex(key)]; }
+    Shard& shardOf(const Key& key) { return m_shards[shardIndex(key)]; }
+
+    //! Takes the high bits of the mixed hash, since the maps of the shards use the low ones.
+    size_t shardIndex(const Key& key) const
+    {
+        const uint64_t mixed = static_cast<uint64_t>(m_hash(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(mixed >> (64 - n_shard_bits));
+    }
+
+    Hash m_hash;
+    std::array<Shard, size_t(1) << n_shard_bits> m_shards;
+};
+
+#endif // SHARDEDCACHE_H
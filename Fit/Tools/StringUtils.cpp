@@ -14,35 +14,33 @@
 
 #include "StringUtils.h"
 #include <boost/algorithm/string.hpp>
-#include <regex>
 
 //! Returns true if text matches pattern with wildcards '*' and '?'.
+//! Scans both strings once, backtracking only to the position after the last '*'.
 bool StringUtils::matchesPattern(const std::string& text, const std::string& wildcardPattern)
 {
-    // escape all regex special characters, except '?' and '*'
-    std::string mywildcardPattern = wildcardPattern;
-    boost::replace_all(mywildcardPattern, "\\", "\\\\");
-    boost::replace_all(mywildcardPattern, "^", "\\^");
-    boost::replace_all(mywildcardPattern, ".", "\\.");
-    boost::replace_all(mywildcardPattern, "$", "\\$");
-    boost::replace_all(mywildcardPattern, "|", "\\|");
-    boost::replace_all(mywildcardPattern, "(", "\\(");
-    boost::replace_all(mywildcardPattern, ")", "\\)");
-    boost::replace_all(mywildcardPattern, "[", "\\[");
-    boost::replace_all(mywildcardPattern, "]", "\\]");
-    boost::replace_all(mywildcardPattern, "+", "\\+");
-    boost::replace_all(mywildcardPattern, "/", "\\/");
-
-    // Convert chars '*?' to their regex equivalents
-    boost::replace_all(mywildcardPattern, "?", ".");
-    boost::replace_all(mywildcardPattern, "*", ".*");
-
-    // constructing regexp pattern
-    mywildcardPattern = "^" + mywildcardPattern + "$";
-    std::regex pattern(mywildcardPattern);
-
-    // applaying match
-    return std::regex_match(text, pattern);
+    const std::string& pattern = wildcardPattern;
+    size_t i_text = 0, i_pattern = 0;
+    size_t star = std::string::npos, star_text = 0;
+    while (i_text < text.size()) {
+        if (i_pattern < pattern.size()
+            && (pattern[i_pattern] == '?' || pattern[i_pattern] == text[i_text])) {
+            ++i_text;
+            ++i_pattern;
+        } else if (i_pattern < pattern.size() && pattern[i_pattern] == '*') {
+            star = i_pattern++;
+            star_text = i_text;
+        } else if (star != std::string::npos) {
+            // let the last '*' absorb one more character
+            i_pattern = star + 1;
+            i_text = ++star_text;
+        } else {
+            return false;
+        }
+    }
+    while (i_pattern < pattern.size() && pattern[i_pattern] == '*')
+        ++i_pattern;
+    return i_pattern == pattern.size();
 }
 
 //! Returns string right-padded with blanks.
@@ -19,7 +19,9 @@
 #include "CoreIOPerformanceTest.h"
 #include "CoreIOPathTest.h"
 #include "FourierTransformationTest.h"
+#include "MagneticFresnelTest.h"
 #include "MesoCrystalPerformanceTest.h"
+#include "ThreadScalingTest.h"
 
 CoreSpecialTestFactory::CoreSpecialTestFactory()
 {
@@ -50,4 +52,12 @@ CoreSpecialTestFactory::CoreSpecialTestFactory()
     registerItem("MesoPerformance",
                  create_new<MesoCrystalPerformanceTest>,
                  "Heavy mesocrystal simulation");
+
+    registerItem("ThreadScaling",
+                 create_new<ThreadScalingTest>,
+                 "Performance of multi-threaded simulations on a shared sample");
+
+    registerItem("MagneticFresnel",
+                 create_new<MagneticFresnelTest>,
+                 "Performance of batched polarized Fresnel coefficients");
 }
@@ -0,0 +1,131 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Tests/Functional/Core/CoreSpecial/MagneticFresnelTest.cpp
+//! @brief     Implements MagneticFresnelTest class.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "MagneticFresnelTest.h"
+#include "Benchmark.h"
+#include "Layer.h"
+#include "MaterialFactoryFuncs.h"
+#include "MultiLayer.h"
+#include "ProcessedSample.h"
+#include "SimulationOptions.h"
+#include "SpecularMagnetic.h"
+#include "Units.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+const size_t detector_size = 400;
+const size_t n_bilayers = 10;
+const size_t batch_size = 256;
+const int n_runs = 3;
+
+std::unique_ptr<ProcessedSample> createSample()
+{
+    const Material air = HomogeneousMaterial("Air", 0.0, 0.0);
+    const Material iron = HomogeneousMaterial("Fe", 8e-6, 5e-7, kvector_t(0.0, 1.7e6, 0.0));
+    const Material silver = HomogeneousMaterial("Ag", 3e-6, 2e-7);
+    const Material substrate = HomogeneousMaterial("Substrate", 6e-6, 2e-8);
+
+    MultiLayer multi_layer;
+    multi_layer.addLayer(Layer(air));
+    for (size_t i = 0; i < n_bilayers; ++i) {
+        multi_layer.addLayer(Layer(iron, 3.0 * Units::nanometer));
+        multi_layer.addLayer(Layer(silver, 2.0 * Units::nanometer));
+    }
+    multi_layer.addLayer(Layer(substrate));
+    SimulationOptions options;
+    return std::make_unique<ProcessedSample>(multi_layer, options);
+}
+
+//! Time-reversed outgoing wavevectors of a detector, as used for GISAS
+std::vector<kvector_t> createWavevectors()
+{
+    std::vector<kvector_t> result;
+    for (size_t i = 0; i < detector_size; ++i) {
+        const double phi = (4.0 * i / detector_size - 2.0) * Units::degree;
+        for (size_t j = 0; j < detector_size; ++j) {
+            const double alpha = (2.0 * j / detector_size) * Units::degree;
+            result.push_back(-vecOfLambdaAlphaPhi(1.0 * Units::angstrom, alpha, phi));
+        }
+    }
+    return result;
+}
+
+double maxDifference(const MatrixRTCoefficients& coeff1, const MatrixRTCoefficients& coeff2)
+{
+    const Eigen::Vector2cd differences[] = {
+        coeff1.T1plus() - coeff2.T1plus(), coeff1.R1plus() - coeff2.R1plus(),
+        coeff1.T2plus() - coeff2.T2plus(), coeff1.R2plus() - coeff2.R2plus(),
+        coeff1.T1min() - coeff2.T1min(),   coeff1.R1min() - coeff2.R1min(),
+        coeff1.T2min() - coeff2.T2min(),   coeff1.R2min() - coeff2.R2min()};
+    double result = 0.0;
+    for (const auto& difference : differences)
+        result = std::max(result, difference.norm());
+    return result;
+}
+}
+
+MagneticFresnelTest::MagneticFresnelTest() = default;
+
+MagneticFresnelTest::~MagneticFresnelTest() = default;
+
+bool MagneticFresnelTest::runTest()
+{
+    const auto sample = createSample();
+    const auto& slices = sample->slices();
+    const auto kvecs = createWavevectors();
+    std::cout << "Running MagneticFresnelTest for " << kvecs.size() << " wavevectors and "
+              << slices.size() << " slices..." << std::endl;
+
+    std::vector<MatrixRTCoefficients> single;
+    std::vector<MatrixRTCoefficients> batched;
+    double max_difference = 0.0;
+    Benchmark bench;
+    bench.test_method("single",
+                      [&]() {
+                          for (const auto& kvec : kvecs)
+                              SpecularMagnetic::Execute(slices, kvec, single);
+                      },
+                      n_runs);
+    bench.test_method("batched",
+                      [&]() {
+                          for (size_t start = 0; start < kvecs.size(); start += batch_size) {
+                              const size_t end = std::min(start + batch_size, kvecs.size());
+                              const std::vector<kvector_t> batch(kvecs.begin() + start,
+                                                                 kvecs.begin() + end);
+                              SpecularMagnetic::Execute(slices, batch, batched);
+                          }
+                      },
+                      n_runs);
+
+    // compare the first batch with the coefficients of single wavevectors
+    const std::vector<kvector_t> batch(kvecs.begin(), kvecs.begin() + batch_size);
+    SpecularMagnetic::Execute(slices, batch, batched);
+    for (size_t j = 0; j < batch.size(); ++j) {
+        SpecularMagnetic::Execute(slices, batch[j], single);
+        for (size_t i = 0; i < slices.size(); ++i)
+            max_difference =
+                std::max(max_difference, maxDifference(single[i], batched[j * slices.size() + i]));
+    }
+
+    const double single_time = bench.runTime("single") / n_runs;
+    const double batched_time = bench.runTime("batched") / n_runs;
+    std::cout << std::setw(10) << "single" << std::setw(15) << single_time << " s" << std::endl;
+    std::cout << std::setw(10) << "batched" << std::setw(15) << batched_time << " s"
+              << std::setw(12) << single_time / batched_time << std::endl;
+    std::cout << "maximal difference of the coefficients: " << max_difference << std::endl;
+    return max_difference < 1e-10;
+}
@@ -0,0 +1,34 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Tests/Functional/Core/CoreSpecial/MagneticFresnelTest.h
+//! @brief     Defines MagneticFresnelTest class.
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef MAGNETICFRESNELTEST_H
+#define MAGNETICFRESNELTEST_H
+
+#include "IFunctionalTest.h"
+
+//! Functional test for measuring the computation of polarized Fresnel coefficients for
+//! the wavevectors of a detector, one wavevector at a time and in batches.
+//! Fails if both ways of computation give different coefficients.
+
+class MagneticFresnelTest : public IFunctionalTest
+{
+public:
+    MagneticFresnelTest();
+    ~MagneticFresnelTest();
+
+private:
+    bool runTest() override;
+};
+
+#endif // MAGNETICFRESNELTEST_H
@@ -0,0 +1,77 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Tests/Functional/Core/CoreSpecial/ThreadScalingTest.cpp
+//! @brief     Implements class ThreadScalingTest
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#include "ThreadScalingTest.h"
+#include "Benchmark.h"
+#include "GISASSimulation.h"
+#include "SampleBuilderFactory.h"
+#include "Units.h"
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+const size_t detector_size = 400;
+const int n_runs = 3;
+
+std::unique_ptr<GISASSimulation> createSimulation(const std::string& builder_name, int n_threads)
+{
+    std::unique_ptr<GISASSimulation> result(new GISASSimulation());
+    result->setDetectorParameters(detector_size, -2.0 * Units::degree, 2.0 * Units::degree,
+                                  detector_size, 0.0 * Units::degree, 2.0 * Units::degree);
+    result->setBeamParameters(1.0 * Units::angstrom, 0.2 * Units::degree, 0.0 * Units::degree);
+    result->getOptions().setNumberOfThreads(n_threads);
+
+    SampleBuilderFactory sample_factory;
+    std::shared_ptr<IMultiLayerBuilder> builder(sample_factory.create(builder_name).release());
+    result->setSampleBuilder(builder);
+    return result;
+}
+}
+
+ThreadScalingTest::ThreadScalingTest() = default;
+
+ThreadScalingTest::~ThreadScalingTest() = default;
+
+bool ThreadScalingTest::runTest()
+{
+    std::cout << "Running ThreadScalingTest on " << std::thread::hardware_concurrency()
+              << " hardware threads..." << std::endl;
+    runSample("CylindersInDWBABuilder");
+    runSample("MagneticCylindersBuilder");
+    return true;
+}
+
+void ThreadScalingTest::runSample(const std::string& builder_name) const
+{
+    std::cout << builder_name << ", " << detector_size << "x" << detector_size << " detector"
+              << std::endl;
+    std::cout << std::setw(10) << "threads" << std::setw(15) << "time [s]" << std::setw(12)
+              << "speedup" << std::endl;
+    double single_thread_time = 0.0;
+    for (int n_threads : {1, 2, 4, 8, 16}) {
+        Benchmark bench;
+        bench.test_method("run",
+                          [&builder_name, n_threads]() {
+                              createSimulation(builder_name, n_threads)->runSimulation();
+                          },
+                          n_runs);
+        const double time = bench.runTime("run") / n_runs;
+        if (n_threads == 1)
+            single_thread_time = time;
+        std::cout << std::setw(10) << n_threads << std::setw(15) << time << std::setw(12)
+                  << single_thread_time / time << std::endl;
+    }
+}
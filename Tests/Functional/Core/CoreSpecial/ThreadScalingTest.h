@@ -0,0 +1,38 @@
+// ************************************************************************** //
+//
+//  BornAgain: simulate and fit scattering at grazing incidence
+//
+//! @file      Tests/Functional/Core/CoreSpecial/ThreadScalingTest.h
+//! @brief     Defines class ThreadScalingTest
+//!
+//! @homepage  http://www.bornagainproject.org
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @copyright Forschungszentrum Jülich GmbH 2018
+//! @authors   Scientific Computing Group at MLZ (see CITATION, AUTHORS)
+//
+// ************************************************************************** //
+
+#ifndef THREADSCALINGTEST_H
+#define THREADSCALINGTEST_H
+
+#include "IFunctionalTest.h"
+#include <string>
+
+//! Functional test for measuring how the run time of simulations scales with the number
+//! of threads, which share one processed sample and its Fresnel coefficient cache.
+//! No comparison with reference data provided since it is not the concern of the test.
+
+class ThreadScalingTest : public IFunctionalTest
+{
+public:
+    ThreadScalingTest();
+    ~ThreadScalingTest();
+
+private:
+    bool runTest() override;
+
+    //! Prints run times and speedups of the sample from the given builder
+    void runSample(const std::string& builder_name) const;
+};
+
+#endif // THREADSCALINGTEST_H
@@ -0,0 +1,59 @@
+# Functional test: tests of the instrumentation report of a simulation
+
+import json, sys, unittest
+
+sys.path.append("@CMAKE_LIBRARY_OUTPUT_DIRECTORY@")
+import libBornAgainCore as ba
+
+
+def get_simulation():
+    particle_layout = ba.ParticleLayout()
+    particle_layout.addParticle(ba.Particle(ba.HomogeneousMaterial("Particle", 6e-4, 2e-8),
+                                            ba.FormFactorCylinder(5.0, 5.0)))
+    air_layer = ba.Layer(ba.HomogeneousMaterial("Air", 0.0, 0.0))
+    air_layer.addLayout(particle_layout)
+    multi_layer = ba.MultiLayer()
+    multi_layer.addLayer(air_layer)
+    multi_layer.addLayer(ba.Layer(ba.HomogeneousMaterial("Substrate", 6e-6, 2e-8)))
+
+    # no detector channels are mirror images of each other, so that all are computed
+    simulation = ba.GISASSimulation()
+    simulation.setDetectorParameters(10, 0.1*ba.deg, 2.0*ba.deg, 10, 0.0, 2.0*ba.deg)
+    simulation.setBeamParameters(1.0*ba.angstrom, 0.2*ba.deg, 0.0)
+    simulation.setSample(multi_layer)
+    return simulation
+
+
+class InstrumentationTest(unittest.TestCase):
+    """
+    Test the report of the simulation stages
+    """
+
+    def test_report(self):
+        simulation = get_simulation()
+        simulation.getOptions().setNumberOfThreads(2)
+        simulation.runSimulation()
+
+        report = simulation.instrumentationReport()
+        self.assertEqual(ba.isEnabled(), report.enabled)
+        n_elements = 100 if report.enabled else 0
+        self.assertEqual(n_elements, report.count(ba.SimulationElements))
+        self.assertEqual(ba.NumberOfStages, len(report.stage_seconds))
+        self.assertEqual("FormFactors", ba.stageName(ba.FormFactors))
+
+        data = json.loads(report.toJson())
+        self.assertEqual(report.enabled, data["enabled"])
+        self.assertEqual(n_elements, data["counters"]["SimulationElements"])
+
+    def test_report_of_last_run(self):
+        simulation = get_simulation()
+        self.assertEqual(0, simulation.instrumentationReport().count(ba.SimulationElements))
+        simulation.runSimulation()
+        simulation.runSimulation()
+        if ba.isEnabled():
+            self.assertEqual(100, simulation.instrumentationReport().count(ba.SimulationElements))
+            self.assertEqual(1, simulation.instrumentationReport().calls(ba.SampleProcessing))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -71,6 +71,41 @@ class IntensityDataTest(unittest.TestCase):
         self.assertEqual((20, 10), data.getArray().shape)
         self.assertEqual((data.totalSum()), numpy.sum(data.getArray()))
 
+    def test_array_view(self):
+        data = ba.IntensityData()
+        data.addAxis("axis0", 10, 0.0, 10.0)
+        data.addAxis("axis1", 20, 0.0, 20.0)
+        for i in range(0, data.getAllocatedSize()):
+            data[i] = i
+        view = data.getArrayView()
+        numpy.testing.assert_array_equal(data.getArray(), view)
+        # the view shares the values with the data
+        view[0, 1] = -1.0
+        self.assertEqual(-1.0, data.getArray()[0, 1])
+        # and keeps them alive
+        del data
+        self.assertEqual(-1.0, view[0, 1])
+
+    def test_import_numpy_array(self):
+        # 1D arrays and array views are shared
+        input = numpy.array([0, 1, 2, 3], dtype=float)
+        data = ba.importNumpyArray(input)
+        input[2] = 5.0
+        self.assertEqual(5.0, data[2])
+
+        view = ba.importArrayToOutputData(numpy.arange(6.0).reshape(2, 3)).getArrayView()
+        data = ba.importNumpyArray(view)
+        numpy.testing.assert_array_equal(view, data.getArray())
+        view[1, 2] = 7.0
+        self.assertEqual(7.0, data.getArray()[1, 2])
+
+        # other arrays are copied
+        input = numpy.arange(6.0).reshape(2, 3)
+        data = ba.importNumpyArray(input)
+        numpy.testing.assert_array_equal(input, data.getArray())
+        input[0, 0] = 9.0
+        self.assertEqual(0.0, data.getArray()[0, 0])
+
 
 if __name__ == '__main__':
     unittest.main()
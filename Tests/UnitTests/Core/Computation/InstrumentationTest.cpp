@@ -0,0 +1,117 @@
+#include "google_test.h"
+#include "Instrumentation.h"
+#include "IntegratorWorkspace.h"
+#include "SimulationTestHelper.h"
+#include <thread>
+
+class InstrumentationTest : public ::testing::Test
+{
+protected:
+    ~InstrumentationTest();
+};
+
+InstrumentationTest::~InstrumentationTest() = default;
+
+TEST_F(InstrumentationTest, Recording)
+{
+    const auto start = InstrumentationReport::current();
+    Instrumentation::addTime(Instrumentation::FormFactors, std::chrono::milliseconds(2));
+    Instrumentation::addCount(Instrumentation::FresnelLookups, 4);
+    std::thread([] {
+        Instrumentation::addTime(Instrumentation::FormFactors, std::chrono::milliseconds(1));
+        Instrumentation::addCount(Instrumentation::FresnelLookups, 4);
+        Instrumentation::addCount(Instrumentation::FresnelCacheMisses, 2);
+    }).join();
+
+    // the counts of the finished thread are kept
+    const auto report = InstrumentationReport::current().since(start);
+    EXPECT_EQ(report.calls(Instrumentation::FormFactors), 2u);
+    EXPECT_NEAR(report.seconds(Instrumentation::FormFactors), 3e-3, 1e-9);
+    EXPECT_EQ(report.count(Instrumentation::FresnelLookups), 8u);
+    EXPECT_DOUBLE_EQ(report.fresnelCacheHitRate(), 0.75);
+    EXPECT_EQ(report.calls(Instrumentation::Roughness), 0u);
+
+    const std::string json = report.toJson();
+    EXPECT_NE(json.find("\"FormFactors\": {\"seconds\": 0.003, \"calls\": 2}"), std::string::npos);
+    EXPECT_NE(json.find("\"FresnelLookups\": 8"), std::string::npos);
+    EXPECT_NE(json.find("\"fresnel_cache_hit_rate\": 0.75"), std::string::npos);
+    EXPECT_EQ(Instrumentation::stageName(Instrumentation::Background), "Background");
+}
+
+TEST_F(InstrumentationTest, Simulation)
+{
+    auto P_simulation =
+        SimulationTestHelper::createSimulation(*SimulationTestHelper::createCylinders());
+    P_simulation->getOptions().setNumberOfThreads(2);
+    P_simulation->getOptions().setUseMirrorSymmetry(false);
+    P_simulation->runSimulation();
+
+    const auto report = P_simulation->instrumentationReport();
+    EXPECT_EQ(report.enabled, Instrumentation::isEnabled());
+    if (!Instrumentation::isEnabled()) {
+        EXPECT_EQ(report.count(Instrumentation::SimulationElements), 0u);
+        return;
+    }
+    EXPECT_EQ(report.count(Instrumentation::SimulationElements), 100u);
+    EXPECT_EQ(report.calls(Instrumentation::ParticleLayouts), 100u);
+    EXPECT_EQ(report.calls(Instrumentation::FormFactors), 100u);
+    EXPECT_EQ(report.calls(Instrumentation::SampleProcessing), 1u);
+    EXPECT_EQ(report.calls(Instrumentation::Normalization), 1u);
+    EXPECT_GT(report.count(Instrumentation::FresnelLookups), 0u);
+    EXPECT_GT(report.fresnelCacheHitRate(), 0.0);
+    EXPECT_GE(report.seconds(Instrumentation::ParticleLayouts),
+              report.seconds(Instrumentation::FormFactors));
+}
+
+TEST_F(InstrumentationTest, Runs)
+{
+    Instrumentation::Run run, other_run;
+    {
+        Instrumentation::RunScope scope(&run);
+        Instrumentation::addCount(Instrumentation::FresnelLookups, 3);
+        std::thread([&other_run] {
+            Instrumentation::RunScope thread_scope(&other_run);
+            Instrumentation::addCount(Instrumentation::FresnelLookups, 5);
+            IntegrationCounters::addIntegration(7);
+        }).join();
+        {
+            Instrumentation::RunScope nested_scope(&other_run);
+            Instrumentation::addTime(Instrumentation::Roughness, std::chrono::milliseconds(1));
+        }
+        Instrumentation::addCount(Instrumentation::FresnelLookups, 1);
+    }
+    Instrumentation::addCount(Instrumentation::FresnelLookups, 2);
+
+    const auto report = run.report();
+    EXPECT_EQ(report.count(Instrumentation::FresnelLookups), 4u);
+    EXPECT_EQ(report.calls(Instrumentation::Roughness), 0u);
+    EXPECT_EQ(report.integrations, 0u);
+    const auto other_report = other_run.report();
+    EXPECT_EQ(other_report.count(Instrumentation::FresnelLookups), 5u);
+    EXPECT_EQ(other_report.calls(Instrumentation::Roughness), 1u);
+    EXPECT_EQ(other_report.integrations, 1u);
+    EXPECT_EQ(other_report.integrand_evaluations, 7u);
+}
+
+TEST_F(InstrumentationTest, ConcurrentSimulations)
+{
+    std::vector<std::unique_ptr<Simulation>> simulations;
+    for (size_t i = 0; i < 2; ++i) {
+        simulations.push_back(
+            SimulationTestHelper::createSimulation(*SimulationTestHelper::createCylinders()));
+        simulations.back()->getOptions().setNumberOfThreads(2);
+        simulations.back()->getOptions().setUseMirrorSymmetry(false);
+    }
+    std::vector<std::thread> threads;
+    for (auto& P_simulation : simulations)
+        threads.emplace_back([&P_simulation] { P_simulation->runSimulation(); });
+    for (auto& thread : threads)
+        thread.join();
+
+    const size_t n_elements = Instrumentation::isEnabled() ? 100u : 0u;
+    for (auto& P_simulation : simulations) {
+        const auto report = P_simulation->instrumentationReport();
+        EXPECT_EQ(report.count(Instrumentation::SimulationElements), n_elements);
+        EXPECT_EQ(report.calls(Instrumentation::SampleProcessing), n_elements / 100);
+    }
+}
@@ -0,0 +1,137 @@
+#include "google_test.h"
+#include "Beam.h"
+#include "DetectorElement.h"
+#include "FormFactorBox.h"
+#include "FormFactorCylinder.h"
+#include "FormFactorRipple2.h"
+#include "FTDecayFunctions.h"
+#include "InterferenceFunction2DLattice.h"
+#include "MirrorSymmetry.h"
+#include "Particle.h"
+#include "Rotations.h"
+#include "SimulationElement.h"
+#include "SimulationTestHelper.h"
+#include "SphericalDetector.h"
+
+class MirrorSymmetryTest : public ::testing::Test
+{
+protected:
+    ~MirrorSymmetryTest();
+
+    //! Returns a substrate decorated with a single particle type and interference function
+    std::unique_ptr<MultiLayer> createSample(
+        const Particle& particle, const IInterferenceFunction* p_interference = nullptr) const
+    {
+        ParticleLayout layout;
+        layout.addParticle(particle);
+        if (p_interference)
+            layout.setInterferenceFunction(*p_interference);
+        return SimulationTestHelper::createSample(layout);
+    }
+
+    std::vector<SimulationElement> createElements(SphericalDetector& detector, double phi_i,
+                                                  double alpha_i = 0.2 * Units::deg) const
+    {
+        Beam beam;
+        beam.setCentralK(1.0, alpha_i, phi_i);
+        std::vector<SimulationElement> result;
+        for (auto& element : detector.createDetectorElements(beam))
+            result.emplace_back(1.0, -alpha_i, phi_i, element.pixel());
+        return result;
+    }
+
+    Material m_material = SimulationTestHelper::particleMaterial();
+};
+
+MirrorSymmetryTest::~MirrorSymmetryTest() = default;
+
+TEST_F(MirrorSymmetryTest, ParticleSymmetry)
+{
+    Particle cylinder(m_material, FormFactorCylinder(5.0, 5.0));
+    EXPECT_TRUE(MirrorSymmetry::IsSymmetric(*createSample(cylinder)));
+
+    Particle box(m_material, FormFactorBox(10.0, 5.0, 5.0));
+    box.setRotation(RotationZ(180.0 * Units::deg));
+    EXPECT_TRUE(MirrorSymmetry::IsSymmetric(*createSample(box)));
+    box.setRotation(RotationZ(30.0 * Units::deg));
+    EXPECT_FALSE(MirrorSymmetry::IsSymmetric(*createSample(box)));
+
+    Particle shifted(m_material, FormFactorCylinder(5.0, 5.0));
+    shifted.setPosition(0.0, 1.0, 0.0);
+    EXPECT_FALSE(MirrorSymmetry::IsSymmetric(*createSample(shifted)));
+
+    Particle ripple(m_material, FormFactorRipple2(100.0, 20.0, 4.0, 0.3));
+    EXPECT_FALSE(MirrorSymmetry::IsSymmetric(*createSample(ripple)));
+
+    Particle magnetic(HomogeneousMaterial("Magnetic", 6e-4, 2e-8, kvector_t(0.0, 1e6, 0.0)),
+                      FormFactorCylinder(5.0, 5.0));
+    EXPECT_FALSE(MirrorSymmetry::IsSymmetric(*createSample(magnetic)));
+}
+
+TEST_F(MirrorSymmetryTest, LatticeSymmetry)
+{
+    Particle cylinder(m_material, FormFactorCylinder(5.0, 5.0));
+
+    std::unique_ptr<InterferenceFunction2DLattice> P_square(
+        InterferenceFunction2DLattice::createSquare(20.0));
+    P_square->setDecayFunction(FTDecayFunction2DCauchy(100.0, 50.0, 0.0));
+    EXPECT_TRUE(MirrorSymmetry::IsSymmetric(*createSample(cylinder, P_square.get())));
+    P_square->setDecayFunction(FTDecayFunction2DCauchy(100.0, 50.0, 10.0 * Units::deg));
+    EXPECT_FALSE(MirrorSymmetry::IsSymmetric(*createSample(cylinder, P_square.get())));
+
+    std::unique_ptr<InterferenceFunction2DLattice> P_rotated(
+        InterferenceFunction2DLattice::createSquare(20.0, 10.0 * Units::deg));
+    P_rotated->setDecayFunction(FTDecayFunction2DCauchy(100.0, 100.0, 0.0));
+    EXPECT_FALSE(MirrorSymmetry::IsSymmetric(*createSample(cylinder, P_rotated.get())));
+    P_rotated->setIntegrationOverXi(true);
+    EXPECT_TRUE(MirrorSymmetry::IsSymmetric(*createSample(cylinder, P_rotated.get())));
+}
+
+TEST_F(MirrorSymmetryTest, Partners)
+{
+    SphericalDetector detector(6, -1.0, 1.0, 3, 0.0, 1.0);
+    auto partners = MirrorSymmetry::Partners(createElements(detector, 0.0));
+    ASSERT_EQ(partners.size(), 18u);
+    for (size_t i = 0; i < partners.size(); ++i) {
+        const size_t ix = detector.axisBinIndex(i, 0);
+        const size_t iy = detector.axisBinIndex(i, 1);
+        EXPECT_EQ(detector.axisBinIndex(partners[i], 0), 5u - ix);
+        EXPECT_EQ(detector.axisBinIndex(partners[i], 1), iy);
+    }
+
+    // the specular channel of an odd number of channels is its own mirror image
+    SphericalDetector odd_detector(5, -1.0, 1.0, 3, 0.0, 1.0);
+    partners = MirrorSymmetry::Partners(createElements(odd_detector, 0.0));
+    ASSERT_EQ(partners.size(), 15u);
+    EXPECT_EQ(partners[7], 7u);
+
+    // off-specular scans: channels are paired only for the same incident angle
+    auto elements = createElements(detector, 0.0, 0.1 * Units::deg);
+    const auto elements_2 = createElements(detector, 0.0, 0.3 * Units::deg);
+    elements.insert(elements.end(), elements_2.begin(), elements_2.end());
+    partners = MirrorSymmetry::Partners(elements);
+    ASSERT_EQ(partners.size(), 36u);
+    for (size_t i = 0; i < partners.size(); ++i)
+        EXPECT_EQ(partners[i] / 18u, i / 18u);
+
+    SphericalDetector asymmetric_detector(6, -1.0, 1.3, 3, 0.0, 1.0);
+    EXPECT_TRUE(MirrorSymmetry::Partners(createElements(asymmetric_detector, 0.0)).empty());
+    EXPECT_TRUE(MirrorSymmetry::Partners(createElements(detector, 0.1 * Units::deg)).empty());
+}
+
+TEST_F(MirrorSymmetryTest, SimulationResult)
+{
+    auto P_sample = SimulationTestHelper::createCylinders();
+    auto P_simulation = SimulationTestHelper::createSimulation(*P_sample);
+
+    P_simulation->getOptions().setUseMirrorSymmetry(false);
+    P_simulation->runSimulation();
+    const auto reference = P_simulation->result();
+
+    P_simulation->getOptions().setUseMirrorSymmetry(true);
+    P_simulation->runSimulation();
+    const auto result = P_simulation->result();
+
+    SimulationTestHelper::expectPositive(reference);
+    SimulationTestHelper::expectNear(result, reference, 1e-10);
+}
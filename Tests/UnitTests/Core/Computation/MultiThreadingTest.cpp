@@ -0,0 +1,58 @@
+#include "google_test.h"
+#include "FTDecayFunctions.h"
+#include "FormFactorCylinder.h"
+#include "FormFactorFullSphere.h"
+#include "InterferenceFunction2DLattice.h"
+#include "InterferenceFunctionHardDisk.h"
+#include "LayerRoughness.h"
+#include "Particle.h"
+#include "SimulationTestHelper.h"
+
+class MultiThreadingTest : public ::testing::Test
+{
+protected:
+    ~MultiThreadingTest();
+
+    //! Returns a sample whose interference functions integrate numerically, with two layouts
+    //! in a rough layer, such that all threads evaluate the same ProcessedSample concurrently
+    std::unique_ptr<MultiLayer> createSample() const
+    {
+        Material particle_material = SimulationTestHelper::particleMaterial();
+
+        ParticleLayout lattice_layout;
+        lattice_layout.addParticle(Particle(particle_material, FormFactorCylinder(5.0, 5.0)));
+        std::unique_ptr<InterferenceFunction2DLattice> P_lattice(
+            InterferenceFunction2DLattice::createHexagonal(20.0));
+        P_lattice->setDecayFunction(FTDecayFunction2DCauchy(300.0, 300.0, 0.0));
+        P_lattice->setIntegrationOverXi(true);
+        lattice_layout.setInterferenceFunction(*P_lattice);
+
+        ParticleLayout disk_layout;
+        disk_layout.addParticle(Particle(particle_material, FormFactorFullSphere(3.0)));
+        disk_layout.setInterferenceFunction(InterferenceFunctionHardDisk(3.0, 0.01));
+
+        Layer air_layer(HomogeneousMaterial("Air", 0.0, 0.0));
+        air_layer.addLayout(lattice_layout);
+        air_layer.addLayout(disk_layout);
+        std::unique_ptr<MultiLayer> result(new MultiLayer);
+        result->addLayer(air_layer);
+        result->addLayerWithTopRoughness(Layer(SimulationTestHelper::substrateMaterial()),
+                                         LayerRoughness(1.0, 0.3, 5.0));
+        return result;
+    }
+};
+
+MultiThreadingTest::~MultiThreadingTest() = default;
+
+TEST_F(MultiThreadingTest, SharedSample)
+{
+    auto P_simulation = SimulationTestHelper::createSimulation(*createSample(), 12, 10);
+    P_simulation->runSimulation();
+    const auto reference = P_simulation->result();
+
+    P_simulation->getOptions().setNumberOfThreads(4);
+    P_simulation->runSimulation();
+
+    SimulationTestHelper::expectPositive(reference);
+    SimulationTestHelper::expectNear(P_simulation->result(), reference, 1e-15);
+}
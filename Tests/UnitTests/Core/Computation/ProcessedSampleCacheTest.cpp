@@ -0,0 +1,158 @@
+#include "google_test.h"
+#include "FTDistributions1D.h"
+#include "FormFactorCylinder.h"
+#include "InterferenceFunctionRadialParaCrystal.h"
+#include "Particle.h"
+#include "ProcessedLayout.h"
+#include "ProcessedSample.h"
+#include "ProcessedSampleCache.h"
+#include "SimulationTestHelper.h"
+
+class ProcessedSampleCacheTest : public ::testing::Test
+{
+protected:
+    ~ProcessedSampleCacheTest();
+
+    std::unique_ptr<MultiLayer> createSample(double radius, double substrate_delta = 6e-6,
+                                             double peak_distance = 0.0) const
+    {
+        ParticleLayout layout;
+        layout.addParticle(
+            Particle(SimulationTestHelper::particleMaterial(), FormFactorCylinder(radius, 5.0)));
+        if (peak_distance > 0.0) {
+            InterferenceFunctionRadialParaCrystal interference(peak_distance, 1e3);
+            interference.setProbabilityDistribution(FTDistribution1DGauss(2.0));
+            layout.setInterferenceFunction(interference);
+        }
+        return SimulationTestHelper::createSample(
+            layout, HomogeneousMaterial("Substrate", substrate_delta, 2e-8));
+    }
+
+    SimulationResult simulate(const MultiLayer& sample, bool caching,
+                              double wavelength = 0.1) const
+    {
+        auto P_simulation = SimulationTestHelper::createSimulation(sample);
+        P_simulation->setBeamParameters(wavelength, 0.2 * Units::deg, 0.0);
+        P_simulation->getOptions().setSampleCaching(caching);
+        P_simulation->runSimulation();
+        return P_simulation->result();
+    }
+};
+
+ProcessedSampleCacheTest::~ProcessedSampleCacheTest() = default;
+
+TEST_F(ProcessedSampleCacheTest, StackKey)
+{
+    SimulationOptions options;
+    const auto key = ProcessedSampleCache::stackKey(*createSample(5.0), options);
+    EXPECT_FALSE(key.empty());
+    EXPECT_EQ(key, ProcessedSampleCache::stackKey(*createSample(5.0), options));
+    EXPECT_NE(key, ProcessedSampleCache::stackKey(*createSample(5.0, 6e-6 + 1e-17), options));
+    // without average materials, the particles and the interference are not part of the stack
+    EXPECT_EQ(key, ProcessedSampleCache::stackKey(*createSample(6.0), options));
+    EXPECT_EQ(key, ProcessedSampleCache::stackKey(*createSample(5.0, 6e-6, 20.0), options));
+    options.setUseAvgMaterials(true);
+    const auto avg_key = ProcessedSampleCache::stackKey(*createSample(5.0), options);
+    EXPECT_NE(key, avg_key);
+    EXPECT_NE(avg_key, ProcessedSampleCache::stackKey(*createSample(5.0 + 1e-12), options));
+}
+
+TEST_F(ProcessedSampleCacheTest, ParticleKey)
+{
+    const Particle particle(SimulationTestHelper::particleMaterial(),
+                            FormFactorCylinder(5.0, 5.0));
+    const auto key = ProcessedSampleCache::particleKey(particle);
+    EXPECT_FALSE(key.empty());
+    std::unique_ptr<Particle> P_clone(particle.clone());
+    EXPECT_EQ(key, ProcessedSampleCache::particleKey(*P_clone));
+    EXPECT_NE(key, ProcessedSampleCache::particleKey(Particle(
+                       SimulationTestHelper::particleMaterial(),
+                       FormFactorCylinder(5.0 + 1e-12, 5.0))));
+    EXPECT_NE(key, ProcessedSampleCache::particleKey(
+                       Particle(HomogeneousMaterial("Particle", 6e-4, 2e-8 + 1e-20),
+                                FormFactorCylinder(5.0, 5.0))));
+    std::unique_ptr<Particle> P_shifted(particle.clone());
+    P_shifted->setPosition(0.0, 0.0, 1.0);
+    EXPECT_NE(key, ProcessedSampleCache::particleKey(*P_shifted));
+}
+
+TEST_F(ProcessedSampleCacheTest, SharedAcrossSimulations)
+{
+    auto& cache = ProcessedSampleCache::instance();
+    cache.clear();
+    const auto reference = simulate(*createSample(5.0), false);
+    EXPECT_EQ(cache.size(), 0u);
+
+    const auto first = simulate(*createSample(5.0), true);
+    const auto second = simulate(*createSample(5.0), true);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.misses(), 1u);
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.particleMisses(), 1u);
+    EXPECT_EQ(cache.particleHits(), 1u);
+    SimulationTestHelper::expectNear(first, reference, 0.0);
+    SimulationTestHelper::expectNear(second, reference, 0.0);
+
+    // another particle in the same layer stack
+    simulate(*createSample(6.0), true);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.hits(), 2u);
+    EXPECT_EQ(cache.particleCount(), 2u);
+    EXPECT_EQ(cache.particleMisses(), 2u);
+    cache.clear();
+}
+
+TEST_F(ProcessedSampleCacheTest, InterferenceOnly)
+{
+    auto& cache = ProcessedSampleCache::instance();
+    cache.clear();
+    SimulationOptions options;
+    auto P_first = cache.processedSample(*createSample(5.0), options, 0.1);
+    auto P_second = cache.processedSample(*createSample(5.0, 6e-6, 20.0), options, 0.1);
+    EXPECT_EQ(P_first->fresnelMap(), P_second->fresnelMap());
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.particleHits(), 1u);
+    EXPECT_EQ(cache.particleCount(), 1u);
+    EXPECT_EQ(P_first->layouts()[0].interferenceFunction(), nullptr);
+    EXPECT_NE(P_second->layouts()[0].interferenceFunction(), nullptr);
+
+    const auto reference = simulate(*createSample(5.0, 6e-6, 20.0), false);
+    const auto result = simulate(*createSample(5.0, 6e-6, 20.0), true);
+    SimulationTestHelper::expectNear(result, reference, 0.0);
+    cache.clear();
+}
+
+TEST_F(ProcessedSampleCacheTest, Eviction)
+{
+    auto& cache = ProcessedSampleCache::instance();
+    cache.clear();
+    const size_t capacity = cache.capacity();
+    cache.setCapacity(2);
+    SimulationOptions options;
+    auto P_first = cache.processedSample(*createSample(5.0, 4e-6), options, 0.1);
+    cache.processedSample(*createSample(5.0, 5e-6), options, 0.1);
+    EXPECT_EQ(P_first->fresnelMap(),
+              cache.processedSample(*createSample(5.0, 4e-6), options, 0.1)->fresnelMap());
+    cache.processedSample(*createSample(5.0, 6e-6), options, 0.1); // evicts delta 5e-6
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(P_first->fresnelMap(),
+              cache.processedSample(*createSample(5.0, 4e-6), options, 0.1)->fresnelMap());
+    EXPECT_EQ(cache.hits(), 2u);
+    cache.processedSample(*createSample(5.0, 5e-6), options, 0.1);
+    EXPECT_EQ(cache.misses(), 4u);
+    cache.setCapacity(capacity);
+    cache.clear();
+}
+
+TEST_F(ProcessedSampleCacheTest, Wavelengths)
+{
+    auto& cache = ProcessedSampleCache::instance();
+    cache.clear();
+    const auto reference = simulate(*createSample(5.0), false, 0.15);
+
+    simulate(*createSample(5.0), true, 0.1);
+    const auto result = simulate(*createSample(5.0), true, 0.15);
+    EXPECT_EQ(cache.hits(), 1u);
+    SimulationTestHelper::expectNear(result, reference, 0.0);
+    cache.clear();
+}
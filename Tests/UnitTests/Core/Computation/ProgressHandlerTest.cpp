@@ -0,0 +1,108 @@
+#include "google_test.h"
+#include "ProgressHandler.h"
+#include "SimulationTestHelper.h"
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ProgressHandlerTest : public ::testing::Test
+{
+protected:
+    ~ProgressHandlerTest();
+};
+
+ProgressHandlerTest::~ProgressHandlerTest() = default;
+
+TEST_F(ProgressHandlerTest, RateLimit)
+{
+    std::vector<size_t> percentages;
+    ProgressHandler progress;
+    progress.subscribe([&percentages](size_t percentage) {
+        percentages.push_back(percentage);
+        return true;
+    });
+    progress.setExpectedNTicks(1000);
+    for (int i = 0; i < 999; ++i)
+        progress.incrementDone(1);
+    // the first call is due immediately, the following ones within the interval are skipped
+    ASSERT_FALSE(percentages.empty());
+    EXPECT_EQ(percentages.front(), 0u);
+    EXPECT_LT(percentages.size(), 100u);
+    const size_t n_calls = percentages.size();
+    progress.incrementDone(1);
+    EXPECT_EQ(percentages.size(), n_calls + 1);
+    EXPECT_EQ(percentages.back(), 100u);
+}
+
+TEST_F(ProgressHandlerTest, Threads)
+{
+    std::mutex mutex;
+    size_t n_concurrent = 0, max_concurrent = 0, last_percentage = 0;
+    ProgressHandler progress;
+    progress.subscribe([&](size_t percentage) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            max_concurrent = std::max(max_concurrent, ++n_concurrent);
+        }
+        last_percentage = percentage;
+        std::lock_guard<std::mutex> lock(mutex);
+        --n_concurrent;
+        return true;
+    });
+    progress.setExpectedNTicks(40000);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&progress] {
+            for (int j = 0; j < 10000; ++j)
+                progress.incrementDone(1);
+        });
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(max_concurrent, 1u);
+    EXPECT_EQ(last_percentage, 100u);
+}
+
+TEST_F(ProgressHandlerTest, Termination)
+{
+    ProgressHandler progress;
+    progress.subscribe([](size_t percentage) { return percentage < 50; });
+    progress.setExpectedNTicks(100);
+    progress.incrementDone(10);
+    EXPECT_TRUE(progress.alive());
+    progress.incrementDone(90);
+    EXPECT_FALSE(progress.alive());
+    progress.reset();
+    EXPECT_TRUE(progress.alive());
+}
+
+TEST_F(ProgressHandlerTest, Simulation)
+{
+    auto P_simulation =
+        SimulationTestHelper::createSimulation(*SimulationTestHelper::createCylinders(), 25, 20);
+    P_simulation->getOptions().setNumberOfThreads(3);
+    std::vector<size_t> percentages;
+    P_simulation->subscribe([&percentages](size_t percentage) {
+        percentages.push_back(percentage);
+        return true;
+    });
+    P_simulation->runSimulation();
+    ASSERT_FALSE(percentages.empty());
+    EXPECT_EQ(percentages.back(), 100u);
+    EXPECT_EQ(std::count(percentages.begin(), percentages.end(), 100u), 1);
+}
+
+//! The last progress is reported within the computation, such that exceptions thrown by the
+//! subscriber reach the caller
+TEST_F(ProgressHandlerTest, ThrowingSubscriber)
+{
+    auto P_simulation =
+        SimulationTestHelper::createSimulation(*SimulationTestHelper::createCylinders(), 25, 20);
+    P_simulation->getOptions().setNumberOfThreads(3);
+    P_simulation->subscribe([](size_t percentage) {
+        if (percentage == 100)
+            throw std::runtime_error("ProgressHandlerTest");
+        return true;
+    });
+    EXPECT_THROW(P_simulation->runSimulation(), std::runtime_error);
+}
@@ -1,8 +1,14 @@
 #include "google_test.h"
+#include "DataFormatUtils.h"
+#include "Exceptions.h"
 #include "FixedBinAxis.h"
+#include "IntensityDataIOFactory.h"
 #include "OutputData.h"
 #include "OutputDataWriteStrategy.h"
 #include "OutputDataReadStrategy.h"
+#include "VariableBinAxis.h"
+#include <algorithm>
+#include <cstdio>
 
 class IOStrategyTest : public ::testing::Test
 {
@@ -61,6 +67,70 @@ TEST_F(IOStrategyTest, TestNumpyTXTStrategies)
         EXPECT_EQ(m_model_data[i], (*result)[i]);
 }
 
+TEST_F(IOStrategyTest, TestBinaryStrategies)
+{
+    m_model_data[3] = 1.0 / 3.0;
+    for (bool single_precision : {false, true}) {
+        std::stringstream ss;
+        OutputDataWriteBinaryStrategy write_binary_strategy(single_precision);
+        write_binary_strategy.writeOutputData(m_model_data, ss);
+
+        OutputDataReadBinaryStrategy read_binary_strategy;
+        auto result = std::unique_ptr<OutputData<double>>(read_binary_strategy.readOutputData(ss));
+        EXPECT_EQ(m_model_data.getRank(), result->getRank());
+        EXPECT_EQ(m_model_data.getAllSizes(), result->getAllSizes());
+        EXPECT_EQ(m_model_data.getAxis(1).getMax(), result->getAxis(1).getMax());
+        for (size_t i = 0, size = m_model_data.getAllocatedSize(); i < size ;++i)
+            EXPECT_EQ(single_precision ? static_cast<double>(static_cast<float>(m_model_data[i]))
+                                       : m_model_data[i], (*result)[i]);
+    }
+
+    std::stringstream truncated;
+    OutputDataWriteBinaryStrategy().writeOutputData(m_model_data, truncated);
+    const std::string content = truncated.str();
+    OutputDataReadBinaryStrategy read_binary_strategy;
+    EXPECT_THROW(read_binary_strategy.readOutputData(content.data(), content.size() - 1),
+                 Exceptions::FormatErrorException);
+    EXPECT_THROW(read_binary_strategy.readOutputData(content.data() + 1, content.size() - 1),
+                 Exceptions::FormatErrorException);
+
+    // values in native byte order are used in place
+    std::shared_ptr<char> buffer(new char[content.size()], std::default_delete<char[]>());
+    std::copy(content.begin(), content.end(), buffer.get());
+    std::unique_ptr<OutputData<double>> shared(
+        read_binary_strategy.readOutputData(buffer, content.size()));
+    EXPECT_EQ(m_model_data.getRawDataVector(), shared->getRawDataVector());
+    if (DataFormatUtils::isLittleEndian())
+        EXPECT_EQ(reinterpret_cast<char*>(shared->getRawDataStorage().get()
+                                          + shared->getAllocatedSize()),
+                  buffer.get() + content.size());
+}
+
+TEST_F(IOStrategyTest, TestBinaryFiles)
+{
+    OutputData<double> data;
+    data.addAxis(VariableBinAxis("x", 3, {0.0, 0.1, 0.5, 2.0}));
+    data.addAxis(FixedBinAxis("y", 4, -1.0, 1.0));
+    for (size_t i = 0, size = data.getAllocatedSize(); i < size ;++i)
+        data[i] = 0.1 * static_cast<double>(i);
+
+    for (std::string file_name : {"IOStrategyTest.bab", "IOStrategyTest.bab.gz"}) {
+        IntensityDataIOFactory::writeOutputData(data, file_name);
+        std::unique_ptr<OutputData<double>> result(
+            IntensityDataIOFactory::readOutputData(file_name));
+        ASSERT_TRUE(result);
+        EXPECT_EQ(data.getAxis(0).getBinBoundaries(), result->getAxis(0).getBinBoundaries());
+        EXPECT_EQ(data.getRawDataVector(), result->getRawDataVector());
+
+        // modifications of the result do not change the file
+        (*result)[0] = 1.0;
+        std::unique_ptr<OutputData<double>> reread(
+            IntensityDataIOFactory::readOutputData(file_name));
+        std::remove(file_name.c_str());
+        EXPECT_EQ(data.getRawDataVector(), reread->getRawDataVector());
+    }
+}
+
 #ifdef BORNAGAIN_TIFF_SUPPORT
 
 TEST_F(IOStrategyTest, TestTIFFStrategies)
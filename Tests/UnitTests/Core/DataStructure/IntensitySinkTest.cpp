@@ -0,0 +1,128 @@
+#include "google_test.h"
+#include "Exceptions.h"
+#include "FixedBinAxis.h"
+#include "IntensityDataIOFactory.h"
+#include "IntensitySink.h"
+#include "OffSpecSimulation.h"
+#include "Rectangle.h"
+#include "ResolutionFunction2DGaussian.h"
+#include "SimulationTestHelper.h"
+#include <cstdio>
+
+namespace
+{
+//! Sink which keeps the result in memory and counts the written blocks.
+class MemorySink : public IIntensitySink
+{
+public:
+    void open(const std::vector<std::unique_ptr<IAxis>>& axes) override
+    {
+        size_t total_size = 1;
+        for (const auto& P_axis : axes)
+            total_size *= P_axis->size();
+        m_data.assign(total_size, 0.0);
+    }
+    void writeBlock(size_t offset, const std::vector<double>& values) override
+    {
+        ASSERT_LE(offset + values.size(), m_data.size());
+        std::copy(values.begin(), values.end(), m_data.begin() + offset);
+        ++m_n_blocks;
+    }
+    std::vector<double> m_data;
+    size_t m_n_blocks = 0;
+};
+}
+
+class IntensitySinkTest : public ::testing::Test
+{
+protected:
+    ~IntensitySinkTest();
+};
+
+IntensitySinkTest::~IntensitySinkTest() = default;
+
+TEST_F(IntensitySinkTest, GISASChunks)
+{
+    auto P_simulation =
+        SimulationTestHelper::createSimulation(*SimulationTestHelper::createCylinders(), 5, 4);
+    P_simulation->setRegionOfInterest(-1.5 * Units::deg, 0.3 * Units::deg, 1.5 * Units::deg,
+                                      2.7 * Units::deg);
+    P_simulation->addMask(Rectangle(-0.1 * Units::deg, 1.0 * Units::deg, 0.1 * Units::deg,
+                                    1.3 * Units::deg));
+
+    P_simulation->runSimulation();
+    const auto reference = P_simulation->result();
+
+    MemorySink sink;
+    P_simulation->runChunkedSimulation(sink, 4);
+    EXPECT_GT(sink.m_n_blocks, 2u);
+    SimulationTestHelper::expectNear(sink.m_data, reference, 1e-10);
+
+    P_simulation->setDetectorResolutionFunction(ResolutionFunction2DGaussian(0.1, 0.1));
+    EXPECT_THROW(P_simulation->runChunkedSimulation(sink, 4), std::runtime_error);
+    EXPECT_THROW(P_simulation->runChunkedSimulation(sink, 0), std::runtime_error);
+}
+
+TEST_F(IntensitySinkTest, OffSpecChunks)
+{
+    OffSpecSimulation simulation(*SimulationTestHelper::createCylinders());
+    simulation.setDetectorParameters(3, -1.0 * Units::deg, 1.0 * Units::deg, 4, 0.0,
+                                     1.0 * Units::deg);
+    simulation.setBeamParameters(0.1, FixedBinAxis("alpha_i", 5, 0.1 * Units::deg,
+                                                   0.5 * Units::deg), 0.0);
+    simulation.getOptions().setNumberOfThreads(1);
+
+    simulation.runSimulation();
+    const auto reference = simulation.result();
+
+    // chunks are extended to two detector images
+    MemorySink sink;
+    simulation.runChunkedSimulation(sink, 13);
+    EXPECT_EQ(sink.m_n_blocks, 5u);
+    SimulationTestHelper::expectNear(sink.m_data, reference, 1e-10);
+
+    // a repeated simulation does not accumulate the intensities
+    simulation.runSimulation();
+    SimulationTestHelper::expectNear(simulation.result(), reference, 1e-10);
+}
+
+TEST_F(IntensitySinkTest, FileSink)
+{
+    const std::string file_name = "IntensitySinkTest.bab";
+    IntensityFileSink sink(file_name);
+    EXPECT_THROW(sink.writeBlock(0, {1.0}), std::runtime_error);
+    std::vector<std::unique_ptr<IAxis>> axes;
+    axes.emplace_back(new FixedBinAxis("x", 5, 0.0, 5.0));
+    sink.open(axes);
+    sink.writeBlock(3, {3.0, 4.0});
+    sink.writeBlock(0, {1.0});
+    EXPECT_THROW(sink.writeBlock(4, {1.0, 2.0}), Exceptions::OutOfBoundsException);
+    sink.close();
+
+    std::unique_ptr<OutputData<double>> P_data(IntensityDataIOFactory::readOutputData(file_name));
+    std::remove(file_name.c_str());
+    ASSERT_EQ(P_data->getRank(), 1u);
+    EXPECT_EQ(P_data->getAxis(0).getMax(), 5.0);
+    EXPECT_EQ(P_data->getRawDataVector(), std::vector<double>({1.0, 0.0, 0.0, 3.0, 4.0}));
+}
+
+TEST_F(IntensitySinkTest, GISASFile)
+{
+    auto P_simulation =
+        SimulationTestHelper::createSimulation(*SimulationTestHelper::createCylinders(), 5, 4);
+    P_simulation->setRegionOfInterest(-1.5 * Units::deg, 0.3 * Units::deg, 1.5 * Units::deg,
+                                      2.7 * Units::deg);
+    P_simulation->runSimulation();
+    const auto reference = P_simulation->result().data();
+
+    const std::string file_name = "IntensitySinkTest_GISAS.bab";
+    IntensityFileSink sink(file_name);
+    P_simulation->runChunkedSimulation(sink, 4);
+    std::unique_ptr<OutputData<double>> P_data(IntensityDataIOFactory::readOutputData(file_name));
+    std::remove(file_name.c_str());
+    ASSERT_EQ(P_data->getAllSizes(), reference->getAllSizes());
+    for (size_t i = 0; i < reference->getRank(); ++i)
+        EXPECT_EQ(P_data->getAxis(i).getBinCenters(), reference->getAxis(i).getBinCenters());
+    SimulationTestHelper::expectNear(P_data->getRawDataVector(), reference->getRawDataVector(),
+                                     1e-10);
+}
@@ -253,3 +253,30 @@ TEST_F(OutputDataTest, MixedTypeOperations)
     data_double.addAxis("axis2", 10, -1.0, 1.0);
     EXPECT_FALSE(data_bool.hasSameShape(data_double));
 }
+
+TEST_F(OutputDataTest, SharedStorage)
+{
+    OutputData<double> data;
+    data.addAxis("axis1", 2, 0.0, 2.0);
+    data.addAxis("axis2", 3, 0.0, 3.0);
+
+    // the storage outlives reallocation and is not affected by it
+    std::shared_ptr<double> storage = data.getRawDataStorage();
+    data[4] = 4.0;
+    EXPECT_EQ(storage.get()[4], 4.0);
+    data.allocate();
+    EXPECT_EQ(storage.get()[4], 4.0);
+    EXPECT_EQ(data[4], 0.0);
+
+    // external values are used without copying
+    std::vector<double> values = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    data.setRawDataStorage(std::shared_ptr<double>(values.data(), [](double*) {}));
+    EXPECT_EQ(data.getAllocatedSize(), 6u);
+    EXPECT_EQ(data.totalSum(), 15.0);
+    data.scaleAll(2.0);
+    EXPECT_EQ(values[5], 10.0);
+
+    std::unique_ptr<OutputData<double>> P_clone(data.clone());
+    (*P_clone)[0] = 1.0;
+    EXPECT_EQ(values[0], 0.0);
+}
@@ -0,0 +1,133 @@
+#include "google_test.h"
+#include "Beam.h"
+#include "DetectorElement.h"
+#include "MultiResolutionGrid.h"
+#include "Rectangle.h"
+#include "SimulationElement.h"
+#include "SimulationOptions.h"
+#include "SphericalDetector.h"
+#include "Units.h"
+#include <cmath>
+
+class MultiResolutionGridTest : public ::testing::Test
+{
+protected:
+    ~MultiResolutionGridTest();
+
+    std::vector<SimulationElement> createElements(SphericalDetector& detector) const
+    {
+        Beam beam;
+        beam.setCentralK(1.0, 0.2 * Units::deg, 0.0);
+        std::vector<SimulationElement> result;
+        for (auto& element : detector.createDetectorElements(beam))
+            result.emplace_back(1.0, -0.2 * Units::deg, 0.0, element.pixel());
+        return result;
+    }
+
+    //! Sets the intensities of the given elements from a function of the channel indices.
+    template <class F>
+    void setIntensities(const SphericalDetector& detector, std::vector<SimulationElement>& elements,
+                        F func, const std::vector<size_t>& indices) const
+    {
+        for (size_t i : indices) {
+            size_t ix = detector.axisBinIndex(i, 0);
+            size_t iy = detector.axisBinIndex(i, 1);
+            elements[i].setIntensity(func(static_cast<double>(ix), static_cast<double>(iy)));
+        }
+    }
+};
+
+MultiResolutionGridTest::~MultiResolutionGridTest() = default;
+
+TEST_F(MultiResolutionGridTest, Validity)
+{
+    SphericalDetector detector(17, -1.0, 1.0, 9, 0.0, 1.0);
+    EXPECT_TRUE(MultiResolutionGrid(detector, 4).isValid(17 * 9));
+    EXPECT_FALSE(MultiResolutionGrid(detector, 4).isValid(17 * 9 + 1));
+    EXPECT_FALSE(MultiResolutionGrid(detector, 1).isValid(17 * 9));
+    // less than three nodes along the second axis
+    EXPECT_FALSE(MultiResolutionGrid(detector, 8).isValid(17 * 9));
+}
+
+TEST_F(MultiResolutionGridTest, Options)
+{
+    SimulationOptions options;
+    EXPECT_FALSE(options.isMultiResolution());
+    options.setMultiResolution(true, 2);
+    EXPECT_TRUE(options.isMultiResolution());
+    EXPECT_THROW(options.setMultiResolution(true, 1), std::runtime_error);
+    EXPECT_THROW(options.setMultiResolution(true, 4, -0.1), std::runtime_error);
+    options.setMultiResolution(false, 1);
+    EXPECT_FALSE(options.isMultiResolution());
+}
+
+TEST_F(MultiResolutionGridTest, CoarseElements)
+{
+    SphericalDetector detector(10, -1.0, 1.0, 9, 0.0, 1.0);
+    MultiResolutionGrid grid(detector, 4);
+    // nodes at x = 0, 4, 8, 9 and y = 0, 4, 8
+    EXPECT_EQ(grid.coarseElements().size(), 12u);
+
+    // masked node at (4, 4): the four adjacent cells are computed exactly
+    detector.addMask(Rectangle(-0.15, 0.45, -0.05, 0.55), true);
+    MultiResolutionGrid masked_grid(detector, 4);
+    EXPECT_TRUE(masked_grid.isValid(10 * 9 - 1));
+    EXPECT_EQ(masked_grid.coarseElements().size(), 11u + 66u);
+}
+
+TEST_F(MultiResolutionGridTest, BilinearIntensity)
+{
+    SphericalDetector detector(17, -1.0, 1.0, 13, 0.0, 1.0);
+    auto elements = createElements(detector);
+    auto func = [](double x, double y) { return 1.0 + 2.0 * x + 3.0 * y + 0.5 * x * y; };
+
+    MultiResolutionGrid grid(detector, 4);
+    ASSERT_TRUE(grid.isValid(elements.size()));
+    setIntensities(detector, elements, func, grid.coarseElements());
+    EXPECT_TRUE(grid.refine(elements, 1e-3, 0.0).empty());
+    EXPECT_EQ(grid.numberOfInterpolatedElements(), elements.size() - 20u);
+
+    std::vector<double> errors;
+    grid.interpolate(elements, errors);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        double x = static_cast<double>(detector.axisBinIndex(i, 0));
+        double y = static_cast<double>(detector.axisBinIndex(i, 1));
+        EXPECT_NEAR(elements[i].getIntensity(), func(x, y), 1e-10);
+        EXPECT_NEAR(errors[i], 0.0, 1e-12);
+    }
+}
+
+TEST_F(MultiResolutionGridTest, RefinePeak)
+{
+    SphericalDetector detector(17, -1.0, 1.0, 17, 0.0, 1.0);
+    auto elements = createElements(detector);
+    auto func = [](double x, double y) {
+        return 1.0 + 100.0 * std::exp(-(x - 8.0) * (x - 8.0) - (y - 8.0) * (y - 8.0));
+    };
+
+    MultiResolutionGrid grid(detector, 4);
+    setIntensities(detector, elements, func, grid.coarseElements());
+    auto fine = grid.refine(elements, 0.01, 0.0);
+    EXPECT_FALSE(fine.empty());
+    setIntensities(detector, elements, func, fine);
+
+    std::vector<double> errors;
+    grid.interpolate(elements, errors);
+    // the peak region is computed exactly
+    const size_t peak = 9 * 17 + 9;
+    EXPECT_DOUBLE_EQ(elements[peak].getIntensity(), func(9.0, 9.0));
+    EXPECT_DOUBLE_EQ(errors[peak], 0.0);
+}
+
+TEST_F(MultiResolutionGridTest, RefineCriticalAngle)
+{
+    SphericalDetector detector(17, -1.0, 1.0, 17, 0.0, 1.0);
+    auto elements = createElements(detector);
+    auto func = [](double, double) { return 1.0; };
+
+    MultiResolutionGrid grid(detector, 4);
+    setIntensities(detector, elements, func, grid.coarseElements());
+    // critical angle lies in the second row of cells
+    auto fine = grid.refine(elements, 0.01, 0.3);
+    EXPECT_EQ(fine.size(), 4u * 17u - 5u);
+}
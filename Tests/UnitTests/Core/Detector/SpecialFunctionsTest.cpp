@@ -98,3 +98,24 @@ TEST_F(SpecialFunctionsTest, csinc)
         EXPECT_CNEAR(MathFunctions::sinc(z), 1. - z * z / 6. * (1. - z * z / 20.), eps);
     }
 }
+
+// Test the real Laue function sin(N*x)/sin(x), in particular at its principal maxima
+TEST_F(SpecialFunctionsTest, Laue)
+{
+    EXPECT_DOUBLE_EQ(MathFunctions::Laue(0.3, 7), std::sin(2.1) / std::sin(0.3));
+    EXPECT_DOUBLE_EQ(MathFunctions::Laue(-2.0, 4), std::sin(-8.0) / std::sin(-2.0));
+    EXPECT_DOUBLE_EQ(MathFunctions::Laue(0.0, 5), 5.0);
+
+    // at x = k*pi, the value is N, with the sign (-1)^(k*(N-1))
+    for (int k = -3; k <= 3; ++k) {
+        EXPECT_DOUBLE_EQ(MathFunctions::Laue(k * M_PI, 11), 11.0);
+        EXPECT_DOUBLE_EQ(MathFunctions::Laue(k * M_PI, 10), k % 2 ? -10.0 : 10.0);
+        EXPECT_NEAR(MathFunctions::Laue(k * M_PI + 1e-9, 100), k % 2 ? -100.0 : 100.0, 1e-9);
+    }
+
+    // near a maximum of large order, compared to the first maximum
+    const double d = 1e-3;
+    for (int k = 1; k <= 3; ++k)
+        EXPECT_NEAR(std::abs(MathFunctions::Laue(k * M_PI + d, 1000)),
+                    MathFunctions::Laue(d, 1000), 1e-9 * MathFunctions::Laue(d, 1000));
+}
@@ -315,6 +315,31 @@ TEST_F(ObjectiveMetricTest, RQ4IllFormed)
     EXPECT_DOUBLE_EQ(metric.computeFromArrays(sim_data, exp_data, weight_factors_1), 0.0);
 }
 
+TEST_F(ObjectiveMetricTest, SinglePrecision)
+{
+    // values that are exact in single precision
+    const std::vector<double> sim_data {1.0, 2.0, 3.0, 4.0};
+    const std::vector<double> exp_data {2.0, 1.0, 4.0, 3.0};
+    const std::vector<double> uncertainties {0.125, 0.125, 0.5, 0.5};
+    const std::vector<double> weight_factors {1.0, 1.0, 1.0, 2.0};
+    const std::vector<float> exp_values(exp_data.begin(), exp_data.end());
+    const std::vector<float> uncertainty_values(uncertainties.begin(), uncertainties.end());
+    const std::vector<float> weight_values(weight_factors.begin(), weight_factors.end());
+
+    for (auto name : {"chi2", "poisson-like", "log", "reldiff"}) {
+        auto metric = ObjectiveMetricUtils::createMetric(name);
+        EXPECT_DOUBLE_EQ(metric->computeFromSinglePrecision(sim_data, exp_values,
+                                                            uncertainty_values, weight_values),
+                         metric->computeFromArrays(sim_data, exp_data, uncertainties,
+                                                   weight_factors));
+        EXPECT_DOUBLE_EQ(
+            metric->computeFromSinglePrecision(sim_data, exp_values, weight_values),
+            metric->computeFromArrays(sim_data, exp_data, weight_factors));
+        EXPECT_THROW(metric->computeFromSinglePrecision(sim_data, exp_values, {}),
+                     std::runtime_error);
+    }
+}
+
 TEST_F(ObjectiveMetricTest, createMetric)
 {
     auto result = ObjectiveMetricUtils::createMetric("Poisson-like");
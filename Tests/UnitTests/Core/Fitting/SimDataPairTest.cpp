@@ -116,3 +116,93 @@ TEST_F(SimDataPairTest, moveTest)
     EXPECT_EQ(moved.experimentalData().size(), expected_size);
 }
 
+
+TEST_F(SimDataPairTest, singlePrecisionData)
+{
+    FittingTestHelper helper;
+
+    simulation_builder_t builder = [&](const Fit::Parameters& pars) {
+        auto result = helper.createSimulation(pars);
+        result->getOptions().setSinglePrecisionData();
+        return result;
+    };
+
+    const double exp_value(10.1);
+    const double dataset_weight(0.3);
+    SimDataPair obj(builder, *helper.createData(exp_value), nullptr, dataset_weight);
+    EXPECT_THROW(obj.experimental_array(), std::runtime_error);
+
+    Fit::Parameters params;
+    obj.runSimulation(params);
+    const size_t expected_size = helper.m_nx * helper.m_ny;
+    EXPECT_FALSE(obj.containsUncertainties());
+
+    const auto exp_array = obj.experimental_array();
+    ASSERT_EQ(exp_array.size(), expected_size);
+    EXPECT_EQ(exp_array.front(), static_cast<double>(static_cast<float>(exp_value)));
+    EXPECT_EQ(obj.user_weights_array(),
+              std::vector<double>(expected_size, static_cast<float>(dataset_weight)));
+    EXPECT_EQ(obj.uncertainties_array(), std::vector<double>(expected_size, 0.0));
+
+    const auto exp_data = obj.experimentalData();
+    ASSERT_EQ(exp_data.size(), expected_size);
+    EXPECT_EQ(exp_data[0], exp_array.front());
+    EXPECT_EQ(obj.userWeights().size(), expected_size);
+    EXPECT_EQ(obj.uncertainties().size(), expected_size);
+    EXPECT_EQ(obj.absoluteDifference()[0], exp_array.front());
+
+    // the arrays persist over further simulations and moves
+    obj.runSimulation(params);
+    SimDataPair moved = std::move(obj);
+    EXPECT_EQ(moved.experimental_array(), exp_array);
+}
+
+TEST_F(SimDataPairTest, singlePrecisionUncertainties)
+{
+    FittingTestHelper helper;
+
+    simulation_builder_t builder = [&](const Fit::Parameters& pars) {
+        auto result = helper.createSimulation(pars);
+        result->getOptions().setSinglePrecisionData();
+        return result;
+    };
+
+    SimDataPair obj(builder, *helper.createData(10.1), helper.createData(0.7), 1.0);
+    Fit::Parameters params;
+    obj.runSimulation(params);
+    const size_t expected_size = helper.m_nx * helper.m_ny;
+
+    // the uncertainties are still known after the raw data were released
+    EXPECT_TRUE(obj.containsUncertainties());
+    EXPECT_EQ(obj.uncertainties_array(),
+              std::vector<double>(expected_size, static_cast<float>(0.7)));
+    SimDataPair moved = std::move(obj);
+    EXPECT_TRUE(moved.containsUncertainties());
+    EXPECT_EQ(moved.relativeDifference().size(), expected_size);
+}
+
+TEST_F(SimDataPairTest, singlePrecisionFitArea)
+{
+    FittingTestHelper helper;
+
+    bool roi = false;
+    simulation_builder_t builder = [&](const Fit::Parameters& pars) {
+        auto result = helper.createSimulation(pars);
+        result->getOptions().setSinglePrecisionData();
+        if (roi)
+            dynamic_cast<GISASSimulation&>(*result).setRegionOfInterest(
+                0.0, 0.0, 2.0 * Units::deg, 2.0 * Units::deg);
+        return result;
+    };
+
+    SimDataPair obj(builder, *helper.createData(10.1), nullptr, 1.0);
+    Fit::Parameters params;
+    obj.runSimulation(params);
+    EXPECT_EQ(obj.experimentalValues().size(), helper.size());
+    EXPECT_EQ(obj.userWeightValues().size(), helper.size());
+    EXPECT_TRUE(obj.uncertaintyValues().empty());
+
+    // the raw data were released, so that the data cannot be cut to another fit area
+    roi = true;
+    EXPECT_THROW(obj.runSimulation(params), std::runtime_error);
+}
@@ -0,0 +1,92 @@
+#include "google_test.h"
+#include "FTDistributions1D.h"
+#include "FormFactorCylinder.h"
+#include "InterferenceFunctionRadialParaCrystal.h"
+#include "InterferenceFunctionUtils.h"
+#include "Particle.h"
+#include "PolarizationHandler.h"
+#include "SimulationTestHelper.h"
+
+class PolarizedSpinChannelTest : public ::testing::Test
+{
+protected:
+    ~PolarizedSpinChannelTest();
+
+    //! Returns a sample of magnetic particles on a magnetic substrate with spin-flip scattering
+    std::unique_ptr<MultiLayer> createSample(bool size_spacing_coupling) const
+    {
+        Material particle_material =
+            HomogeneousMaterial("Particle", 6e-4, 2e-8, kvector_t(0.0, 1e7, 0.0));
+        ParticleLayout layout;
+        layout.addParticle(Particle(particle_material, FormFactorCylinder(5.0, 5.0)), 0.6);
+        layout.addParticle(Particle(particle_material, FormFactorCylinder(3.0, 4.0)), 0.4);
+        if (size_spacing_coupling) {
+            InterferenceFunctionRadialParaCrystal interference(15.0, 1e3);
+            interference.setKappa(1.0);
+            interference.setProbabilityDistribution(FTDistribution1DGauss(3.0));
+            layout.setInterferenceFunction(interference);
+        }
+
+        return SimulationTestHelper::createSample(
+            layout, HomogeneousMaterial("Substrate", 6e-6, 2e-8, kvector_t(1e7, 0.0, 0.0)));
+    }
+
+    SimulationResult simulate(bool size_spacing_coupling, kvector_t polarization,
+                              kvector_t analyzer) const
+    {
+        auto P_simulation =
+            SimulationTestHelper::createSimulation(*createSample(size_spacing_coupling));
+        P_simulation->setBeamPolarization(polarization);
+        P_simulation->setAnalyzerProperties(analyzer, 1.0, 0.5);
+        P_simulation->runSimulation();
+        return P_simulation->result();
+    }
+
+    //! Compares the spin-channel computation for the spin-flip channel along z with the full
+    //! matrix computation for slightly tilted directions with off-diagonal operators
+    void compare(bool size_spacing_coupling) const
+    {
+        const double tilt = 1e-12;
+        const auto reference = simulate(size_spacing_coupling, kvector_t(tilt, 0.0, 1.0),
+                                        kvector_t(0.0, tilt, -1.0));
+        const auto result = simulate(size_spacing_coupling, kvector_t(0.0, 0.0, 1.0),
+                                     kvector_t(0.0, 0.0, -1.0));
+        SimulationTestHelper::expectPositive(reference);
+        SimulationTestHelper::expectNear(result, reference, 1e-10);
+    }
+};
+
+PolarizedSpinChannelTest::~PolarizedSpinChannelTest() = default;
+
+TEST_F(PolarizedSpinChannelTest, Weights)
+{
+    PolarizationHandler handler;
+    Eigen::Matrix2d weights;
+    EXPECT_TRUE(InterferenceFunctionUtils::SpinChannelWeights(handler, weights));
+    EXPECT_EQ(weights, Eigen::Matrix2d::Ones());
+
+    Eigen::Matrix2cd polarization;
+    polarization << 0.75, 0.0, 0.0, 0.25;
+    Eigen::Matrix2cd analyzer;
+    analyzer << 0.0, 0.0, 0.0, 1.0;
+    handler.setPolarization(polarization);
+    handler.setAnalyzerOperator(analyzer);
+    EXPECT_TRUE(InterferenceFunctionUtils::SpinChannelWeights(handler, weights));
+    Eigen::Matrix2d expected;
+    expected << 0.0, 0.0, 0.75, 0.25;
+    EXPECT_EQ(weights, expected);
+
+    polarization << 0.5, 0.5, 0.5, 0.5;
+    handler.setPolarization(polarization);
+    EXPECT_FALSE(InterferenceFunctionUtils::SpinChannelWeights(handler, weights));
+}
+
+TEST_F(PolarizedSpinChannelTest, Decoupling)
+{
+    compare(false);
+}
+
+TEST_F(PolarizedSpinChannelTest, SizeSpacingCoupling)
+{
+    compare(true);
+}
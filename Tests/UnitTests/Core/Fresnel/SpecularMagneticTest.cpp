@@ -4,6 +4,7 @@
 #include "MultiLayer.h"
 #include "ProcessedSample.h"
 #include "SimulationOptions.h"
+#include "Slice.h"
 #include "SpecularMagnetic.h"
 #include "SpecularMatrix.h"
 #include "Units.h"
@@ -133,3 +134,119 @@ TEST_F(SpecularMagneticTest, zerofield)
     EXPECT_NEAR(0.0, std::abs(RMS(0) - RMM(0)), eps);
     EXPECT_NEAR(0.0, std::abs(RMS(1) - RMM(1)), eps);
 }
+
+TEST_F(SpecularMagneticTest, thickAbsorbingLayer)
+{
+    // a film of 10 micrometers is opaque, such that the reflection of the film on a
+    // substrate must coincide with that of a film-like substrate
+    kvector_t k = vecOfLambdaAlphaPhi(0.1, -1.0 * Units::deg, 0.0);
+    kvector_t field(0.0, 1e7, 0.0);
+    Layer air_layer(HomogeneousMaterial("Air", 0.0, 0.0));
+    Material film_material = HomogeneousMaterial("Film", 5e-6, 1e-5, field);
+
+    MultiLayer multi_layer_film;
+    multi_layer_film.addLayer(air_layer);
+    multi_layer_film.addLayer(Layer(film_material, 1e4));
+    multi_layer_film.addLayer(Layer(HomogeneousMaterial("Substrate", 6e-6, 2e-8, field)));
+
+    MultiLayer multi_layer_bulk;
+    multi_layer_bulk.addLayer(air_layer);
+    multi_layer_bulk.addLayer(Layer(film_material));
+
+    SimulationOptions options;
+    ProcessedSample sample_film(multi_layer_film, options);
+    ProcessedSample sample_bulk(multi_layer_bulk, options);
+    std::vector<MatrixRTCoefficients> coeffs_film;
+    std::vector<MatrixRTCoefficients> coeffs_bulk;
+    SpecularMagnetic::Execute(sample_film.slices(), k, coeffs_film);
+    SpecularMagnetic::Execute(sample_bulk.slices(), k, coeffs_bulk);
+
+    Eigen::Vector2cd RPF = coeffs_film[0].R1plus() + coeffs_film[0].R2plus();
+    Eigen::Vector2cd RMF = coeffs_film[0].R1min() + coeffs_film[0].R2min();
+    Eigen::Vector2cd RPB = coeffs_bulk[0].R1plus() + coeffs_bulk[0].R2plus();
+    Eigen::Vector2cd RMB = coeffs_bulk[0].R1min() + coeffs_bulk[0].R2min();
+    for (Eigen::Index i = 0; i < 2; ++i) {
+        EXPECT_NEAR(0.0, std::abs(RPF(i) - RPB(i)), 1e-8);
+        EXPECT_NEAR(0.0, std::abs(RMF(i) - RMB(i)), 1e-8);
+    }
+
+    // the transmitted amplitude vanishes deep inside the film
+    Eigen::Vector2cd TPS = coeffs_film[2].T1plus() + coeffs_film[2].T2plus();
+    EXPECT_TRUE(std::isfinite(TPS(0).real()) && std::isfinite(TPS(0).imag()));
+    EXPECT_NEAR(0.0, std::abs(TPS(0)), 1e-10);
+}
+
+namespace
+{
+std::unique_ptr<ProcessedSample> createMagneticMultiLayer()
+{
+    MultiLayer multi_layer;
+    multi_layer.addLayer(Layer(HomogeneousMaterial("Air", 0.0, 0.0)));
+    multi_layer.addLayer(Layer(HomogeneousMaterial("A", 6e-6, 2e-8, kvector_t(0.0, 1e7, 0.0)), 8.0));
+    multi_layer.addLayer(Layer(HomogeneousMaterial("B", 3e-6, 1e-8), 5.0));
+    multi_layer.addLayer(Layer(HomogeneousMaterial("C", 5e-6, 3e-8, kvector_t(4e6, 0.0, 2e6)), 12.0));
+    multi_layer.addLayer(Layer(HomogeneousMaterial("Substrate", 7e-6, 2e-8)));
+    SimulationOptions options;
+    return std::make_unique<ProcessedSample>(multi_layer, options);
+}
+
+std::vector<Eigen::Vector2cd> amplitudes(const MatrixRTCoefficients& coeff)
+{
+    return {coeff.T1plus(), coeff.R1plus(), coeff.T2plus(), coeff.R2plus(),
+            coeff.T1min(),  coeff.R1min(),  coeff.T2min(),  coeff.R2min()};
+}
+}
+
+TEST_F(SpecularMagneticTest, batchedWavevectors)
+{
+    // wavevectors of two wavelengths, going down and up, are computed in one batch
+    std::vector<kvector_t> ks;
+    for (double wavelength : {0.1, 0.15})
+        for (double alpha : {-0.1, -0.5, -2.0, 0.3})
+            ks.push_back(vecOfLambdaAlphaPhi(wavelength, alpha * Units::deg, 0.2 * Units::deg));
+
+    auto sample = createMagneticMultiLayer();
+    const size_t n_slices = sample->slices().size();
+    std::vector<MatrixRTCoefficients> batch;
+    SpecularMagnetic::Execute(sample->slices(), ks, batch);
+    ASSERT_EQ(batch.size(), ks.size() * n_slices);
+
+    for (size_t j = 0; j < ks.size(); ++j) {
+        std::vector<MatrixRTCoefficients> single;
+        SpecularMagnetic::Execute(sample->slices(), ks[j], single);
+        for (size_t i = 0; i < n_slices; ++i) {
+            const auto expected = amplitudes(single[i]);
+            const auto actual = amplitudes(batch[j * n_slices + i]);
+            for (size_t m = 0; m < expected.size(); ++m)
+                EXPECT_NEAR(0.0, (expected[m] - actual[m]).norm(), 1e-12);
+            const Eigen::Vector2cd kz = single[i].getKz();
+            EXPECT_NEAR(0.0, (kz - batch[j * n_slices + i].getKz()).norm(), 1e-12 * kz.norm());
+        }
+    }
+}
+
+TEST_F(SpecularMagneticTest, transferMatrices)
+{
+    // the boundary values of every inner layer follow from those of the layer below through
+    // the 4x4 transfer matrix of the layer
+    const complex_t I(0.0, 1.0);
+    auto sample = createMagneticMultiLayer();
+    const auto& slices = sample->slices();
+    for (double alpha : {-0.1, -0.5, -2.0}) {
+        const kvector_t k = vecOfLambdaAlphaPhi(0.1, alpha * Units::deg, 0.0);
+        std::vector<MatrixRTCoefficients> coeffs;
+        SpecularMagnetic::Execute(slices, k, coeffs);
+        for (size_t i = 1; i + 1 < slices.size(); ++i) {
+            const MatrixRTCoefficients& coeff = coeffs[i];
+            const double t = slices[i].thickness();
+            const Eigen::Matrix4cd l = coeff.R1m * std::exp(I * coeff.kz(0) * t)
+                                       + coeff.T1m * std::exp(-I * coeff.kz(0) * t)
+                                       + coeff.R2m * std::exp(I * coeff.kz(1) * t)
+                                       + coeff.T2m * std::exp(-I * coeff.kz(1) * t);
+            const Eigen::Vector4cd plus = l * coeffs[i + 1].phi_psi_plus;
+            const Eigen::Vector4cd min = l * coeffs[i + 1].phi_psi_min;
+            EXPECT_NEAR(0.0, (plus - coeff.phi_psi_plus).norm(), 1e-12 * plus.norm());
+            EXPECT_NEAR(0.0, (min - coeff.phi_psi_min).norm(), 1e-12 * min.norm());
+        }
+    }
+}
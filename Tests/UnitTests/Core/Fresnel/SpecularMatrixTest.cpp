@@ -0,0 +1,96 @@
+#include "google_test.h"
+#include "KzComputation.h"
+#include "LayerRoughness.h"
+#include "MaterialFactoryFuncs.h"
+#include "Slice.h"
+#include "SpecularMatrix.h"
+
+class SpecularMatrixTest : public ::testing::Test
+{
+protected:
+    ~SpecularMatrixTest();
+
+    struct SliceParameters {
+        double thickness;
+        complex_t sld;
+        double sigma;
+    };
+
+    std::vector<Slice> createSlices() const
+    {
+        std::vector<Slice> result;
+        for (const auto& par : m_parameters) {
+            const Material material = MaterialBySLD("", par.sld.real(), par.sld.imag());
+            if (par.sigma > 0.0)
+                result.emplace_back(par.thickness, material, LayerRoughness(par.sigma, 0.5, 10.0));
+            else
+                result.emplace_back(par.thickness, material);
+        }
+        return result;
+    }
+
+    complex_t reflection(double kz) const
+    {
+        const auto slices = createSlices();
+        return SpecularMatrix::Execute(slices, KzComputation::computeKzFromSLDs(slices, kz))[0]
+            .getScalarR();
+    }
+
+    //! Returns the central difference quotient of R by the given parameter
+    template <class T> complex_t numericDerivative(double kz, T& parameter, T step)
+    {
+        const T value = parameter;
+        parameter = value + step;
+        const complex_t r_plus = reflection(kz);
+        parameter = value - step;
+        const complex_t r_minus = reflection(kz);
+        parameter = value;
+        return (r_plus - r_minus) / (2.0 * std::abs(step));
+    }
+
+    static void expectNear(complex_t analytic, complex_t numeric)
+    {
+        EXPECT_NEAR(std::abs(analytic - numeric), 0.0, 1e-4 * std::abs(numeric) + 1e-12);
+    }
+
+    std::vector<SliceParameters> m_parameters{{0.0, {1e-7, 0.0}, 0.0},
+                                              {10.0, {6e-6, 1e-7}, 0.7},
+                                              {25.0, {2e-6, 2e-8}, 0.0},
+                                              {0.0, {4e-6, 1e-8}, 1.2}};
+};
+
+SpecularMatrixTest::~SpecularMatrixTest() = default;
+
+TEST_F(SpecularMatrixTest, Derivatives)
+{
+    for (double kz : {0.05, 0.2, 0.8, 2.0}) {
+        const auto slices = createSlices();
+        const auto derivatives = SpecularMatrix::ExecuteDerivatives(
+            slices, KzComputation::computeKzFromSLDs(slices, kz));
+        EXPECT_EQ(derivatives.R, reflection(kz));
+        ASSERT_EQ(derivatives.dR_dsld_imag.size(), m_parameters.size());
+
+        for (size_t i = 0; i < m_parameters.size(); ++i) {
+            auto& par = m_parameters[i];
+            expectNear(derivatives.dR_dthickness[i], numericDerivative(kz, par.thickness, 1e-4));
+            expectNear(derivatives.dR_dsld_real[i],
+                       numericDerivative(kz, par.sld, complex_t(1e-11, 0.0)));
+            expectNear(derivatives.dR_dsld_imag[i],
+                       numericDerivative(kz, par.sld, complex_t(0.0, 1e-11)));
+            if (par.sigma > 0.0)
+                expectNear(derivatives.dR_dsigma[i], numericDerivative(kz, par.sigma, 1e-4));
+            else
+                EXPECT_EQ(derivatives.dR_dsigma[i], 0.0);
+        }
+        // the thickness of the semi-infinite bottom layer is irrelevant
+        EXPECT_EQ(derivatives.dR_dthickness.back(), 0.0);
+    }
+
+    // materials not defined by SLD
+    std::vector<Slice> slices{Slice(0.0, HomogeneousMaterial("Air", 0.0, 0.0)),
+                              Slice(0.0, HomogeneousMaterial("Substrate", 6e-6, 2e-8))};
+    const auto derivatives = SpecularMatrix::ExecuteDerivatives(
+        slices, KzComputation::computeReducedKz(slices, kvector_t(1.0, 0.0, -0.05)));
+    EXPECT_EQ(derivatives.dR_dkz.size(), 2u);
+    EXPECT_TRUE(derivatives.dR_dsld_real.empty());
+}
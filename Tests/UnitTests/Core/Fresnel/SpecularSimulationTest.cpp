@@ -6,11 +6,15 @@
 #include "Histogram1D.h"
 #include "IMultiLayerBuilder.h"
 #include "Layer.h"
+#include "LayerRoughness.h"
 #include "MaterialFactoryFuncs.h"
 #include "MathConstants.h"
 #include "MultiLayer.h"
 #include "ParameterPattern.h"
+#include "ParameterPool.h"
+#include "Parameters.h"
 #include "QSpecScan.h"
+#include "RangedDistributions.h"
 #include "RealParameter.h"
 #include "SpecularSimulation.h"
 #include "Units.h"
@@ -260,3 +264,117 @@ TEST_F(SpecularSimulationTest, OutOfRangeAngles)
     EXPECT_EQ(0.0, (*data)[0]);
     EXPECT_NE(0.0, (*data)[1]);
 }
+
+TEST_F(SpecularSimulationTest, KzGrid)
+{
+    MultiLayer sample;
+    sample.addLayer(Layer(MaterialBySLD("ambience", 0.0, 0.0)));
+    sample.addLayer(Layer(MaterialBySLD("PartA", 4e-6, 1e-8), 30.0 * Units::nanometer));
+    sample.addLayer(Layer(MaterialBySLD("substrate", 2e-6, 0.0)));
+
+    QSpecScan scan(50, 0.05, 1.5);
+    scan.setAbsoluteQResolution(RangedDistributionGaussian(20, 2.0), 0.01);
+    SpecularSimulation sim;
+    sim.setScan(scan);
+    sim.setSample(sample);
+
+    sim.runSimulation();
+    const auto reference = sim.result();
+
+    sim.getOptions().setSpecularKzGrid(true, 1e-4);
+    sim.runSimulation();
+    const auto result = sim.result();
+
+    ASSERT_EQ(result.size(), reference.size());
+    for (size_t i = 0; i < result.size(); ++i)
+        EXPECT_NEAR(result[i], reference[i], 1e-3 * reference[i]);
+
+    EXPECT_THROW(sim.getOptions().setSpecularKzGrid(true, 0.0), std::runtime_error);
+}
+
+TEST_F(SpecularSimulationTest, KzGridMergesCloseValues)
+{
+    MultiLayer sample;
+    sample.addLayer(Layer(MaterialBySLD("ambience", 0.0, 0.0)));
+    sample.addLayer(Layer(MaterialBySLD("PartA", 4e-6, 1e-8), 30.0 * Units::nanometer));
+    sample.addLayer(Layer(MaterialBySLD("substrate", 2e-6, 0.0)));
+
+    // pairs of points closer than the merge tolerance, which share one grid node
+    std::vector<double> qs;
+    for (int i = 0; i < 40; ++i) {
+        const double q = 0.05 + 0.03 * i;
+        qs.push_back(q);
+        qs.push_back(q * (1.0 + 1e-9));
+    }
+    SpecularSimulation sim;
+    sim.setScan(QSpecScan(qs));
+    sim.setSample(sample);
+
+    sim.runSimulation();
+    const auto reference = sim.result();
+
+    sim.getOptions().setSpecularKzGrid(true, 1e-4);
+    sim.runSimulation();
+    const auto result = sim.result();
+
+    ASSERT_EQ(result.size(), reference.size());
+    for (size_t i = 0; i < result.size(); ++i)
+        EXPECT_NEAR(result[i], reference[i], 1e-3 * reference[i]);
+    for (size_t i = 0; i < result.size(); i += 2)
+        EXPECT_EQ(result[i], result[i + 1]);
+}
+
+TEST_F(SpecularSimulationTest, IntensityDerivatives)
+{
+    MultiLayer sample;
+    sample.addLayer(Layer(HomogeneousMaterial("ambience", 0.0, 0.0)));
+    sample.addLayerWithTopRoughness(Layer(HomogeneousMaterial("PartA", 5e-6, 1e-8), 30.0),
+                                    LayerRoughness(0.8, 0.3, 5.0));
+    sample.addLayerWithTopRoughness(Layer(HomogeneousMaterial("PartB", 12e-6, 1e-7), 10.0),
+                                    LayerRoughness(0.5, 0.3, 5.0));
+    sample.addLayerWithTopRoughness(Layer(HomogeneousMaterial("substrate", 7e-6, 0.0)),
+                                    LayerRoughness(1.2, 0.3, 5.0));
+
+    AngularSpecScan scan(1.54 * Units::angstrom, FixedBinAxis("axis", 50, 0.1 * Units::deg,
+                                                              2.0 * Units::deg));
+    scan.setRelativeAngularResolution(RangedDistributionGaussian(5, 2.0), 0.02);
+    SpecularSimulation sim;
+    sim.setScan(scan);
+    sim.setSample(sample);
+    sim.setBeamIntensity(1e6);
+
+    Fit::Parameters parameters;
+    parameters.add(Fit::Parameter("*/Layer1/Thickness", 30.0));
+    parameters.add(Fit::Parameter("*/Layer2/Thickness", 10.0));
+    parameters.add(Fit::Parameter("*/LayerInterface0/LayerBasicRoughness/Sigma", 0.8));
+    parameters.add(Fit::Parameter("*/LayerInterface2/LayerBasicRoughness/Sigma", 1.2));
+    const auto derivatives = sim.intensityDerivatives(parameters);
+    ASSERT_EQ(derivatives.size(), parameters.size());
+
+    // compare with central finite differences
+    std::unique_ptr<ParameterPool> pool(sim.createParameterTree());
+    auto intensities = [&sim, &pool](const std::string& name, double value) {
+        pool->setMatchedParametersValue(name, value);
+        sim.runSimulation();
+        return sim.result().data()->getRawDataVector();
+    };
+    const double step = 1e-4;
+    for (size_t i_par = 0; i_par < parameters.size(); ++i_par) {
+        const std::string name = parameters[i_par].name();
+        const double value = parameters[i_par].value();
+        const auto upper = intensities(name, value + step);
+        const auto lower = intensities(name, value - step);
+        intensities(name, value);
+        ASSERT_EQ(derivatives[i_par].size(), upper.size());
+        double scale = 0.0;
+        for (size_t i = 0; i < upper.size(); ++i)
+            scale = std::max(scale, std::abs(upper[i] - lower[i]) / (2.0 * step));
+        EXPECT_GT(scale, 0.0);
+        for (size_t i = 0; i < upper.size(); ++i)
+            EXPECT_NEAR(derivatives[i_par][i], (upper[i] - lower[i]) / (2.0 * step),
+                        1e-5 * scale);
+    }
+
+    parameters.add(Fit::Parameter("*/Beam/Wavelength", 1.54));
+    EXPECT_THROW(sim.intensityDerivatives(parameters), std::runtime_error);
+}
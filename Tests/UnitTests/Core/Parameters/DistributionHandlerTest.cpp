@@ -3,6 +3,7 @@
 #include "Distributions.h"
 #include "IParameterized.h"
 #include "ParameterPool.h"
+#include "RealParameter.h"
 #include <cmath>
 
 class DistributionHandlerTest : public ::testing::Test
@@ -35,3 +36,35 @@ TEST_F(DistributionHandlerTest, DistributionHandlerConstructor)
     EXPECT_EQ(distribution1.getNbrSamples(), size_t(2));
     EXPECT_EQ(distribution1.getSigmaFactor(), 1.0);
 }
+
+TEST_F(DistributionHandlerTest, BoundParameters)
+{
+    double value(1.5), other_value(0.5);
+    ParameterPool pool;
+    pool.addParameter(new RealParameter("/Sample/Value", &value));
+    pool.addParameter(new RealParameter("/Sample/OtherValue", &other_value));
+
+    DistributionHandler handler;
+    handler.addParameterDistribution(
+        ParameterDistribution("*/Value", DistributionGate(1.0, 2.0), 2, 1.0));
+    handler.addParameterDistribution(
+        ParameterDistribution("/Sample/OtherValue", DistributionGate(0.0, 1.0), 3, 1.0));
+    const auto parameters = handler.boundParameters(pool);
+    ASSERT_EQ(parameters.size(), 2u);
+    EXPECT_EQ(parameters[0], pool.parameter("/Sample/Value"));
+    EXPECT_EQ(parameters[1], pool.parameter("/Sample/OtherValue"));
+
+    // the same values as by name
+    double weight = handler.setParameterValues(parameters, 5);
+    EXPECT_DOUBLE_EQ(weight, 1.0 / 6.0);
+    EXPECT_EQ(value, 2.0);
+    EXPECT_EQ(other_value, 1.0);
+    weight = handler.setParameterValues(&pool, 1);
+    EXPECT_DOUBLE_EQ(weight, 1.0 / 6.0);
+    EXPECT_EQ(value, 1.0);
+    EXPECT_EQ(other_value, 0.5);
+
+    handler.addParameterDistribution(
+        ParameterDistribution("*Value", DistributionGate(0.0, 1.0), 3, 1.0));
+    EXPECT_THROW(handler.boundParameters(pool), std::runtime_error);
+}
@@ -68,6 +68,10 @@ TEST_F(ParameterPoolTest, matchedParameters)
     // unique match
     EXPECT_EQ(rp2, pool.getUniqueMatch("*xxx*"));
     EXPECT_THROW(pool.getUniqueMatch("*par*"), Exceptions::RuntimeErrorException);
+
+    // patterns without wildcards match the parameter of the same name
+    EXPECT_EQ(rp3, pool.getUniqueMatch("par3"));
+    EXPECT_THROW(pool.getMatchedParameters("par"), Exceptions::RuntimeErrorException);
 }
 
 TEST_F(ParameterPoolTest, setValue)
@@ -152,4 +156,8 @@ TEST_F(ParameterPoolTest, removeParameter)
     pool.removeParameter("par1");
     EXPECT_EQ(pool.size(), 1u);
     EXPECT_TRUE(pool.parameter("par1") == nullptr);
+
+    // the name can be registered again
+    pool.addParameter(new RealParameter("par1", &par1));
+    EXPECT_EQ(pool.getUniqueMatch("par1")->value(), 1.0);
 }
@@ -0,0 +1,101 @@
+#include "google_test.h"
+#include "BornAgainNamespace.h"
+#include "Distributions.h"
+#include "FormFactorCylinder.h"
+#include "InterferenceFunctionRadialParaCrystal.h"
+#include "LayerRoughness.h"
+#include "ParameterDistribution.h"
+#include "ParameterPattern.h"
+#include "ParameterSample.h"
+#include "Particle.h"
+#include "SimulationTestHelper.h"
+
+class SampleReuseTest : public ::testing::Test
+{
+protected:
+    ~SampleReuseTest();
+
+    std::unique_ptr<GISASSimulation> createSimulation() const
+    {
+        ParticleLayout layout;
+        layout.addParticle(
+            Particle(SimulationTestHelper::particleMaterial(), FormFactorCylinder(5.0, 5.0)));
+        InterferenceFunctionRadialParaCrystal iff(20.0, 1e3);
+        iff.setProbabilityDistribution(FTDistribution1DGauss(7.0));
+        layout.setInterferenceFunction(iff);
+        Layer air_layer(HomogeneousMaterial("Air", 0.0, 0.0));
+        air_layer.addLayout(layout);
+        MultiLayer multi_layer;
+        multi_layer.addLayer(air_layer);
+        multi_layer.addLayerWithTopRoughness(Layer(SimulationTestHelper::substrateMaterial()),
+                                             LayerRoughness(0.5, 0.3, 5.0));
+
+        auto result = SimulationTestHelper::createSimulation(multi_layer, 6, 5);
+        result->getOptions().setNumberOfThreads(2);
+        return result;
+    }
+
+    //! Returns the weighted sum of simulations without distributions, for all combinations of
+    //! samples of the given distributions of two parameters
+    std::vector<double> manualAverage(const ParameterDistribution& distribution1,
+                                      const ParameterDistribution& distribution2) const
+    {
+        auto simulation = createSimulation();
+        std::vector<double> result;
+        for (const auto& sample1 : distribution1.generateSamples()) {
+            for (const auto& sample2 : distribution2.generateSamples()) {
+                simulation->setParameterValue(distribution1.getMainParameterName(),
+                                              sample1.value);
+                simulation->setParameterValue(distribution2.getMainParameterName(),
+                                              sample2.value);
+                simulation->runSimulation();
+                const auto values = simulation->result().data()->getRawDataVector();
+                result.resize(values.size(), 0.0);
+                for (size_t i = 0; i < values.size(); ++i)
+                    result[i] += sample1.weight * sample2.weight * values[i];
+            }
+        }
+        return result;
+    }
+
+    void compare(const ParameterDistribution& distribution1,
+                 const ParameterDistribution& distribution2) const
+    {
+        auto simulation = createSimulation();
+        simulation->addParameterDistribution(distribution1);
+        simulation->addParameterDistribution(distribution2);
+        simulation->runSimulation();
+        const auto result = simulation->result().data()->getRawDataVector();
+
+        SimulationTestHelper::expectNear(result, manualAverage(distribution1, distribution2),
+                                         1e-12);
+    }
+
+    static std::string beamParameter(const std::string& name)
+    {
+        return ParameterPattern().beginsWith("*").add(BornAgain::BeamType).add(name).toStdString();
+    }
+};
+
+SampleReuseTest::~SampleReuseTest() = default;
+
+//! The processed sample is kept for all samples of the beam distributions
+TEST_F(SampleReuseTest, BeamDistributions)
+{
+    ParameterDistribution wavelength(beamParameter(BornAgain::Wavelength),
+                                     DistributionGaussian(0.1, 0.01), 3, 2.0);
+    ParameterDistribution inclination(beamParameter(BornAgain::Inclination),
+                                      DistributionGaussian(0.2 * Units::deg, 0.02 * Units::deg),
+                                      3, 2.0);
+    compare(wavelength, inclination);
+}
+
+//! The processed sample is rebuilt for every sample of a distribution of a sample parameter
+TEST_F(SampleReuseTest, SampleDistribution)
+{
+    ParameterDistribution inclination(beamParameter(BornAgain::Inclination),
+                                      DistributionGaussian(0.2 * Units::deg, 0.02 * Units::deg),
+                                      2, 2.0);
+    ParameterDistribution radius("*/Cylinder/Radius", DistributionGaussian(5.0, 0.5), 3, 2.0);
+    compare(inclination, radius);
+}
@@ -0,0 +1,60 @@
+#include "google_test.h"
+#include "FormFactorCylinder.h"
+#include "Particle.h"
+#include "ParticleComposition.h"
+#include "Rotations.h"
+#include "SimulationTestHelper.h"
+
+class AmplitudeReuseTest : public ::testing::Test
+{
+protected:
+    ~AmplitudeReuseTest();
+
+    //! Returns a cluster of identical cylinders, two of which differ only in lateral position.
+    //! The cluster crosses the interface between the top two layers. If distinct is true,
+    //! the cylinders get different identity rotations, such that they share no amplitudes.
+    std::unique_ptr<MultiLayer> createSample(bool distinct) const
+    {
+        Particle cylinder(SimulationTestHelper::particleMaterial(), FormFactorCylinder(3.0, 4.0));
+        std::unique_ptr<Particle> P_cylinder_x(cylinder.clone());
+        std::unique_ptr<Particle> P_cylinder_z(cylinder.clone());
+        if (distinct) {
+            P_cylinder_x->setRotation(RotationX(0.0));
+            P_cylinder_z->setRotation(RotationZ(0.0));
+        }
+
+        ParticleComposition cluster;
+        cluster.addParticle(cylinder, kvector_t(0.0, 0.0, 0.0));
+        cluster.addParticle(*P_cylinder_x, kvector_t(10.0, 3.0, 0.0));
+        cluster.addParticle(*P_cylinder_z, kvector_t(-4.0, 8.0, 2.0));
+        cluster.setPosition(kvector_t(0.0, 0.0, -3.0));
+
+        ParticleLayout layout;
+        layout.addParticle(cluster);
+        layout.addParticle(cylinder, 0.5, kvector_t(5.0, 0.0, 0.0));
+
+        Layer air_layer(HomogeneousMaterial("Air", 0.0, 0.0));
+        air_layer.addLayout(layout);
+        std::unique_ptr<MultiLayer> result(new MultiLayer);
+        result->addLayer(air_layer);
+        result->addLayer(Layer(HomogeneousMaterial("Film", 2e-6, 1e-8), 20.0));
+        result->addLayer(Layer(SimulationTestHelper::substrateMaterial()));
+        return result;
+    }
+
+    SimulationResult simulate(bool distinct) const
+    {
+        auto P_simulation = SimulationTestHelper::createSimulation(*createSample(distinct));
+        P_simulation->runSimulation();
+        return P_simulation->result();
+    }
+};
+
+AmplitudeReuseTest::~AmplitudeReuseTest() = default;
+
+TEST_F(AmplitudeReuseTest, SharedAmplitudes)
+{
+    const auto reference = simulate(true);
+    SimulationTestHelper::expectPositive(reference);
+    SimulationTestHelper::expectNear(simulate(false), reference, 1e-10);
+}
@@ -0,0 +1,80 @@
+#include "google_test.h"
+#include "Distributions.h"
+#include "FTDistributions1D.h"
+#include "FormFactorCylinder.h"
+#include "FormFactorFullSphere.h"
+#include "InterferenceFunctionRadialParaCrystal.h"
+#include "Particle.h"
+#include "ParticleDistribution.h"
+#include "SimulationTestHelper.h"
+#include <algorithm>
+
+class DistributionInterpolationTest : public ::testing::Test
+{
+protected:
+    ~DistributionInterpolationTest();
+
+    //! Returns a layout with a polydisperse and a monodisperse particle type
+    std::unique_ptr<ParticleLayout> createLayout() const
+    {
+        Material particle_material = SimulationTestHelper::particleMaterial();
+        Particle cylinder(particle_material, FormFactorCylinder(5.0, 5.0));
+        DistributionGaussian gauss(5.0, 1.0);
+        ParameterDistribution par_distr("*/Radius", gauss, 40, 2.0);
+        par_distr.linkParameter("*/Height");
+
+        std::unique_ptr<ParticleLayout> result(new ParticleLayout);
+        result->addParticle(ParticleDistribution(cylinder, par_distr), 0.8);
+        result->addParticle(Particle(particle_material, FormFactorFullSphere(3.0)), 0.2);
+        return result;
+    }
+
+    //! Checks the interpolated against the exact intensities, relative to the maximal intensity
+    void compare(const ParticleLayout& layout) const
+    {
+        auto P_simulation =
+            SimulationTestHelper::createSimulation(*SimulationTestHelper::createSample(layout),
+                                                   20, 20);
+        P_simulation->runSimulation();
+        const auto reference = P_simulation->result();
+        double max_intensity = 0.0;
+        for (size_t i = 0; i < reference.size(); ++i)
+            max_intensity = std::max(max_intensity, reference[i]);
+
+        P_simulation->getOptions().setParticleDistributionInterpolation();
+        P_simulation->runSimulation();
+        SimulationTestHelper::expectNear(P_simulation->result(), reference, 1e-3,
+                                         1e-6 * max_intensity);
+    }
+};
+
+DistributionInterpolationTest::~DistributionInterpolationTest() = default;
+
+TEST_F(DistributionInterpolationTest, GroupSizes)
+{
+    const auto layout = createLayout();
+    const auto groups = layout->particleGroups();
+    ASSERT_EQ(groups.size(), 2u);
+    EXPECT_EQ(groups[0].size(), 40u);
+    EXPECT_EQ(groups[1].size(), 1u);
+    EXPECT_EQ(layout->particles().size(), 41u);
+
+    SimulationOptions options;
+    EXPECT_FALSE(options.useParticleDistributionInterpolation());
+    EXPECT_THROW(options.setParticleDistributionInterpolation(true, 0.0), std::runtime_error);
+}
+
+TEST_F(DistributionInterpolationTest, Decoupling)
+{
+    compare(*createLayout());
+}
+
+TEST_F(DistributionInterpolationTest, SizeSpacingCoupling)
+{
+    auto layout = createLayout();
+    InterferenceFunctionRadialParaCrystal interference(15.0, 1e3);
+    interference.setKappa(1.0);
+    interference.setProbabilityDistribution(FTDistribution1DGauss(3.0));
+    layout->setInterferenceFunction(interference);
+    compare(*layout);
+}
@@ -0,0 +1,86 @@
+#include "google_test.h"
+#include "FormFactorBox.h"
+#include "FormFactorDWBA.h"
+#include "FormFactorDecoratorMaterial.h"
+#include "FormFactorDecoratorRotation.h"
+#include "MaterialFactoryFuncs.h"
+#include "Rotations.h"
+#include "ScalarRTCoefficients.h"
+#include "WavevectorInfo.h"
+#include <memory>
+
+class FormFactorDecoratorTest : public ::testing::Test
+{
+protected:
+    ~FormFactorDecoratorTest();
+
+    static ScalarRTCoefficients coefficients(complex_t kz, complex_t t, complex_t r)
+    {
+        ScalarRTCoefficients result;
+        result.kz = kz;
+        result.t_r << t, r;
+        return result;
+    }
+
+    const WavevectorInfo m_wavevectors{cvector_t(0.2, 0.05, -0.1), cvector_t(0.3, -0.3, 0.4),
+                                       0.1};
+};
+
+FormFactorDecoratorTest::~FormFactorDecoratorTest() = default;
+
+TEST_F(FormFactorDecoratorTest, Rotation)
+{
+    FormFactorBox box(4.0, 3.0, 2.0);
+    RotationEuler rotation(0.3, 0.5, 0.7);
+    FormFactorDecoratorRotation rotated(box, rotation);
+
+    const Transform3D inverse = std::unique_ptr<IRotation>(rotation.createInverse())
+                                    ->getTransform3D();
+    const WavevectorInfo expected_wavevectors(inverse.transformed(m_wavevectors.getKi()),
+                                              inverse.transformed(m_wavevectors.getKf()),
+                                              m_wavevectors.getWavelength());
+    const complex_t expected = box.evaluate(expected_wavevectors);
+    const complex_t result = rotated.evaluate(m_wavevectors);
+    EXPECT_NEAR(result.real(), expected.real(), 1e-12 * std::abs(expected));
+    EXPECT_NEAR(result.imag(), expected.imag(), 1e-12 * std::abs(expected));
+
+    const complex_t cloned = std::unique_ptr<IFormFactor>(rotated.clone())->evaluate(m_wavevectors);
+    EXPECT_EQ(result, cloned);
+}
+
+TEST_F(FormFactorDecoratorTest, MaterialInDWBA)
+{
+    FormFactorDecoratorMaterial material_ff(FormFactorBox(4.0, 3.0, 2.0));
+    material_ff.setMaterial(HomogeneousMaterial("Particle", 6e-4, 2e-8));
+    FormFactorDWBA dwba(material_ff);
+    dwba.setAmbientMaterial(HomogeneousMaterial("Film", 2e-6, 1e-8));
+    material_ff.setAmbientMaterial(HomogeneousMaterial("Film", 2e-6, 1e-8));
+
+    const ScalarRTCoefficients in_coeffs
+        = coefficients(complex_t(-0.1, 0.001), complex_t(0.9, 0.1), complex_t(0.2, -0.3));
+    const ScalarRTCoefficients out_coeffs
+        = coefficients(complex_t(0.4, 0.002), complex_t(1.1, -0.2), complex_t(0.1, 0.05));
+
+    // explicit sum of the four DWBA terms, each with its own material factor
+    const double wavelength = m_wavevectors.getWavelength();
+    const cvector_t k_i_T(m_wavevectors.getKi().x(), m_wavevectors.getKi().y(), -in_coeffs.kz);
+    const cvector_t k_i_R(k_i_T.x(), k_i_T.y(), in_coeffs.kz);
+    const cvector_t k_f_T(m_wavevectors.getKf().x(), m_wavevectors.getKf().y(), out_coeffs.kz);
+    const cvector_t k_f_R(k_f_T.x(), k_f_T.y(), -out_coeffs.kz);
+    const complex_t expected
+        = in_coeffs.getScalarT() * material_ff.evaluate({k_i_T, k_f_T, wavelength})
+              * out_coeffs.getScalarT()
+          + in_coeffs.getScalarR() * material_ff.evaluate({k_i_R, k_f_T, wavelength})
+              * out_coeffs.getScalarT()
+          + in_coeffs.getScalarT() * material_ff.evaluate({k_i_T, k_f_R, wavelength})
+              * out_coeffs.getScalarR()
+          + in_coeffs.getScalarR() * material_ff.evaluate({k_i_R, k_f_R, wavelength})
+              * out_coeffs.getScalarR();
+
+    const complex_t result = dwba.evaluateInLayer(m_wavevectors, in_coeffs, out_coeffs);
+    EXPECT_NEAR(result.real(), expected.real(), 1e-12 * std::abs(expected));
+    EXPECT_NEAR(result.imag(), expected.imag(), 1e-12 * std::abs(expected));
+
+    const std::unique_ptr<FormFactorDWBA> P_clone(dwba.clone());
+    EXPECT_EQ(result, P_clone->evaluateInLayer(m_wavevectors, in_coeffs, out_coeffs));
+}
@@ -0,0 +1,54 @@
+#include "google_test.h"
+#include "FTDecayFunctions.h"
+#include "InterferenceFunction2DLattice.h"
+#include <memory>
+#include <vector>
+
+class InterferenceFunction2DLatticeTest : public ::testing::Test
+{
+protected:
+    ~InterferenceFunction2DLatticeTest();
+
+    //! Checks the interference function at a few wavevectors against reference values of the
+    //! point-by-point evaluation through IFTDecayFunction2D::evaluate
+    void check(const InterferenceFunction2DLattice& iff, const std::vector<double>& expected)
+    {
+        const std::vector<kvector_t> qs{
+            {0.05, 0.02, 0.0}, {0.31, -0.17, 0.0}, {-0.6, 0.45, 0.0}, {0.6, 0.19, 0.0}};
+        std::unique_ptr<InterferenceFunction2DLattice> P_clone(iff.clone());
+        for (size_t i = 0; i < qs.size(); ++i) {
+            EXPECT_NEAR(iff.evaluate(qs[i]), expected[i], 1e-13 * expected[i]);
+            EXPECT_EQ(iff.evaluate(qs[i]), P_clone->evaluate(qs[i]));
+        }
+    }
+};
+
+InterferenceFunction2DLatticeTest::~InterferenceFunction2DLatticeTest() = default;
+
+TEST_F(InterferenceFunction2DLatticeTest, SquareLattice)
+{
+    std::unique_ptr<InterferenceFunction2DLattice> P_iff(
+        InterferenceFunction2DLattice::createSquare(10.0, 0.3));
+    P_iff->setDecayFunction(FTDecayFunction2DCauchy(100.0, 50.0, 0.2));
+    check(*P_iff, {1.97587206539601, 0.056068360352598656, 0.084182828608846183,
+                   282.9338960193578});
+    P_iff->setDecayFunction(FTDecayFunction2DGauss(80.0, 120.0, -0.4));
+    check(*P_iff, {0.0047189335940764909, 0.0, 0.0, 528.11629615241361});
+    P_iff->setDecayFunction(FTDecayFunction2DVoigt(60.0, 90.0, 0.3, 0.7));
+    check(*P_iff, {3.8478175014762388, 0.041579875074682859, 0.098338990812515514,
+                   303.82139074436344});
+}
+
+TEST_F(InterferenceFunction2DLatticeTest, HexagonalLattice)
+{
+    std::unique_ptr<InterferenceFunction2DLattice> P_iff(
+        InterferenceFunction2DLattice::createHexagonal(15.0, 0.0));
+    P_iff->setDecayFunction(FTDecayFunction2DCauchy(100.0, 50.0, 0.2));
+    check(*P_iff, {1.0610495589368589, 0.18808653949783505, 0.077388039232880179,
+                   0.080332161248676037});
+    P_iff->setDecayFunction(FTDecayFunction2DGauss(80.0, 120.0, -0.4));
+    check(*P_iff, {9.2516818675614232e-05, 0.0, 0.0, 0.0});
+    P_iff->setDecayFunction(FTDecayFunction2DVoigt(60.0, 90.0, 0.3, 0.7));
+    check(*P_iff, {2.861152949389862, 0.11015396185734205, 0.057865244715425312,
+                   0.067464958178198753});
+}
@@ -0,0 +1,53 @@
+#include "google_test.h"
+#include "InterferenceFunctionFinite2DLattice.h"
+#include "MathFunctions.h"
+#include <cmath>
+#include <memory>
+#include <vector>
+
+class InterferenceFunctionFinite2DLatticeTest : public ::testing::Test
+{
+protected:
+    ~InterferenceFunctionFinite2DLatticeTest();
+};
+
+InterferenceFunctionFinite2DLatticeTest::~InterferenceFunctionFinite2DLatticeTest() = default;
+
+TEST_F(InterferenceFunctionFinite2DLatticeTest, IntegrationOverXi)
+{
+    std::unique_ptr<InterferenceFunctionFinite2DLattice> P_iff(
+        InterferenceFunctionFinite2DLattice::createHexagonal(10.0, 0.0, 20, 30));
+    P_iff->setIntegrationOverXi(true);
+
+    // reference values from adaptive integration with relative tolerance 1e-8
+    const std::vector<kvector_t> qs{
+        {0.05, 0.02, 0.0}, {0.31, -0.17, 0.0}, {0.6283185307179586, 0.0, 0.0}, {1.2, 0.7, 0.0}};
+    const std::vector<double> expected{4.1044149243863526, 0.025537139515003471,
+                                       0.23040810000574108, 0.2326823337205981};
+    for (size_t i = 0; i < qs.size(); ++i)
+        EXPECT_NEAR(P_iff->evaluate(qs[i]), expected[i], 1e-8 * expected[i]);
+}
+
+TEST_F(InterferenceFunctionFinite2DLatticeTest, IntegrationOverXiLargeLattice)
+{
+    const double a = 10.0;
+    const unsigned N_1 = 100, N_2 = 80;
+    std::unique_ptr<InterferenceFunctionFinite2DLattice> P_iff(
+        InterferenceFunctionFinite2DLattice::createHexagonal(a, 0.0, N_1, N_2));
+    P_iff->setIntegrationOverXi(true);
+
+    // The average of the Fejer sums over xi is a sum of J0(|q|*|m*a + n*b|)
+    const double cos_alpha = std::cos(P_iff->lattice().latticeAngle());
+    for (const kvector_t q : {kvector_t(0.02, 0.01, 0.0), kvector_t(0.3, -0.4, 0.0),
+                              kvector_t(0.9, 0.6, 0.0)}) {
+        double expected = 0.0;
+        for (int m = 1 - static_cast<int>(N_1); m < static_cast<int>(N_1); ++m)
+            for (int n = 1 - static_cast<int>(N_2); n < static_cast<int>(N_2); ++n) {
+                const double distance = a * std::sqrt(m * m + n * n + 2.0 * m * n * cos_alpha);
+                expected += (N_1 - std::abs(m)) * (N_2 - std::abs(n))
+                            * MathFunctions::Bessel_J0(q.mag() * distance);
+            }
+        expected /= N_1 * N_2;
+        EXPECT_NEAR(P_iff->evaluate(q), expected, 1e-10 * expected);
+    }
+}
@@ -0,0 +1,63 @@
+#include "google_test.h"
+#include "CounterRegistry.h"
+#include <thread>
+#include <vector>
+
+class CounterRegistryTest : public ::testing::Test
+{
+protected:
+    ~CounterRegistryTest();
+
+    //! The second counter is combined by the maximum
+    typedef CounterRegistry<2> Registry;
+};
+
+CounterRegistryTest::~CounterRegistryTest() = default;
+
+TEST_F(CounterRegistryTest, CombineRecords)
+{
+    Registry registry{1};
+    {
+        Registry::Record first(registry);
+        first.add(0, 3);
+        first.raise(1, 5);
+        {
+            Registry::Record second(registry);
+            second.add(0, 4);
+            second.raise(1, 2);
+            EXPECT_EQ(registry.totals(), (Registry::Values{7, 5}));
+        }
+        // the counts of a destroyed record are kept
+        first.raise(1, 1);
+        EXPECT_EQ(registry.totals(), (Registry::Values{7, 5}));
+
+        registry.reset();
+        EXPECT_EQ(registry.totals(), (Registry::Values{0, 0}));
+        first.add(0, 1);
+        first.raise(1, 1);
+        EXPECT_EQ(registry.totals(), (Registry::Values{1, 1}));
+    }
+    EXPECT_EQ(registry.totals(), (Registry::Values{1, 1}));
+}
+
+TEST_F(CounterRegistryTest, ThreadRecords)
+{
+    Registry registry{1};
+    const int n_threads = 8;
+    const int n_counts = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t) {
+        threads.emplace_back([&registry, t]() {
+            Registry::Record record(registry);
+            for (int i = 0; i < n_counts; ++i) {
+                record.add(0, 1);
+                record.raise(1, static_cast<uint64_t>(t * n_counts + i));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(registry.totals(),
+              (Registry::Values{n_threads * n_counts, n_threads * n_counts - 1}));
+}
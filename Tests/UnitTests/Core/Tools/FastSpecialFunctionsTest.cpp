@@ -0,0 +1,84 @@
+#include "google_test.h"
+#include "FastSpecialFunctions.h"
+#include <gsl/gsl_sf_bessel.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+class FastSpecialFunctionsTest : public ::testing::Test
+{
+protected:
+    ~FastSpecialFunctionsTest();
+
+    //! Returns arguments of both signs, densely covering the range of the tabulated
+    //! expansions and sparsely the asymptotic range
+    static std::vector<double> arguments()
+    {
+        std::vector<double> result;
+        for (int i = 0; i <= 2000; ++i)
+            result.push_back(0.0061 * i);
+        for (double x = 12.0; x < 1e6; x *= 1.013)
+            result.push_back(x);
+        const size_t n_positive = result.size();
+        for (size_t i = 1; i < n_positive; ++i)
+            result.push_back(-result[i]);
+        return result;
+    }
+
+    static double gslJ1c(double x) { return x == 0.0 ? 0.5 : gsl_sf_bessel_J1(x) / x; }
+
+    //! Returns the maximal absolute deviation from GSL on [x_min, x_max]
+    template <class F, class G>
+    static double maxError(F f, G reference, double x_min, double x_max)
+    {
+        const int n_points = 500;
+        double result = 0.0;
+        for (int i = 0; i <= n_points; ++i) {
+            const double x = x_min + (x_max - x_min) * i / n_points;
+            result = std::max(result, std::abs(f(x) - reference(x)));
+        }
+        return result;
+    }
+
+    //! Returns the maximal absolute deviation from GSL over arguments()
+    template <class F, class G> static double maxError(F f, G reference)
+    {
+        double result = 0.0;
+        for (double x : arguments())
+            result = std::max(result, std::abs(f(x) - reference(x)));
+        return result;
+    }
+};
+
+FastSpecialFunctionsTest::~FastSpecialFunctionsTest() = default;
+
+TEST_F(FastSpecialFunctionsTest, AccuracyAgainstGSL)
+{
+    using namespace FastSpecialFunctions;
+    EXPECT_LT(maxError(Bessel_J0, gsl_sf_bessel_J0), 1e-15);
+    EXPECT_LT(maxError(Bessel_J1, gsl_sf_bessel_J1), 1e-15);
+    EXPECT_LT(maxError(Bessel_J1c, gslJ1c), 1e-15);
+
+    EXPECT_NEAR(Bessel_J0(0.0), 1.0, 1e-15);
+    EXPECT_EQ(Bessel_J1(0.0), 0.0);
+    EXPECT_NEAR(Bessel_J1c(0.0), 0.5, 1e-15);
+}
+
+//! Checks every tabulated expansion on its own interval, including both ends
+TEST_F(FastSpecialFunctionsTest, Intervals)
+{
+    using namespace FastSpecialFunctions;
+    for (int i = 0; i < 16; ++i) {
+        const double x_min = 0.5 * i;
+        const double x_max = 0.5 * (i + 1);
+        EXPECT_LT(maxError(Bessel_J0, gsl_sf_bessel_J0, x_min, x_max), 1e-15) << "interval " << i;
+        EXPECT_LT(maxError(Bessel_J1, gsl_sf_bessel_J1, x_min, x_max), 1e-15) << "interval " << i;
+        EXPECT_LT(maxError(Bessel_J1c, gslJ1c, x_min, x_max), 1e-15) << "interval " << i;
+    }
+    for (double x_min = 8.0; x_min < 1e4; x_min *= 2.0) {
+        EXPECT_LT(maxError(Bessel_J0, gsl_sf_bessel_J0, x_min, 2.0 * x_min), 1e-15)
+            << "from " << x_min;
+        EXPECT_LT(maxError(Bessel_J1, gsl_sf_bessel_J1, x_min, 2.0 * x_min), 1e-15)
+            << "from " << x_min;
+    }
+}
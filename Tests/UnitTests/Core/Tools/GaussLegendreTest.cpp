@@ -0,0 +1,39 @@
+#include "google_test.h"
+#include "Complex.h"
+#include "GaussLegendre.h"
+
+class GaussLegendreTest : public ::testing::Test
+{
+protected:
+    ~GaussLegendreTest();
+};
+
+GaussLegendreTest::~GaussLegendreTest() = default;
+
+TEST_F(GaussLegendreTest, NumberOfPanels)
+{
+    EXPECT_EQ(GaussLegendre::numberOfPanels(0.0), 1u);
+    EXPECT_EQ(GaussLegendre::numberOfPanels(0.5 * GaussLegendre::max_phase_per_panel), 1u);
+    EXPECT_EQ(GaussLegendre::numberOfPanels(-2.5 * GaussLegendre::max_phase_per_panel), 3u);
+}
+
+TEST_F(GaussLegendreTest, Polynomial)
+{
+    // the 16-point rule is exact for polynomials up to degree 31
+    auto f = [](double x) { return std::pow(x, 31) + 3.0 * x * x; };
+    EXPECT_NEAR(GaussLegendre::integrate(f, 0.0, 1.0, 0.0), 1.0 / 32.0 + 1.0, 1e-14);
+    EXPECT_NEAR(GaussLegendre::integrate(f, -1.0, 1.0, 0.0), 2.0, 1e-14);
+}
+
+TEST_F(GaussLegendreTest, Oscillation)
+{
+    const double a = -1.0, b = 4.0;
+    for (double q : {0.1, 3.0, 50.0, 1000.0}) {
+        for (complex_t qc : {complex_t(q, 0.0), complex_t(q, 0.2)}) {
+            auto f = [qc](double z) { return exp_I(qc * z); };
+            const complex_t expected = (exp_I(qc * b) - exp_I(qc * a)) / (complex_t(0.0, 1.0) * qc);
+            const complex_t result = GaussLegendre::integrate(f, a, b, std::abs(qc) * (b - a));
+            EXPECT_NEAR(std::abs(result - expected), 0.0, 1e-12 * (b - a));
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include "google_test.h"
+#include "FTDistributions2D.h"
+#include "IntegratorReal.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+class IntegratorWorkspaceTest : public ::testing::Test
+{
+protected:
+    ~IntegratorWorkspaceTest();
+};
+
+IntegratorWorkspaceTest::~IntegratorWorkspaceTest() = default;
+
+TEST_F(IntegratorWorkspaceTest, Reuse)
+{
+    gsl_integration_workspace* p_workspace;
+    {
+        IntegratorWorkspace workspace;
+        p_workspace = workspace.get();
+        IntegratorWorkspace nested_workspace;
+        EXPECT_NE(p_workspace, nested_workspace.get());
+    }
+    IntegratorWorkspace workspace;
+    EXPECT_TRUE(workspace.get() != nullptr);
+
+    gsl_integration_workspace* p_other_thread_workspace = nullptr;
+    std::thread([&] { p_other_thread_workspace = IntegratorWorkspace().get(); }).join();
+    EXPECT_NE(p_workspace, p_other_thread_workspace);
+}
+
+TEST_F(IntegratorWorkspaceTest, NestedIntegration)
+{
+    // integral of x*y over the triangle 0 < y < x < 1
+    const double result = integrate_real(
+        [](double x) { return integrate_real([x](double y) { return x * y; }, 0.0, x); }, 0.0,
+        1.0);
+    EXPECT_NEAR(result, 0.125, 1e-12);
+}
+
+TEST_F(IntegratorWorkspaceTest, Counters)
+{
+    auto sine_integral = [] {
+        return integrate_real([](double x) { return std::sin(x); }, 0.0, 1.0);
+    };
+
+    IntegrationCounters::reset();
+    EXPECT_EQ(IntegrationCounters::counts().integrations, 0u);
+    EXPECT_NEAR(integrate_real([](double x) { return x * x; }, 0.0, 1.0), 1.0 / 3.0, 1e-14);
+    const size_t n_polynomial = IntegrationCounters::counts().evaluations;
+    EXPECT_GT(n_polynomial, 0u);
+
+    IntegrationCounters::reset();
+    EXPECT_NEAR(sine_integral(), 1.0 - std::cos(1.0), 1e-14);
+    const size_t n_sine = IntegrationCounters::counts().evaluations;
+    EXPECT_GT(n_sine, 0u);
+
+    // the same integrations, counted concurrently
+    IntegrationCounters::reset();
+    integrate_real([](double x) { return x * x; }, 0.0, 1.0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&] {
+            for (int j = 0; j < 10; ++j)
+                sine_integral();
+        });
+    for (auto& thread : threads)
+        thread.join();
+    const auto counts = IntegrationCounters::counts();
+    EXPECT_EQ(counts.integrations, 41u);
+    EXPECT_EQ(counts.evaluations, n_polynomial + 40 * n_sine);
+    EXPECT_EQ(counts.max_evaluations, std::max(n_polynomial, n_sine));
+}
+
+TEST_F(IntegratorWorkspaceTest, ConeDistribution)
+{
+    // FT of the cone distribution, 6*(J1(q)/q - int_0^q u^2 J0(u) du / q^3), evaluated at q = 3
+    // from the power series of the Bessel functions
+    FTDistribution2DCone cone(1.0, 1.0);
+    IntegrationCounters::reset();
+    EXPECT_NEAR(cone.evaluate(3.0, 0.0), 0.48171624815903673, 1e-14);
+    EXPECT_EQ(IntegrationCounters::counts().integrations, 1u);
+}
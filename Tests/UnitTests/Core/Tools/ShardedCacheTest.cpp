@@ -0,0 +1,71 @@
+#include "google_test.h"
+#include "ShardedCache.h"
+#include <functional>
+#include <thread>
+#include <vector>
+
+class ShardedCacheTest : public ::testing::Test
+{
+protected:
+    ~ShardedCacheTest();
+
+    typedef ShardedCache<int, std::vector<int>, std::hash<int>> Cache;
+};
+
+ShardedCacheTest::~ShardedCacheTest() = default;
+
+TEST_F(ShardedCacheTest, FindAndInsert)
+{
+    Cache cache;
+    int found = -1;
+    auto pick = [&found](const std::vector<int>& values) { found = values[1]; };
+
+    EXPECT_FALSE(cache.find(7, pick));
+    EXPECT_EQ(found, -1);
+
+    cache.insert(7, {1, 2, 3}, pick);
+    EXPECT_EQ(found, 2);
+    EXPECT_EQ(cache.size(), 1u);
+
+    // an existing entry is kept
+    cache.insert(7, {4, 5, 6}, pick);
+    EXPECT_EQ(found, 2);
+    EXPECT_EQ(cache.size(), 1u);
+
+    found = -1;
+    EXPECT_TRUE(cache.find(7, pick));
+    EXPECT_EQ(found, 2);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_FALSE(cache.find(7, pick));
+}
+
+TEST_F(ShardedCacheTest, ConcurrentAccess)
+{
+    Cache cache;
+    const int n_keys = 2000;
+    const int n_threads = 8;
+    std::vector<int> n_wrong(n_threads, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t) {
+        threads.emplace_back([&cache, &n_wrong, t]() {
+            // all threads fill and read the same keys, in different orders
+            for (int i = 0; i < n_keys; ++i) {
+                const int key = (i * (2 * t + 1)) % n_keys;
+                int value = -1;
+                auto pick = [&value](const std::vector<int>& values) { value = values[0]; };
+                if (!cache.find(key, pick))
+                    cache.insert(key, {3 * key}, pick);
+                if (value != 3 * key)
+                    ++n_wrong[t];
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int t = 0; t < n_threads; ++t)
+        EXPECT_EQ(n_wrong[t], 0);
+    EXPECT_EQ(cache.size(), static_cast<size_t>(n_keys));
+}
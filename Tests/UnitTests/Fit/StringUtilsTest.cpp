@@ -21,3 +21,25 @@ TEST_F(StringUtilsTest, toLower)
     std::string target("QyQz");
     EXPECT_EQ(StringUtils::to_lower(target), std::string("qyqz"));
 }
+
+TEST_F(StringUtilsTest, matchesPattern)
+{
+    const std::string name("/GISASSimulation/MultiLayer/Layer0/ParticleLayout/Particle/Radius");
+    EXPECT_TRUE(StringUtils::matchesPattern(name, name));
+    EXPECT_TRUE(StringUtils::matchesPattern(name, "*"));
+    EXPECT_TRUE(StringUtils::matchesPattern(name, "*/Radius"));
+    EXPECT_TRUE(StringUtils::matchesPattern(name, "/GISASSimulation/*/Particle/*"));
+    EXPECT_TRUE(StringUtils::matchesPattern(name, "*Layer?/*Radius"));
+    EXPECT_TRUE(StringUtils::matchesPattern(name, "**/Radi?s"));
+    EXPECT_FALSE(StringUtils::matchesPattern(name, "*/Radius/*"));
+    EXPECT_FALSE(StringUtils::matchesPattern(name, "*Layer?/Radius"));
+    EXPECT_FALSE(StringUtils::matchesPattern(name, "/GISASSimulation"));
+    EXPECT_FALSE(StringUtils::matchesPattern(name, name + "?"));
+
+    // characters with a special meaning in regular expressions are matched literally
+    EXPECT_TRUE(StringUtils::matchesPattern("a.b(c)[d]+$", "a.b(c)[d]+$"));
+    EXPECT_TRUE(StringUtils::matchesPattern("a.b(c)[d]+$", "a.*+$"));
+    EXPECT_FALSE(StringUtils::matchesPattern("axb", "a.b"));
+    EXPECT_TRUE(StringUtils::matchesPattern("", "*"));
+    EXPECT_FALSE(StringUtils::matchesPattern("", "?"));
+}
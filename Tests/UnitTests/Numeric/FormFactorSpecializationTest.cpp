@@ -91,3 +91,27 @@ TEST_F(FFSpecializationTest, TruncatedSphereAsSphere)
     run_test(&p0, &p1, 1e-12, .02, 5e1);
 }
 
+
+TEST_F(FFSpecializationTest, FullSpheroidAsSphere)
+{
+    const double R = 1.;
+    FormFactorFullSpheroid p0(R, 2 * R);
+    FormFactorFullSphere p1(R);
+    run_test(&p0, &p1, 1e-12, .02, 5e1);
+}
+
+TEST_F(FFSpecializationTest, TruncatedSpheroidAsTruncatedSphere)
+{
+    const double R = .9, H = 1.3, dh = .2;
+    FormFactorTruncatedSpheroid p0(R, H, 1.0, dh);
+    FormFactorTruncatedSphere p1(R, H, dh);
+    run_test(&p0, &p1, 1e-12, 1e-99, 5e2);
+}
+
+TEST_F(FFSpecializationTest, ConeAsCylinder)
+{
+    const double R = .8, H = 1.2;
+    FormFactorCone p0(R, H, M_PI / 2);
+    FormFactorCylinder p1(R, H);
+    run_test(&p0, &p1, 1e-10, 1e-99, 5e2);
+}
@@ -0,0 +1,78 @@
+#ifndef SIMULATIONTESTHELPER_H
+#define SIMULATIONTESTHELPER_H
+
+#include "google_test.h"
+#include "CylindersBuilder.h"
+#include "GISASSimulation.h"
+#include "Layer.h"
+#include "MaterialFactoryFuncs.h"
+#include "MultiLayer.h"
+#include "ParticleLayout.h"
+#include "Units.h"
+#include <cmath>
+#include <memory>
+
+//! Samples and simulations shared by the tests that compare simulations run with different
+//! options. The materials are those of the standard samples.
+
+namespace SimulationTestHelper
+{
+inline Material particleMaterial()
+{
+    return HomogeneousMaterial("Particle", 6e-4, 2e-8);
+}
+
+inline Material substrateMaterial()
+{
+    return HomogeneousMaterial("Substrate", 6e-6, 2e-8);
+}
+
+//! Returns the sample of CylindersInDWBABuilder
+inline std::unique_ptr<MultiLayer> createCylinders()
+{
+    return std::unique_ptr<MultiLayer>(CylindersInDWBABuilder().buildSample());
+}
+
+//! Returns air decorated with the given layout on top of the given substrate
+inline std::unique_ptr<MultiLayer> createSample(const ParticleLayout& layout,
+                                                const Material& substrate = substrateMaterial())
+{
+    Layer air_layer(HomogeneousMaterial("Air", 0.0, 0.0));
+    air_layer.addLayout(layout);
+    std::unique_ptr<MultiLayer> result(new MultiLayer);
+    result->addLayer(air_layer);
+    result->addLayer(Layer(substrate));
+    return result;
+}
+
+//! Returns a single-threaded simulation with a detector symmetric with respect to the beam
+inline std::unique_ptr<GISASSimulation> createSimulation(const MultiLayer& sample, size_t nx = 10,
+                                                         size_t ny = 10)
+{
+    std::unique_ptr<GISASSimulation> result(new GISASSimulation(sample));
+    result->setDetectorParameters(nx, -2.0 * Units::deg, 2.0 * Units::deg, ny, 0.0,
+                                  3.0 * Units::deg);
+    result->setBeamParameters(0.1, 0.2 * Units::deg, 0.0);
+    result->getOptions().setNumberOfThreads(1);
+    return result;
+}
+
+template <class T> void expectPositive(const T& values)
+{
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_GT(values[i], 0.0);
+}
+
+//! Expects the values to agree within the given relative and absolute tolerances
+template <class T, class U>
+void expectNear(const T& values, const U& reference, double rel_tolerance,
+                double abs_tolerance = 0.0)
+{
+    ASSERT_EQ(values.size(), reference.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_NEAR(values[i], reference[i],
+                    rel_tolerance * std::abs(reference[i]) + abs_tolerance);
+}
+} // namespace SimulationTestHelper
+
+#endif // SIMULATIONTESTHELPER_H
@@ -201,6 +201,9 @@ class ObserverCallbackWrapper(PyObserverCallback):
             self.callback_container = []
         wrp = SimulationBuilderWrapper(callback)
         self.callback_container.append(wrp)
+        if not kwargs and (not args or isinstance(args[0], (int, float))):
+            # without uncertainties, numpy arrays are imported without intermediate copies
+            data = importNumpyArray(data)
         return self.addSimulationAndData_cpp(wrp, data, *args, **kwargs)
 
     def convert_params(self, params):
@@ -168,6 +168,7 @@
 #include "IShape2D.h"
 #include "ISingleton.h"
 #include "Instrument.h"
+#include "Instrumentation.h"
 #include "IntensityDataFunctions.h"
 #include "IntensityDataIOFactory.h"
 #include "InterferenceFunction1DLattice.h"
@@ -253,6 +254,7 @@
 %newobject DetectorMask::createHistogram() const;
 
 %newobject PyArrayImport::importArrayToOutputData;
+%newobject PyArrayImport::importNumpyArray;
 %newobject IHistogram::createFrom(const std::string& filename);
 %newobject IHistogram::createFrom(const std::vector<std::vector<double>>& data);
 
@@ -393,6 +395,7 @@
 %include "FootprintFactorGaussian.h"
 %include "FootprintFactorSquare.h"
 
+%include "Instrumentation.h"
 %include "Simulation.h"
 %include "Simulation2D.h"
 %include "SimulationOptions.h"
@@ -840,6 +840,16 @@ weight_factors:
 user-defined weighting factors. Used linearly, no matter which norm is chosen. 
 ";
 
+%feature("docstring")  Chi2Metric::computeFromSinglePrecision "double Chi2Metric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &uncertainties, const std::vector< float > &weight_factors) const override
+
+Computes metric value from the simulated intensities and from experimental data, uncertainties and user weights held in single precision (see  SimulationOptions::setSinglePrecisionData). Accumulates in double precision. The default implementation calls computeFromArrays on double-precision copies of the data; the metrics of this library read the single-precision values directly. 
+";
+
+%feature("docstring")  Chi2Metric::computeFromSinglePrecision "double Chi2Metric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &weight_factors) const override
+
+Computes unweighted metric value from the simulated intensities and from experimental data and user weights held in single precision. 
+";
+
 
 // File: classChiModuleWrapper.xml
 %feature("docstring") ChiModuleWrapper "
@@ -1173,6 +1183,9 @@ Creates region information with volumetric densities instead of absolute volume
 %feature("docstring")  Crystal::setDWFactor "void Crystal::setDWFactor(double dw_factor)
 ";
 
+%feature("docstring")  Crystal::debyeWallerFactor "double Crystal::debyeWallerFactor() const
+";
+
 %feature("docstring")  Crystal::getChildren "std::vector< const INode * > Crystal::getChildren() const override final
 
 Returns a vector of children (const). 
@@ -2375,6 +2388,23 @@ weight:
 weight of dataset in metric calculations 
 ";
 
+%feature("docstring")  FitObjective::addSimulationAndData "void FitObjective::addSimulationAndData(PyBuilderCallback &callback, const OutputData< double > &data, double weight=1.0)
+
+Constructs simulation/data pair for later fit from data which is already available as  OutputData, e.g. from  PyArrayImport::importNumpyArray, saving an intermediate copy.
+
+Parameters:
+-----------
+
+callback: 
+simulation builder capable of producing simulations
+
+data: 
+experimental data
+
+weight: 
+weight of dataset in metric calculations 
+";
+
 %feature("docstring")  FitObjective::addSimulationAndData "void FitObjective::addSimulationAndData(PyBuilderCallback &callback, const T &data, const T &uncertainties, double weight=1.0)
 
 Constructs simulation/data pair for later fit.
@@ -5906,6 +5936,11 @@ Put into a clean state for running a simulation.
 Returns the results of the simulation in a format that supports unit conversion and export to numpy arrays 
 ";
 
+%feature("docstring")  GISASSimulation::interpolationErrors "SimulationResult GISASSimulation::interpolationErrors() const
+
+Returns the estimated relative interpolation error of each detector channel, as obtained in a multi-resolution run (see  SimulationOptions::setMultiResolution). Zero for channels that were computed exactly. 
+";
+
 %feature("docstring")  GISASSimulation::setBeamParameters "void GISASSimulation::setBeamParameters(double wavelength, double alpha_i, double phi_i)
 
 Sets beam parameters from here (forwarded to  Instrument) 
@@ -8628,6 +8663,42 @@ Returns a vector of children (const).
 ";
 
 
+// File: structInstrumentationReport.xml
+%feature("docstring") InstrumentationReport "
+
+Times and counts of the simulation stages, summed over all threads.
+
+C++ includes: Instrumentation.h
+";
+
+%feature("docstring")  InstrumentationReport::InstrumentationReport "InstrumentationReport::InstrumentationReport()
+";
+
+%feature("docstring")  InstrumentationReport::seconds "double InstrumentationReport::seconds(Instrumentation::Stage stage) const
+";
+
+%feature("docstring")  InstrumentationReport::calls "size_t InstrumentationReport::calls(Instrumentation::Stage stage) const
+";
+
+%feature("docstring")  InstrumentationReport::count "size_t InstrumentationReport::count(Instrumentation::Counter counter) const
+";
+
+%feature("docstring")  InstrumentationReport::fresnelCacheHitRate "double InstrumentationReport::fresnelCacheHitRate() const
+
+Returns the fraction of the Fresnel coefficient lookups that were served from the cache 
+";
+
+%feature("docstring")  InstrumentationReport::toJson "std::string InstrumentationReport::toJson() const
+
+Returns the report as a JSON object 
+";
+
+%feature("docstring")  InstrumentationReport::since "InstrumentationReport InstrumentationReport::since(const InstrumentationReport &earlier) const
+
+Returns the counts accumulated since the given earlier report 
+";
+
+
 // File: classIntegratorComplex.xml
 %feature("docstring") IntegratorComplex "
 
@@ -10968,6 +11039,16 @@ weight_factors:
 user-defined weighting factors. Used linearly, no matter which norm is chosen. 
 ";
 
+%feature("docstring")  LogMetric::computeFromSinglePrecision "double LogMetric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &uncertainties, const std::vector< float > &weight_factors) const override
+
+Computes metric value from the simulated intensities and from experimental data, uncertainties and user weights held in single precision (see  SimulationOptions::setSinglePrecisionData). Accumulates in double precision. The default implementation calls computeFromArrays on double-precision copies of the data; the metrics of this library read the single-precision values directly. 
+";
+
+%feature("docstring")  LogMetric::computeFromSinglePrecision "double LogMetric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &weight_factors) const override
+
+Computes unweighted metric value from the simulated intensities and from experimental data and user weights held in single precision. 
+";
+
 
 // File: classLorentzFisherPeakShape.xml
 %feature("docstring") LorentzFisherPeakShape "
@@ -11667,6 +11748,16 @@ weight_factors:
 user-defined weighting factors. Used linearly, no matter which norm is chosen. 
 ";
 
+%feature("docstring")  ObjectiveMetric::computeFromSinglePrecision "virtual double ObjectiveMetric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &uncertainties, const std::vector< float > &weight_factors) const
+
+Computes metric value from the simulated intensities and from experimental data, uncertainties and user weights held in single precision (see  SimulationOptions::setSinglePrecisionData). Accumulates in double precision. The default implementation calls computeFromArrays on double-precision copies of the data; the metrics of this library read the single-precision values directly. 
+";
+
+%feature("docstring")  ObjectiveMetric::computeFromSinglePrecision "virtual double ObjectiveMetric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &weight_factors) const
+
+Computes unweighted metric value from the simulated intensities and from experimental data and user weights held in single precision. 
+";
+
 %feature("docstring")  ObjectiveMetric::setNorm "void ObjectiveMetric::setNorm(std::function< double(double)> norm)
 ";
 
@@ -12123,6 +12214,11 @@ Returns true if object have same dimensions and shape of axis.
 returns data as Python numpy array 
 ";
 
+%feature("docstring")  OutputData::getArrayView "PyObject* OutputData< T >::getArrayView() const
+
+returns Python numpy array of the same layout as getArray(), which shares the values with this object instead of copying them 
+";
+
 %feature("docstring")  OutputData::isInitialized "bool OutputData< T >::isInitialized() const
 
 returns true if object is correctly initialized 
@@ -13003,6 +13099,16 @@ weight_factors:
 user-defined weighting factors. Used linearly, no matter which norm is chosen. 
 ";
 
+%feature("docstring")  PoissonLikeMetric::computeFromSinglePrecision "double PoissonLikeMetric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &weight_factors) const override
+
+Computes unweighted metric value from the simulated intensities and from experimental data and user weights held in single precision. 
+";
+
+%feature("docstring")  PoissonLikeMetric::computeFromSinglePrecision "double Chi2Metric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &uncertainties, const std::vector< float > &weight_factors) const override
+
+Computes metric value from the simulated intensities and from experimental data, uncertainties and user weights held in single precision (see  SimulationOptions::setSinglePrecisionData). Accumulates in double precision. The default implementation calls computeFromArrays on double-precision copies of the data; the metrics of this library read the single-precision values directly. 
+";
+
 
 // File: classPoissonNoiseBackground.xml
 %feature("docstring") PoissonNoiseBackground "
@@ -14227,6 +14333,16 @@ weight_factors:
 user-defined weighting factors. Used linearly, no matter which norm is chosen. 
 ";
 
+%feature("docstring")  RelativeDifferenceMetric::computeFromSinglePrecision "double RelativeDifferenceMetric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &weight_factors) const override
+
+Computes unweighted metric value from the simulated intensities and from experimental data and user weights held in single precision. 
+";
+
+%feature("docstring")  RelativeDifferenceMetric::computeFromSinglePrecision "double Chi2Metric::computeFromSinglePrecision(const std::vector< double > &sim_data, const std::vector< float > &exp_data, const std::vector< float > &uncertainties, const std::vector< float > &weight_factors) const override
+
+Computes metric value from the simulated intensities and from experimental data, uncertainties and user weights held in single precision (see  SimulationOptions::setSinglePrecisionData). Accumulates in double precision. The default implementation calls computeFromArrays on double-precision copies of the data; the metrics of this library read the single-precision values directly. 
+";
+
 
 // File: classResolutionFunction2DGaussian.xml
 %feature("docstring") ResolutionFunction2DGaussian "
@@ -15118,6 +15234,26 @@ Returns the flattened experimental uncertainties cut to the ROI area. If no unce
 Returns a flat array of user weights cut to the ROI area. 
 ";
 
+%feature("docstring")  SimDataPair::singlePrecision "bool SimDataPair::singlePrecision() const
+
+Returns true if the experimental data, uncertainties and user weights are held in single precision (see  SimulationOptions::setSinglePrecisionData) 
+";
+
+%feature("docstring")  SimDataPair::experimentalValues "const std::vector< float > & SimDataPair::experimentalValues() const
+
+Returns the single-precision experimental data cut to the ROI area, without copying. Empty unless the data are held in single precision. 
+";
+
+%feature("docstring")  SimDataPair::uncertaintyValues "const std::vector< float > & SimDataPair::uncertaintyValues() const
+
+Returns the single-precision uncertainties cut to the ROI area, without copying. Empty unless the data are held in single precision and uncertainties were provided. 
+";
+
+%feature("docstring")  SimDataPair::userWeightValues "const std::vector< float > & SimDataPair::userWeightValues() const
+
+Returns the single-precision user weights cut to the ROI area, without copying. Empty unless the data are held in single precision. 
+";
+
 
 // File: classSimpleSelectionRule.xml
 %feature("docstring") SimpleSelectionRule "
@@ -15264,6 +15400,11 @@ Returns the results of the simulation in a format that supports unit conversion
 Initializes a progress monitor that prints to stdout. 
 ";
 
+%feature("docstring")  Simulation::instrumentationReport "InstrumentationReport Simulation::instrumentationReport() const
+
+Returns the times and counts of the simulation stages of the last run, recorded by the threads that worked on it. Stage times are only recorded if BornAgain is built with BORNAGAIN_INSTRUMENTATION. 
+";
+
 %feature("docstring")  Simulation::getChildren "std::vector< const INode * > Simulation::getChildren() const
 
 Returns a vector of children (const). 
@@ -15602,6 +15743,48 @@ Sets the batch and thread information to be used.
 %feature("docstring")  SimulationOptions::useAvgMaterials "bool SimulationOptions::useAvgMaterials() const
 ";
 
+%feature("docstring")  SimulationOptions::setMultiResolution "void SimulationOptions::setMultiResolution(bool flag=true, size_t step=4, double threshold=0.01)
+
+Enables/disables coarse-to-fine evaluation of 2D detectors.
+
+Parameters:
+-----------
+
+flag: 
+If true, detector channels are first computed on a coarse grid
+
+step: 
+Distance (in channels) between exactly computed nodes of the coarse grid, at least 2
+
+threshold: 
+Relative interpolation error above which a coarse cell is refined 
+";
+
+%feature("docstring")  SimulationOptions::isMultiResolution "bool SimulationOptions::isMultiResolution() const
+";
+
+%feature("docstring")  SimulationOptions::multiResolutionStep "size_t SimulationOptions::multiResolutionStep() const
+";
+
+%feature("docstring")  SimulationOptions::multiResolutionThreshold "double SimulationOptions::multiResolutionThreshold() const
+";
+
+%feature("docstring")  SimulationOptions::setSampleCaching "void SimulationOptions::setSampleCaching(bool flag=true)
+
+Enables/disables sharing of processed samples between simulations. If enabled, the slices and Fresnel coefficients of a layer stack, and the form factors of each particle, are taken from a process-wide cache (see  ProcessedSampleCache) if a stack or particle with identical content was processed before, e.g. for samples that differ only in the interference function. The cache holds a fixed number of stacks and particles regardless of their size; the Fresnel coefficients of each stack are kept for a single wavelength at a time. 
+";
+
+%feature("docstring")  SimulationOptions::useSampleCaching "bool SimulationOptions::useSampleCaching() const
+";
+
+%feature("docstring")  SimulationOptions::setSinglePrecisionData "void SimulationOptions::setSinglePrecisionData(bool flag=true)
+
+Enables/disables single-precision storage of the experimental data, uncertainties and user weights that a fit compares with the results of this simulation (see  SimDataPair). Only these input arrays are stored in single precision: the simulated intensities and their normalization, background and convolution stay in double precision. The data are converted once to the fit area of the first simulation; the copies of the data passed by the user are then released, so that later simulations must keep that fit area. The objective metrics and the residuals read the single-precision values directly and accumulate in double precision; the array accessors of the data return double-precision copies. 
+";
+
+%feature("docstring")  SimulationOptions::useSinglePrecisionData "bool SimulationOptions::useSinglePrecisionData() const
+";
+
 
 // File: classSimulationResult.xml
 %feature("docstring") SimulationResult "
@@ -16022,6 +16205,11 @@ Returns the total number of the intensity values in the simulation result.
 Returns internal data handler. 
 ";
 
+%feature("docstring")  SpecularSimulation::intensityDerivatives "std::vector< std::vector< double > > SpecularSimulation::intensityDerivatives(const Fit::Parameters &parameters)
+
+Returns the derivatives of the simulated intensities by the given fit parameters, one vector for each of them. Parameter names are matched against the parameter tree of the simulation, and must refer to parameters of the sample which only change the thickness or the roughness of slices, like layer thicknesses and roughness sigmas. The derivatives of the reflection coefficients are computed analytically. 
+";
+
 
 // File: classSpecularSimulationElement.xml
 %feature("docstring") SpecularSimulationElement "
@@ -17388,6 +17576,34 @@ Returns true if file with given name exists on disk.
 ";
 
 
+// File: namespaceInstrumentation.xml
+%feature("docstring")  Instrumentation::isEnabled "BA_CORE_API_ bool Instrumentation::isEnabled()
+
+Returns true if the timers and counters are compiled into the simulation code 
+";
+
+%feature("docstring")  Instrumentation::stageName "BA_CORE_API_ std::string Instrumentation::stageName(Stage stage)
+";
+
+%feature("docstring")  Instrumentation::counterName "BA_CORE_API_ std::string Instrumentation::counterName(Counter counter)
+";
+
+%feature("docstring")  Instrumentation::addTime "BA_CORE_API_ void Instrumentation::addTime(Stage stage, std::chrono::nanoseconds duration)
+
+Adds a call of the given stage that took the given time, for the calling thread 
+";
+
+%feature("docstring")  Instrumentation::addCount "BA_CORE_API_ void Instrumentation::addCount(Counter counter, size_t n=1)
+
+Increments the given counter of the calling thread 
+";
+
+%feature("docstring")  Instrumentation::addIntegration "BA_CORE_API_ void Instrumentation::addIntegration(size_t n_evaluations)
+
+Records a numerical integration for the run the calling thread is attached to, if any 
+";
+
+
 // File: namespaceIntensityDataFunctions.xml
 %feature("docstring")  IntensityDataFunctions::RelativeDifference "double IntensityDataFunctions::RelativeDifference(const SimulationResult &dat, const SimulationResult &ref)
 
@@ -17812,6 +18028,11 @@ for importing 1D array of doubles from python into  OutputData
 for importing 2D array of doubles from python into  OutputData
 ";
 
+%feature("docstring")  PyArrayImport::importNumpyArray "OutputData< double > * PyArrayImport::importNumpyArray(PyObject *obj)
+
+for importing 1D or 2D numpy array (layout as in  OutputData::getArray()) into  OutputData. Writeable arrays of doubles, whose memory layout coincides with the one of  OutputData (1D contiguous arrays, or arrays returned by  OutputData::getArrayView()), are shared without copying. Other arrays are copied once. 
+";
+
 
 // File: namespacePyEmbeddedUtils.xml
 %feature("docstring")  PyEmbeddedUtils::toString "std::string PyEmbeddedUtils::toString(PyObject *obj)
@@ -6696,6 +6696,8 @@ class FitObjective(_object):
 
     def addSimulationAndData_cpp(self, *args):
         """
+        addSimulationAndData_cpp(FitObjective self, PyBuilderCallback callback, IntensityData data, double weight=1.0)
+        addSimulationAndData_cpp(FitObjective self, PyBuilderCallback callback, IntensityData data)
         addSimulationAndData_cpp(FitObjective self, PyBuilderCallback callback, vdouble1d_t data, double weight=1.0)
         addSimulationAndData_cpp(FitObjective self, PyBuilderCallback callback, vdouble1d_t data)
         addSimulationAndData_cpp(FitObjective self, PyBuilderCallback callback, vdouble1d_t data, vdouble1d_t uncertainties, double weight=1.0)
@@ -6750,6 +6752,9 @@ class FitObjective(_object):
             self.callback_container = []
         wrp = SimulationBuilderWrapper(callback)
         self.callback_container.append(wrp)
+        if not kwargs and (not args or isinstance(args[0], (int, float))):
+            # without uncertainties, numpy arrays are imported without intermediate copies
+            data = importNumpyArray(data)
         return self.addSimulationAndData_cpp(wrp, data, *args, **kwargs)
 
     def convert_params(self, params):
@@ -7558,6 +7563,16 @@ class Crystal(IClusteredParticles):
         return _libBornAgainCore.Crystal_setDWFactor(self, dw_factor)
 
 
+    def debyeWallerFactor(self):
+        """
+        debyeWallerFactor(Crystal self) -> double
+
+        double Crystal::debyeWallerFactor() const
+
+        """
+        return _libBornAgainCore.Crystal_debyeWallerFactor(self)
+
+
     def getChildren(self):
         """
         getChildren(Crystal self) -> swig_dummy_type_const_inode_vector
@@ -16580,6 +16595,201 @@ class FootprintFactorSquare(IFootprintFactor):
 FootprintFactorSquare_swigregister = _libBornAgainCore.FootprintFactorSquare_swigregister
 FootprintFactorSquare_swigregister(FootprintFactorSquare)
 
+SampleProcessing = _libBornAgainCore.SampleProcessing
+FresnelCoefficients = _libBornAgainCore.FresnelCoefficients
+ParticleLayouts = _libBornAgainCore.ParticleLayouts
+FormFactors = _libBornAgainCore.FormFactors
+InterferenceFunctions = _libBornAgainCore.InterferenceFunctions
+MonteCarloIntegration = _libBornAgainCore.MonteCarloIntegration
+Roughness = _libBornAgainCore.Roughness
+SpecularPeak = _libBornAgainCore.SpecularPeak
+DetectorResolution = _libBornAgainCore.DetectorResolution
+Normalization = _libBornAgainCore.Normalization
+Background = _libBornAgainCore.Background
+NumberOfStages = _libBornAgainCore.NumberOfStages
+SimulationElements = _libBornAgainCore.SimulationElements
+FresnelLookups = _libBornAgainCore.FresnelLookups
+FresnelCacheMisses = _libBornAgainCore.FresnelCacheMisses
+MonteCarloEvaluations = _libBornAgainCore.MonteCarloEvaluations
+NumberOfCounters = _libBornAgainCore.NumberOfCounters
+
+def isEnabled():
+    """
+    isEnabled() -> bool
+
+    BA_CORE_API_ bool Instrumentation::isEnabled()
+
+    Returns true if the timers and counters are compiled into the simulation code 
+
+    """
+    return _libBornAgainCore.isEnabled()
+
+def stageName(stage):
+    """
+    stageName(Instrumentation::Stage stage) -> std::string
+
+    BA_CORE_API_ std::string Instrumentation::stageName(Stage stage)
+
+    """
+    return _libBornAgainCore.stageName(stage)
+
+def counterName(counter):
+    """
+    counterName(Instrumentation::Counter counter) -> std::string
+
+    BA_CORE_API_ std::string Instrumentation::counterName(Counter counter)
+
+    """
+    return _libBornAgainCore.counterName(counter)
+
+class InstrumentationReport(_object):
+    """
+
+
+    Times and counts of the simulation stages, summed over all threads.
+
+    C++ includes: Instrumentation.h
+
+    """
+
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, InstrumentationReport, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, InstrumentationReport, name)
+    __repr__ = _swig_repr
+
+    def __init__(self):
+        """
+        __init__(InstrumentationReport self) -> InstrumentationReport
+
+        InstrumentationReport::InstrumentationReport()
+
+        """
+        this = _libBornAgainCore.new_InstrumentationReport()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+
+    def seconds(self, stage):
+        """
+        seconds(InstrumentationReport self, Instrumentation::Stage stage) -> double
+
+        double InstrumentationReport::seconds(Instrumentation::Stage stage) const
+
+        """
+        return _libBornAgainCore.InstrumentationReport_seconds(self, stage)
+
+
+    def calls(self, stage):
+        """
+        calls(InstrumentationReport self, Instrumentation::Stage stage) -> size_t
+
+        size_t InstrumentationReport::calls(Instrumentation::Stage stage) const
+
+        """
+        return _libBornAgainCore.InstrumentationReport_calls(self, stage)
+
+
+    def count(self, counter):
+        """
+        count(InstrumentationReport self, Instrumentation::Counter counter) -> size_t
+
+        size_t InstrumentationReport::count(Instrumentation::Counter counter) const
+
+        """
+        return _libBornAgainCore.InstrumentationReport_count(self, counter)
+
+
+    def fresnelCacheHitRate(self):
+        """
+        fresnelCacheHitRate(InstrumentationReport self) -> double
+
+        double InstrumentationReport::fresnelCacheHitRate() const
+
+        Returns the fraction of the Fresnel coefficient lookups that were served from the cache 
+
+        """
+        return _libBornAgainCore.InstrumentationReport_fresnelCacheHitRate(self)
+
+
+    def toJson(self):
+        """
+        toJson(InstrumentationReport self) -> std::string
+
+        std::string InstrumentationReport::toJson() const
+
+        Returns the report as a JSON object 
+
+        """
+        return _libBornAgainCore.InstrumentationReport_toJson(self)
+
+
+    def current():
+        """
+        current() -> InstrumentationReport
+
+        InstrumentationReport InstrumentationReport::current()
+
+        Returns the counts of all threads since the start of the program 
+
+        """
+        return _libBornAgainCore.InstrumentationReport_current()
+
+    current = staticmethod(current)
+    __swig_getmethods__["current"] = lambda x: current
+
+    def since(self, earlier):
+        """
+        since(InstrumentationReport self, InstrumentationReport earlier) -> InstrumentationReport
+
+        InstrumentationReport InstrumentationReport::since(const InstrumentationReport &earlier) const
+
+        Returns the counts accumulated since the given earlier report 
+
+        """
+        return _libBornAgainCore.InstrumentationReport_since(self, earlier)
+
+    __swig_setmethods__["enabled"] = _libBornAgainCore.InstrumentationReport_enabled_set
+    __swig_getmethods__["enabled"] = _libBornAgainCore.InstrumentationReport_enabled_get
+    if _newclass:
+        enabled = _swig_property(_libBornAgainCore.InstrumentationReport_enabled_get, _libBornAgainCore.InstrumentationReport_enabled_set)
+    __swig_setmethods__["stage_seconds"] = _libBornAgainCore.InstrumentationReport_stage_seconds_set
+    __swig_getmethods__["stage_seconds"] = _libBornAgainCore.InstrumentationReport_stage_seconds_get
+    if _newclass:
+        stage_seconds = _swig_property(_libBornAgainCore.InstrumentationReport_stage_seconds_get, _libBornAgainCore.InstrumentationReport_stage_seconds_set)
+    __swig_setmethods__["stage_calls"] = _libBornAgainCore.InstrumentationReport_stage_calls_set
+    __swig_getmethods__["stage_calls"] = _libBornAgainCore.InstrumentationReport_stage_calls_get
+    if _newclass:
+        stage_calls = _swig_property(_libBornAgainCore.InstrumentationReport_stage_calls_get, _libBornAgainCore.InstrumentationReport_stage_calls_set)
+    __swig_setmethods__["counts"] = _libBornAgainCore.InstrumentationReport_counts_set
+    __swig_getmethods__["counts"] = _libBornAgainCore.InstrumentationReport_counts_get
+    if _newclass:
+        counts = _swig_property(_libBornAgainCore.InstrumentationReport_counts_get, _libBornAgainCore.InstrumentationReport_counts_set)
+    __swig_setmethods__["integrations"] = _libBornAgainCore.InstrumentationReport_integrations_set
+    __swig_getmethods__["integrations"] = _libBornAgainCore.InstrumentationReport_integrations_get
+    if _newclass:
+        integrations = _swig_property(_libBornAgainCore.InstrumentationReport_integrations_get, _libBornAgainCore.InstrumentationReport_integrations_set)
+    __swig_setmethods__["integrand_evaluations"] = _libBornAgainCore.InstrumentationReport_integrand_evaluations_set
+    __swig_getmethods__["integrand_evaluations"] = _libBornAgainCore.InstrumentationReport_integrand_evaluations_get
+    if _newclass:
+        integrand_evaluations = _swig_property(_libBornAgainCore.InstrumentationReport_integrand_evaluations_get, _libBornAgainCore.InstrumentationReport_integrand_evaluations_set)
+    __swig_destroy__ = _libBornAgainCore.delete_InstrumentationReport
+    __del__ = lambda self: None
+InstrumentationReport_swigregister = _libBornAgainCore.InstrumentationReport_swigregister
+InstrumentationReport_swigregister(InstrumentationReport)
+
+def InstrumentationReport_current():
+    """
+    InstrumentationReport_current() -> InstrumentationReport
+
+    InstrumentationReport InstrumentationReport::current()
+
+    Returns the counts of all threads since the start of the program
+
+    """
+    return _libBornAgainCore.InstrumentationReport_current()
+
 class Simulation(ICloneable, INode):
     """
 
@@ -16880,6 +17090,18 @@ class Simulation(ICloneable, INode):
         return _libBornAgainCore.Simulation_setTerminalProgressMonitor(self)
 
 
+    def instrumentationReport(self):
+        """
+        instrumentationReport(Simulation self) -> InstrumentationReport
+
+        InstrumentationReport Simulation::instrumentationReport() const
+
+        Returns the times and counts of the simulation stages of the last run, recorded by the threads that worked on it. Stage times are only recorded if BornAgain is built with BORNAGAIN_INSTRUMENTATION. 
+
+        """
+        return _libBornAgainCore.Simulation_instrumentationReport(self)
+
+
     def getChildren(self):
         """
         getChildren(Simulation self) -> swig_dummy_type_const_inode_vector
@@ -17228,6 +17450,109 @@ class SimulationOptions(_object):
         """
         return _libBornAgainCore.SimulationOptions_useAvgMaterials(self)
 
+
+    def setMultiResolution(self, flag=True, step=4, threshold=0.01):
+        """
+        setMultiResolution(SimulationOptions self, bool flag=True, size_t step=4, double threshold=0.01)
+        setMultiResolution(SimulationOptions self, bool flag=True, size_t step=4)
+        setMultiResolution(SimulationOptions self, bool flag=True)
+        setMultiResolution(SimulationOptions self)
+
+        void SimulationOptions::setMultiResolution(bool flag=true, size_t step=4, double threshold=0.01)
+
+        Enables/disables coarse-to-fine evaluation of 2D detectors.
+
+        Parameters:
+        -----------
+
+        flag: 
+        If true, detector channels are first computed on a coarse grid
+
+        step: 
+        Distance (in channels) between exactly computed nodes of the coarse grid, at least 2
+
+        threshold: 
+        Relative interpolation error above which a coarse cell is refined 
+
+        """
+        return _libBornAgainCore.SimulationOptions_setMultiResolution(self, flag, step, threshold)
+
+
+    def isMultiResolution(self):
+        """
+        isMultiResolution(SimulationOptions self) -> bool
+
+        bool SimulationOptions::isMultiResolution() const
+
+        """
+        return _libBornAgainCore.SimulationOptions_isMultiResolution(self)
+
+
+    def multiResolutionStep(self):
+        """
+        multiResolutionStep(SimulationOptions self) -> size_t
+
+        size_t SimulationOptions::multiResolutionStep() const
+
+        """
+        return _libBornAgainCore.SimulationOptions_multiResolutionStep(self)
+
+
+    def multiResolutionThreshold(self):
+        """
+        multiResolutionThreshold(SimulationOptions self) -> double
+
+        double SimulationOptions::multiResolutionThreshold() const
+
+        """
+        return _libBornAgainCore.SimulationOptions_multiResolutionThreshold(self)
+
+
+    def setSampleCaching(self, flag=True):
+        """
+        setSampleCaching(SimulationOptions self, bool flag=True)
+        setSampleCaching(SimulationOptions self)
+
+        void SimulationOptions::setSampleCaching(bool flag=true)
+
+        Enables/disables sharing of processed samples between simulations. If enabled, the slices and Fresnel coefficients of a layer stack, and the form factors of each particle, are taken from a process-wide cache (see  ProcessedSampleCache) if a stack or particle with identical content was processed before, e.g. for samples that differ only in the interference function. The cache holds a fixed number of stacks and particles regardless of their size; the Fresnel coefficients of each stack are kept for a single wavelength at a time. 
+
+        """
+        return _libBornAgainCore.SimulationOptions_setSampleCaching(self, flag)
+
+
+    def useSampleCaching(self):
+        """
+        useSampleCaching(SimulationOptions self) -> bool
+
+        bool SimulationOptions::useSampleCaching() const
+
+        """
+        return _libBornAgainCore.SimulationOptions_useSampleCaching(self)
+
+
+    def setSinglePrecisionData(self, flag=True):
+        """
+        setSinglePrecisionData(SimulationOptions self, bool flag=True)
+        setSinglePrecisionData(SimulationOptions self)
+
+        void SimulationOptions::setSinglePrecisionData(bool flag=true)
+
+        Enables/disables single-precision storage of the experimental data, uncertainties and user weights that a fit compares with the results of this simulation (see  SimDataPair). Only these input arrays are stored in single precision: the simulated intensities and their normalization, background and convolution stay in double precision. The data are converted once to the fit area of the first simulation; the copies of the data passed by the user are then released, so that later simulations must keep that fit area. The objective metrics and the residuals read the single-precision values directly and accumulate in double precision; the array accessors of the data return double-precision copies. 
+
+        """
+        return _libBornAgainCore.SimulationOptions_setSinglePrecisionData(self, flag)
+
+
+    def useSinglePrecisionData(self):
+        """
+        useSinglePrecisionData(SimulationOptions self) -> bool
+
+        bool SimulationOptions::useSinglePrecisionData() const
+
+        """
+        return _libBornAgainCore.SimulationOptions_useSinglePrecisionData(self)
+
     __swig_destroy__ = _libBornAgainCore.delete_SimulationOptions
     __del__ = lambda self: None
 SimulationOptions_swigregister = _libBornAgainCore.SimulationOptions_swigregister
@@ -17316,6 +17641,18 @@ class GISASSimulation(Simulation2D):
         return _libBornAgainCore.GISASSimulation_result(self)
 
 
+    def interpolationErrors(self):
+        """
+        interpolationErrors(GISASSimulation self) -> SimulationResult
+
+        SimulationResult GISASSimulation::interpolationErrors() const
+
+        Returns the estimated relative interpolation error of each detector channel, as obtained in a multi-resolution run (see  SimulationOptions::setMultiResolution). Zero for channels that were computed exactly. 
+
+        """
+        return _libBornAgainCore.GISASSimulation_interpolationErrors(self)
+
+
     def setBeamParameters(self, wavelength, alpha_i, phi_i):
         """
         setBeamParameters(GISASSimulation self, double wavelength, double alpha_i, double phi_i)
@@ -26060,6 +26397,18 @@ class IntensityData(_object):
         return _libBornAgainCore.IntensityData_getArray(self)
 
 
+    def getArrayView(self):
+        """
+        getArrayView(IntensityData self) -> PyObject *
+
+        PyObject* OutputData< T >::getArrayView() const
+
+        returns Python numpy array of the same layout as getArray(), which shares the values with this object instead of copying them 
+
+        """
+        return _libBornAgainCore.IntensityData_getArrayView(self)
+
+
     def isInitialized(self):
         """
         isInitialized(IntensityData self) -> bool
@@ -27412,6 +27761,17 @@ def importArrayToOutputData(*args):
 
     """
     return _libBornAgainCore.importArrayToOutputData(*args)
+
+def importNumpyArray(obj):
+    """
+    importNumpyArray(PyObject * obj) -> IntensityData
+
+    OutputData< double > * PyArrayImport::importNumpyArray(PyObject *obj)
+
+    for importing 1D or 2D numpy array (layout as in  OutputData::getArray()) into  OutputData. Writeable arrays of doubles, whose memory layout coincides with the one of  OutputData (1D contiguous arrays, or arrays returned by  OutputData::getArrayView()), are shared without copying. Other arrays are copied once. 
+
+    """
+    return _libBornAgainCore.importNumpyArray(obj)
 class PoissonNoiseBackground(IBackground):
     """
 
@@ -0,0 +1,60 @@
+// Compares accuracy and speed of the Bessel functions in FastSpecialFunctions with GSL.
+//
+// Build against the BornAgain core library, e.g. from the build directory with
+//   g++ -O2 -std=c++14 -I../Core/Tools -I../Core/Basics -I<build>/inc \
+//       ../dev-tools/math/specfunc/bessel_benchmark.cpp -o bessel_benchmark \
+//       -Llib -lBornAgainCore -lgsl -lgslcblas
+
+#include "FastSpecialFunctions.h"
+#include <gsl/gsl_sf_bessel.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+const size_t n_points = 1 << 20;
+const int n_repetitions = 10;
+
+//! Returns the time per evaluation in ns
+template <class F> double timing(F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n_repetitions; ++i)
+        f();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / n_repetitions / n_points * 1e9;
+}
+
+void compare(const char* name, double (*gsl_function)(double), double (*fast_function)(double),
+             double x_max)
+{
+    std::vector<double> x(n_points), reference(n_points), result(n_points);
+    for (size_t i = 0; i < n_points; ++i)
+        x[i] = x_max * (i + 0.5) / n_points;
+
+    const double t_gsl = timing([&] {
+        for (size_t i = 0; i < n_points; ++i)
+            reference[i] = gsl_function(x[i]);
+    });
+    const double t_fast = timing([&] {
+        for (size_t i = 0; i < n_points; ++i)
+            result[i] = fast_function(x[i]);
+    });
+    double max_error = 0.0;
+    for (size_t i = 0; i < n_points; ++i)
+        max_error = std::max(max_error, std::abs(result[i] - reference[i]));
+    printf("%-4s x < %-6g  GSL %6.1f ns, fast %6.1f ns, max. deviation %.1e\n", name, x_max,
+           t_gsl, t_fast, max_error);
+}
+} // namespace
+
+int main()
+{
+    for (double x_max : {8.0, 100.0}) {
+        compare("J0", gsl_sf_bessel_J0, FastSpecialFunctions::Bessel_J0, x_max);
+        compare("J1", gsl_sf_bessel_J1, FastSpecialFunctions::Bessel_J1, x_max);
+    }
+    return 0;
+}
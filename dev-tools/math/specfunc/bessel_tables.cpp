@@ -0,0 +1,110 @@
+// Generates the Chebyshev coefficient tables in Core/Tools/FastSpecialFunctions.cpp.
+//
+// Build and run with
+//   g++ -O2 bessel_tables.cpp -o bessel_tables && ./bessel_tables
+// Requires boost::math and boost::multiprecision. All values are computed with 50 decimal
+// digits, so that even the last coefficients, of order 1e-20, are free of rounding errors.
+//
+// For 0 <= x < 8, J0(x) and J1(x)/x are expanded on 16 intervals of width 1/2.
+// For x >= 8, the Bessel functions are written as
+//   J_n(x) = sqrt(2/(pi*x)) * (P_n(x) * cos(theta) - Q_n(x) * sin(theta)),
+//   theta = x - (2n+1)*pi/4,
+// and P_n and x*Q_n are expanded as functions of u = (8/x)^2 on [0, 1]. For large x, the
+// reference values of P_n and Q_n are taken from Hankel's asymptotic expansion, which avoids
+// the cancellation in their computation from J_n and Y_n.
+
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef boost::multiprecision::cpp_bin_float_50 real;
+const real pi = boost::math::constants::pi<real>();
+const int n_small = 12;  // number of coefficients per interval for x < 8
+const int n_large = 14;  // number of coefficients for x >= 8
+const int n_samples = 64;
+
+//! Chebyshev coefficients of f on [a, b], such that f = sum_j c_j T_j(t), t in [-1, 1]
+std::vector<real> chebyshev(std::function<real(real)> f, real a, real b, int n)
+{
+    std::vector<real> values(n_samples), result(n);
+    for (int k = 0; k < n_samples; ++k)
+        values[k] = f((a + b) / 2 + (b - a) / 2 * cos(pi * (k + real(0.5)) / n_samples));
+    for (int j = 0; j < n; ++j) {
+        real sum = 0;
+        for (int k = 0; k < n_samples; ++k)
+            sum += values[k] * cos(pi * j * (k + real(0.5)) / n_samples);
+        result[j] = 2 * sum / n_samples;
+    }
+    result[0] /= 2;
+    return result;
+}
+
+real J(int n, real x) { return boost::math::cyl_bessel_j(n, x); }
+real Y(int n, real x) { return boost::math::cyl_neumann(n, x); }
+
+//! Returns P_n(x) if want_p, else x*Q_n(x), from Hankel's expansion
+real hankel(int n, real x, bool want_p)
+{
+    const real mu = 4 * n * n;
+    real a = 1, p = 0, q = 0;
+    for (int k = 0; k < 60 && abs(a) > real(1e-52); ++k) {
+        if (k > 0)
+            a *= (mu - (2 * k - 1) * (2 * k - 1)) / (k * 8 * x);
+        const real term = (k / 2) % 2 ? -a : a;
+        (k % 2 ? q : p) += term;
+    }
+    return want_p ? p : q * x;
+}
+
+//! Returns P_n if want_p, else x*Q_n, as function of u = (8/x)^2
+real asymptotic(int n, real u, bool want_p)
+{
+    if (u == 0)
+        return want_p ? real(1) : (n ? real(0.375) : real(-0.125));
+    const real x = 8 / sqrt(u);
+    if (x > 30)
+        return hankel(n, x, want_p);
+    const real theta = x - (2 * n + 1) * pi / 4;
+    const real amplitude = sqrt(2 / (pi * x));
+    if (want_p)
+        return (J(n, x) * cos(theta) + Y(n, x) * sin(theta)) / amplitude;
+    return x * (Y(n, x) * cos(theta) - J(n, x) * sin(theta)) / amplitude;
+}
+
+void print(const std::string& name, const std::vector<std::vector<real>>& table)
+{
+    printf("const double %s[%zu][%zu] = {\n", name.c_str(), table.size(), table[0].size());
+    for (const auto& row : table) {
+        printf("    {");
+        for (size_t j = 0; j < row.size(); ++j)
+            printf("%s%.17Le%s", j % 3 ? " " : (j ? "\n     " : ""),
+                   row[j].convert_to<long double>(), j + 1 < row.size() ? "," : "");
+        printf("},\n");
+    }
+    printf("};\n\n");
+}
+
+int main()
+{
+    std::vector<std::vector<real>> j0, j1c;
+    for (int i = 0; i < 16; ++i) {
+        const real a = real(i) / 2, b = real(i + 1) / 2;
+        j0.push_back(chebyshev([](real x) { return J(0, x); }, a, b, n_small));
+        j1c.push_back(
+            chebyshev([](real x) { return x == 0 ? real(0.5) : J(1, x) / x; }, a, b, n_small));
+    }
+    print("j0_small", j0);
+    print("j1c_small", j1c);
+
+    std::vector<std::vector<real>> large;
+    for (int n = 0; n < 2; ++n)
+        for (bool want_p : {true, false})
+            large.push_back(
+                chebyshev([=](real u) { return asymptotic(n, u, want_p); }, 0, 1, n_large));
+    print("pq_large", large);
+    return 0;
+}